@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <limits>
 #include <type_traits>
 #include <utility>
 
@@ -62,6 +64,19 @@ struct MultiplyTypeBy;
 template <typename T, typename M>
 struct DivideTypeByInteger;
 
+#if defined(__SIZEOF_INT128__)
+//
+// `WideMultiplyDivide<T, M>` represents an operation that multiplies a value of integral type `T`
+// by the rational magnitude `M`, by multiplying by its numerator and then dividing by its
+// denominator.  The intermediate product is computed in a 128-bit integer, so it can't overflow;
+// the only values that overflow are those whose _final result_ can't fit in `T`.
+//
+// Only available when the compiler provides a 128-bit integer type.
+//
+template <typename T, typename M>
+struct WideMultiplyDivide;
+#endif
+
 //
 // `OpSequence<Ops...>` represents an ordered sequence of operations.
 //
@@ -73,6 +88,92 @@ struct OpSequenceImpl;
 template <typename... Ops>
 using OpSequence = FlattenAs<OpSequenceImpl, Ops...>;
 
+//
+// `LaneOp<Op>` is the operation which `Op` performs on each lane (each scalar value) of its input.
+// For a real scalar rep, this is just `Op`.  For a rep with many lanes, such as an Eigen
+// type, it's the same operation on the `RealPart` of each type: for example,
+// `LaneOp<MultiplyTypeBy<Eigen::Vector3i, M>>` is `MultiplyTypeBy<int, M>`.
+//
+template <typename Op>
+struct LaneOpImpl;
+template <typename Op>
+using LaneOp = typename LaneOpImpl<Op>::type;
+
+//
+// `any_lane(c)` reduces the result `c` of comparing values of some rep to a single `bool`, which is
+// `true` if the comparison holds for any lane.
+//
+// For most reps, comparisons already produce a `bool`, which we return unchanged.  Reps whose
+// comparisons are lane-wise (such as `std::experimental::simd`) produce a mask instead, which we
+// reduce with an `any_of()` function found via argument-dependent lookup.
+//
+AU_DEVICE_FUNC constexpr bool any_lane(bool c) { return c; }
+template <typename Mask, std::enable_if_t<!std::is_convertible<Mask, bool>::value, int> = 0>
+AU_DEVICE_FUNC constexpr bool any_lane(const Mask &c) {
+    return any_of(c);
+}
+
+//
+// `any_lane_below(x, limit)`, `any_lane_above(x, limit)`, and `any_lane_nonzero(x)` check whether
+// any lane of the value `x` is below `limit`, above `limit`, or nonzero, respectively.  (For
+// a scalar, there's only one lane.)  `any_lane_outside(x, lo, hi)` checks whether any lane is below
+// `lo` or above `hi`, in a single check.  `any_lane_not_multiple_of(x, d)` checks whether any lane
+// of the integral value `x` is not a multiple of `d`.
+//
+// These all forward to `LaneChecks<T>`, which compares lane-wise, and reduces the result with
+// `any_lane()`.  Reps whose values can't (or shouldn't) be compared lane-wise can specialize it:
+// for example, `"au/compatibility/eigen.hh"` does so for Eigen's types, using its reductions.
+//
+template <typename T, typename Enable = void>
+struct LaneChecks {
+    template <typename L>
+    static AU_DEVICE_FUNC constexpr bool any_below(const T &x, const L &limit) {
+        return any_lane(x < limit);
+    }
+
+    template <typename L>
+    static AU_DEVICE_FUNC constexpr bool any_above(const T &x, const L &limit) {
+        return any_lane(x > limit);
+    }
+
+    template <typename L>
+    static AU_DEVICE_FUNC constexpr bool any_outside(const T &x, const L &lo, const L &hi) {
+        return any_lane((x < lo) || (x > hi));
+    }
+
+    static AU_DEVICE_FUNC constexpr bool any_nonzero(const T &x) { return any_lane(x != T{0}); }
+
+    template <typename D>
+    static AU_DEVICE_FUNC constexpr bool any_not_multiple_of(const T &x, const D &d) {
+        return any_lane((x % d) != T{0});
+    }
+};
+
+template <typename T, typename L>
+AU_DEVICE_FUNC constexpr bool any_lane_below(const T &x, const L &limit) {
+    return LaneChecks<T>::any_below(x, limit);
+}
+
+template <typename T, typename L>
+AU_DEVICE_FUNC constexpr bool any_lane_above(const T &x, const L &limit) {
+    return LaneChecks<T>::any_above(x, limit);
+}
+
+template <typename T, typename L>
+AU_DEVICE_FUNC constexpr bool any_lane_outside(const T &x, const L &lo, const L &hi) {
+    return LaneChecks<T>::any_outside(x, lo, hi);
+}
+
+template <typename T>
+AU_DEVICE_FUNC constexpr bool any_lane_nonzero(const T &x) {
+    return LaneChecks<T>::any_nonzero(x);
+}
+
+template <typename T, typename D>
+AU_DEVICE_FUNC constexpr bool any_lane_not_multiple_of(const T &x, const D &d) {
+    return LaneChecks<T>::any_not_multiple_of(x, d);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // IMPLEMENTATION DETAILS (`abstract_operations.hh`):
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -171,11 +272,17 @@ template <typename T, typename M>
 struct OpOutputImpl<DivideTypeByInteger<T, M>>
     : stdx::type_identity<decltype(std::declval<T>() / std::declval<RealPart<T>>())> {};
 
+// We compute the divisor in a `constexpr` variable, rather than calling `get_value()` inline.  This
+// guarantees that the compiler sees a literal constant divisor, even in builds that don't inline or
+// constant-fold `get_value()` (such as `-O0`).  Compilers replace integer division by a constant
+// with a multiply-high-and-shift sequence that gives identical results; a divisor that is only
+// known at runtime would instead cost a hardware division instruction for every value.
 template <typename T, typename M, MagRepresentationOutcome MagOutcome>
 struct DivideTypeByIntegerImpl {
     static AU_DEVICE_FUNC constexpr OpOutput<DivideTypeByInteger<T, M>> apply_to(const T &value) {
         static_assert(MagOutcome == MagRepresentationOutcome::OK, "Internal library error");
-        return value / get_value<RealPart<T>>(M{});
+        constexpr auto divisor = get_value<RealPart<T>>(M{});
+        return value / divisor;
     }
 };
 
@@ -195,6 +302,67 @@ struct DivideTypeByInteger
                   " (use `MultiplyTypeBy` with inverse instead)");
 };
 
+#if defined(__SIZEOF_INT128__)
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `WideMultiplyDivide<T, M>` implementation.
+
+// `OpInput` and `OpOutput`:
+template <typename T, typename M>
+struct OpInputImpl<WideMultiplyDivide<T, M>> : stdx::type_identity<T> {};
+template <typename T, typename M>
+struct OpOutputImpl<WideMultiplyDivide<T, M>> : stdx::type_identity<T> {};
+
+// `WideMultiplyDivide<T, M>` operation:
+//
+// Values whose product with the numerator fits in `T` take the ordinary (narrow) path, so only
+// values that actually need the extra width pay for a 128-bit division.  Both paths truncate toward
+// zero, so they give identical results.
+template <typename T, typename M>
+struct WideMultiplyDivide {
+    static_assert(std::is_integral<T>::value && sizeof(T) <= sizeof(std::uint64_t),
+                  "Wide multiply-divide supports integral types of at most 64 bits");
+    static_assert(IsRational<M>::value, "Wide multiply-divide requires a rational magnitude");
+    static_assert(std::is_signed<T>::value || IsPositive<M>::value,
+                  "Cannot apply a negative factor to an unsigned type");
+
+    using Wide = std::conditional_t<std::is_signed<T>::value, __int128_t, __uint128_t>;
+
+    static constexpr std::uint64_t numerator() {
+        return get_value<std::uint64_t>(Abs<Numerator<M>>{});
+    }
+    static constexpr std::uint64_t denominator() {
+        return get_value<std::uint64_t>(Denominator<M>{});
+    }
+
+    // The largest magnitude of input whose product with the numerator fits in `T`.  (If the
+    // numerator or denominator doesn't itself fit in `T`, only zero can take the narrow path.)
+    static constexpr T narrow_limit() {
+        constexpr auto max = static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+        return (numerator() > max || denominator() > max)
+                   ? T{0}
+                   : static_cast<T>(std::numeric_limits<T>::max() / static_cast<T>(numerator()));
+    }
+
+    static AU_DEVICE_FUNC constexpr T apply_to(const T &value) {
+        constexpr T n = static_cast<T>(numerator());
+        constexpr T d = static_cast<T>(denominator());
+        constexpr Wide wide_n = IsPositive<M>::value ? static_cast<Wide>(numerator())
+                                                     : -static_cast<Wide>(numerator());
+        constexpr Wide wide_d = static_cast<Wide>(denominator());
+        constexpr T limit = narrow_limit();
+
+        constexpr T neg_limit = std::is_signed<T>::value ? static_cast<T>(T{0} - limit) : T{0};
+
+        const bool fits_narrow = (value <= limit) && (value >= neg_limit);
+        if (fits_narrow) {
+            const T result = static_cast<T>(value * n / d);
+            return IsPositive<M>::value ? result : static_cast<T>(T{0} - result);
+        }
+        return static_cast<T>(static_cast<Wide>(value) * wide_n / wide_d);
+    }
+};
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // `OpSequence<Ops...>` implementation.
 
@@ -230,5 +398,31 @@ struct OpSequenceImpl<Op, Ops...> {
     }
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `LaneOp<Op>` implementation.
+
+template <typename T, typename U>
+struct LaneOpImpl<StaticCast<T, U>> : stdx::type_identity<StaticCast<RealPart<T>, RealPart<U>>> {};
+
+template <typename T, typename U>
+struct LaneOpImpl<ImplicitConversion<T, U>>
+    : stdx::type_identity<ImplicitConversion<RealPart<T>, RealPart<U>>> {};
+
+template <typename T, typename M>
+struct LaneOpImpl<MultiplyTypeBy<T, M>> : stdx::type_identity<MultiplyTypeBy<RealPart<T>, M>> {};
+
+template <typename T, typename M>
+struct LaneOpImpl<DivideTypeByInteger<T, M>>
+    : stdx::type_identity<DivideTypeByInteger<RealPart<T>, M>> {};
+
+#if defined(__SIZEOF_INT128__)
+template <typename T, typename M>
+struct LaneOpImpl<WideMultiplyDivide<T, M>>
+    : stdx::type_identity<WideMultiplyDivide<RealPart<T>, M>> {};
+#endif
+
+template <typename... Ops>
+struct LaneOpImpl<OpSequenceImpl<Ops...>> : stdx::type_identity<OpSequence<LaneOp<Ops>...>> {};
+
 }  // namespace detail
 }  // namespace au
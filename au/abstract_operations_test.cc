@@ -14,6 +14,9 @@
 
 #include "au/abstract_operations.hh"
 
+#include <cstdint>
+#include <limits>
+
 #include "au/testing.hh"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -91,6 +94,30 @@ TEST(DivideTypeByInteger, IntegerTypeCanBeDividedByIntegerMag) {
                 SameTypeAndValue(PromotedType<uint16_t>{5}));
 }
 
+TEST(DivideTypeByInteger, MatchesBuiltInDivisionIncludingNegativeAndExtremeValues) {
+    using Op = DivideTypeByInteger<int32_t, decltype(mag<254>())>;
+    volatile int32_t divisor = 254;
+
+    const int32_t values[] = {
+        std::numeric_limits<int32_t>::min(),
+        std::numeric_limits<int32_t>::min() + 1,
+        -255,
+        -254,
+        -253,
+        -1,
+        0,
+        1,
+        253,
+        254,
+        255,
+        std::numeric_limits<int32_t>::max() - 1,
+        std::numeric_limits<int32_t>::max(),
+    };
+    for (const auto x : values) {
+        EXPECT_THAT(Op::apply_to(x), SameTypeAndValue(x / divisor)) << "x = " << x;
+    }
+}
+
 TEST(DivideTypeByInteger, IntegerTypeDividedByIntegerTooBigToRepresentGivesZero) {
     EXPECT_THAT((DivideTypeByInteger<uint8_t, decltype(mag<256>())>::apply_to(uint8_t{1})),
                 SameTypeAndValue(PromotedType<uint8_t>{0}));
@@ -109,6 +136,62 @@ TEST(DivideTypeByInteger, FloatingPointTypeDividedByNumberTooBigToRepresentGives
                 SameTypeAndValue(0.0f));
 }
 
+#if defined(__SIZEOF_INT128__)
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `WideMultiplyDivide` section:
+
+TEST(WideMultiplyDivide, InputAndOutputTypesAreTypeParameter) {
+    StaticAssertTypeEq<OpInput<WideMultiplyDivide<int64_t, decltype(mag<3>() / mag<4>())>>,
+                       int64_t>();
+    StaticAssertTypeEq<OpOutput<WideMultiplyDivide<int16_t, decltype(mag<3>() / mag<4>())>>,
+                       int16_t>();
+}
+
+TEST(WideMultiplyDivide, GivesExactResultWhereNarrowProductWouldOverflow) {
+    using Op = WideMultiplyDivide<int64_t, decltype(mag<100'000>() / mag<9>())>;
+
+    // The product with the numerator overflows `int64_t` for these inputs, but the result fits.
+    EXPECT_THAT(Op::apply_to(int64_t{830'103'483'316'929}),
+                SameTypeAndValue(int64_t{9'223'372'036'854'766'666}));
+    EXPECT_THAT(Op::apply_to(int64_t{-830'103'483'316'929}),
+                SameTypeAndValue(int64_t{-9'223'372'036'854'766'666}));
+}
+
+TEST(WideMultiplyDivide, MatchesNarrowMultiplyThenDivideWhereThatDoesNotOverflow) {
+    using Op = WideMultiplyDivide<int64_t, decltype(mag<127>() / mag<5>())>;
+    constexpr int64_t LIMIT = std::numeric_limits<int64_t>::max() / 127;
+
+    const int64_t values[] = {
+        -LIMIT - 1, -LIMIT, -LIMIT + 1, -6, -5, -4, -1, 0, 1, 4, 5, 6, LIMIT - 1, LIMIT};
+    for (const auto x : values) {
+        const auto expected = static_cast<int64_t>(static_cast<__int128_t>(x) * 127 / 5);
+        EXPECT_THAT(Op::apply_to(x), SameTypeAndValue(expected)) << "x = " << x;
+        if (x >= -LIMIT) {
+            EXPECT_THAT(Op::apply_to(x), SameTypeAndValue(x * 127 / 5)) << "x = " << x;
+        }
+    }
+}
+
+TEST(WideMultiplyDivide, HandlesNegativeFactors) {
+    using Op = WideMultiplyDivide<int64_t, decltype(-mag<100'000>() / mag<9>())>;
+    EXPECT_THAT(Op::apply_to(int64_t{17}), SameTypeAndValue(int64_t{-188'888}));
+    EXPECT_THAT(Op::apply_to(int64_t{-830'103'483'316'929}),
+                SameTypeAndValue(int64_t{9'223'372'036'854'766'666}));
+}
+
+TEST(WideMultiplyDivide, HandlesNumeratorTooBigForType) {
+    using Op = WideMultiplyDivide<int8_t, decltype(mag<200>() / mag<3>())>;
+    EXPECT_THAT(Op::apply_to(int8_t{1}), SameTypeAndValue(int8_t{66}));
+    EXPECT_THAT(Op::apply_to(int8_t{-1}), SameTypeAndValue(int8_t{-66}));
+}
+
+TEST(WideMultiplyDivide, HandlesFullRangeOfUnsignedTypes) {
+    using Op = WideMultiplyDivide<uint64_t, decltype(mag<1000>() / mag<7>())>;
+    EXPECT_THAT(Op::apply_to(uint64_t{129'127'208'515'966'861u}),
+                SameTypeAndValue(uint64_t{18'446'744'073'709'551'571u}));
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // `OpSequence` section:
 
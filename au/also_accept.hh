@@ -0,0 +1,32 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "au/unit_of_measure.hh"
+
+namespace au {
+
+// A list of units which a reader (such as `from_chars()` or `from_wire()`) should accept, in
+// addition to the destination unit.  Values in these units get converted to the destination unit.
+template <typename... Units>
+struct AlsoAccept {};
+
+// Make an `AlsoAccept` list from any unit slots (e.g., `also_accept(kilo(meters), feet)`).
+template <typename... UnitSlots>
+constexpr AlsoAccept<AssociatedUnit<UnitSlots>...> also_accept(UnitSlots...) {
+    return {};
+}
+
+}  // namespace au
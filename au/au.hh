@@ -18,3 +18,4 @@
 #include "au/constant.hh"
 #include "au/math.hh"
 #include "au/prefix.hh"
+#include "au/unit_id.hh"
@@ -0,0 +1,353 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "au/abstract_operations.hh"
+#include "au/config.hh"
+#include "au/conversion_policy.hh"
+#include "au/conversion_strategy.hh"
+#include "au/overflow_boundary.hh"
+#include "au/quantity.hh"
+#include "au/truncation_risk.hh"
+#include "au/unit_of_measure.hh"
+
+// Batch conversions for contiguous ranges of quantities.
+//
+// Converting one quantity at a time with `.in()` or `.as()` is already zero-overhead, but it leaves
+// the compiler to prove that every iteration of a user's loop does the same thing.  The utilities
+// here resolve the conversion operation (and check its risks) exactly once, at compile time, and
+// then run a tight loop over the raw values.  That loop has no branches and no calls, so optimizers
+// can vectorize it just as they would a hand-written loop over `double*`.
+//
+// We also provide batch versions of the runtime conversion checkers (`is_conversion_lossy()`, and
+// friends).  These are written as branch-free reductions, so that checking a whole array costs
+// about as much as converting it.
+//
+// The ranges are given as pointer pairs, in the style of `std::transform`.  (We can't use
+// `std::span`, because Au supports C++14.)  The source and destination ranges must not partially
+// overlap.
+
+namespace au {
+
+namespace detail {
+
+// The conversion operation for converting `Quantity<U, R>` into `Quantity<TargetU, TargetR>`.
+template <typename U, typename R, typename TargetU, typename TargetR>
+using BatchConversionOp =
+    ConversionForRepsAndFactor<UseStaticCast, R, TargetR, UnitRatio<U, TargetU>>;
+
+// Branch-free check of whether converting a single value with `Op` would lose information, in any
+// of the ways that `RiskPolicyT` asks us to check.
+//
+// We combine the individual checks with the non-short-circuiting `|`, so that the compiler can
+// evaluate all of them unconditionally (and therefore, vectorize loops that use them).
+template <typename Op, typename RiskPolicyT>
+struct LossyValueChecker {
+    static constexpr bool should_check_overflow =
+        RiskPolicyT{}.should_check(ConversionRisk::Overflow);
+    static constexpr bool should_check_truncation =
+        RiskPolicyT{}.should_check(ConversionRisk::Truncation);
+
+    static AU_DEVICE_FUNC constexpr bool would_overflow(const OpInput<Op> &x) {
+        return should_check_overflow &&
+               (MinValueChecker<Op>::is_too_small(x) | MaxValueChecker<Op>::is_too_large(x));
+    }
+
+    static AU_DEVICE_FUNC constexpr bool would_truncate(const OpInput<Op> &x) {
+        return should_check_truncation && TruncationRiskFor<Op>::would_value_truncate(x);
+    }
+
+    static AU_DEVICE_FUNC constexpr bool is_lossy(const OpInput<Op> &x) {
+        return would_overflow(x) | would_truncate(x);
+    }
+};
+
+// Check whether _any_ value in `[first, last)` would be lossy to convert.
+//
+// For arithmetic types, the overflow check is a min/max reduction: the range has an overflowing
+// value if and only if its smallest value is too small, or its largest value is too large.  (A NaN
+// never overflows, so the reduction skips NaN: otherwise, a NaN bound would hide every other
+// value.)  Other types need not be totally ordered, so for them, we simply combine the elementwise
+// results.
+template <typename Op,
+          typename RiskPolicyT,
+          bool UseMinMaxReduction = std::is_arithmetic<OpInput<Op>>::value>
+struct AnyLossyValue {
+    template <typename U, typename R>
+    static AU_DEVICE_FUNC constexpr bool in(const Quantity<U, R> *first,
+                                            const Quantity<U, R> *last) {
+        bool any_lossy = false;
+        for (; first != last; ++first) {
+            any_lossy |= LossyValueChecker<Op, RiskPolicyT>::is_lossy(first->data_in(U{}));
+        }
+        return any_lossy;
+    }
+};
+template <typename Op, typename RiskPolicyT>
+struct AnyLossyValue<Op, RiskPolicyT, true> {
+    using Checker = LossyValueChecker<Op, RiskPolicyT>;
+
+    template <typename U, typename R>
+    static AU_DEVICE_FUNC constexpr bool in(const Quantity<U, R> *first,
+                                            const Quantity<U, R> *last) {
+        if (first == last) {
+            return false;
+        }
+
+        R lo = first->data_in(U{});
+        R hi = lo;
+        bool any_truncate = false;
+        for (; first != last; ++first) {
+            const R x = first->data_in(U{});
+
+            // `lo != lo` only if `lo` is NaN, which happens only if the first value was NaN.
+            lo = (x < lo || lo != lo) ? x : lo;
+            hi = (hi < x || hi != hi) ? x : hi;
+            any_truncate |= Checker::would_truncate(x);
+        }
+        return Checker::would_overflow(lo) | Checker::would_overflow(hi) | any_truncate;
+    }
+};
+
+// The number of values to check unconditionally at a time.  Blocks with a compile time constant
+// size are much easier for optimizers to vectorize, and they let us stop early once we've found a
+// lossy value.
+constexpr std::size_t LOSSY_SEARCH_BLOCK_SIZE = 64u;
+
+template <typename Op, typename RiskPolicyT, typename U, typename R>
+AU_DEVICE_FUNC constexpr const Quantity<U, R> *find_first_lossy(const Quantity<U, R> *first,
+                                                                const Quantity<U, R> *last) {
+    // Scan whole blocks with a branch-free reduction, and only fall back to the element-by-element
+    // search once we know that a block contains a lossy value.
+    while (static_cast<std::size_t>(last - first) >= LOSSY_SEARCH_BLOCK_SIZE) {
+        const auto block_end = first + LOSSY_SEARCH_BLOCK_SIZE;
+        if (AnyLossyValue<Op, RiskPolicyT>::in(first, block_end)) {
+            break;
+        }
+        first = block_end;
+    }
+
+    for (; first != last; ++first) {
+        if (LossyValueChecker<Op, RiskPolicyT>::is_lossy(first->data_in(U{}))) {
+            return first;
+        }
+    }
+    return last;
+}
+
+template <typename Op, typename RiskPolicyT, typename U, typename R>
+AU_DEVICE_FUNC constexpr std::size_t count_lossy_in_block(const Quantity<U, R> *first,
+                                                          std::size_t n) {
+    std::size_t count = 0u;
+    for (std::size_t i = 0u; i < n; ++i) {
+        count += LossyValueChecker<Op, RiskPolicyT>::is_lossy(first[i].data_in(U{})) ? 1u : 0u;
+    }
+    return count;
+}
+
+template <typename Op, typename RiskPolicyT, typename U, typename R>
+AU_DEVICE_FUNC constexpr std::size_t count_lossy(const Quantity<U, R> *first,
+                                                 const Quantity<U, R> *last) {
+    // Counting in fixed-size blocks gives the inner loop a constant trip count, which makes it
+    // easier for the optimizer to decide to vectorize it.
+    std::size_t count = 0u;
+    while (static_cast<std::size_t>(last - first) >= LOSSY_SEARCH_BLOCK_SIZE) {
+        count += count_lossy_in_block<Op, RiskPolicyT>(first, LOSSY_SEARCH_BLOCK_SIZE);
+        first += LOSSY_SEARCH_BLOCK_SIZE;
+    }
+    return count +
+           count_lossy_in_block<Op, RiskPolicyT>(first, static_cast<std::size_t>(last - first));
+}
+
+template <typename Op, typename RiskPolicyT, typename U, typename R>
+AU_DEVICE_FUNC constexpr bool *mark_lossy(const Quantity<U, R> *first,
+                                          const Quantity<U, R> *last,
+                                          bool *d_first) {
+    for (; first != last; ++first, ++d_first) {
+        *d_first = LossyValueChecker<Op, RiskPolicyT>::is_lossy(first->data_in(U{}));
+    }
+    return d_first;
+}
+
+}  // namespace detail
+
+// Convert every quantity in `[first, last)` to the unit and rep of the destination range, which
+// begins at `d_first`.
+//
+// Uses the same risk checks as `.as()`, controlled by the (optional) risk policy.  This includes
+// `saturate`, and the policies made by `check_at_runtime()`, which act on each value in turn.
+// Returns one past the last element written, just like `std::transform`.
+template <typename U,
+          typename R,
+          typename TargetU,
+          typename TargetR,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
+          std::enable_if_t<detail::IsAnyConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
+AU_DEVICE_FUNC constexpr Quantity<TargetU, TargetR> *convert(const Quantity<U, R> *first,
+                                                             const Quantity<U, R> *last,
+                                                             Quantity<TargetU, TargetR> *d_first,
+                                                             RiskPolicyT policy = RiskPolicyT{}) {
+    static_assert(HasSameDimension<U, TargetU>::value, "Can only convert same-dimension units");
+    detail::assert_conversion_risk_acceptable<detail::UseStaticCast,
+                                              R,
+                                              TargetR,
+                                              UnitRatio<U, TargetU>,
+                                              detail::CompileTimeRiskPolicy<RiskPolicyT>>();
+
+    using Op = detail::BatchConversionOp<U, R, TargetU, TargetR>;
+    for (; first != last; ++first, ++d_first) {
+        d_first->data_in(TargetU{}) =
+            detail::apply_with_risk_policy<Op>(first->data_in(U{}), policy);
+    }
+    return d_first;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Batch runtime conversion checkers
+//
+// Each of these comes in two forms, just like `is_conversion_lossy()`: one for the implicit rep,
+// and one with an explicit target rep (`is_any_conversion_lossy<int32_t>(first, last, unit)`).
+//
+// The (optional) risk policy chooses which kinds of lossiness to check for.  By default, we check
+// for both overflow and truncation.
+
+// Check whether converting any element of `[first, last)` would be lossy (implicit rep).
+template <typename U,
+          typename R,
+          typename TargetUnitSlot,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
+          std::enable_if_t<IsConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
+AU_DEVICE_FUNC constexpr bool is_any_conversion_lossy(const Quantity<U, R> *first,
+                                                      const Quantity<U, R> *last,
+                                                      TargetUnitSlot,
+                                                      RiskPolicyT = RiskPolicyT{}) {
+    using Op = detail::BatchConversionOp<U, R, AssociatedUnit<TargetUnitSlot>, void>;
+    return detail::find_first_lossy<Op, RiskPolicyT>(first, last) != last;
+}
+
+// Check whether converting any element of `[first, last)` would be lossy (explicit rep).
+template <typename TargetRep,
+          typename U,
+          typename R,
+          typename TargetUnitSlot,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
+          std::enable_if_t<IsConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
+AU_DEVICE_FUNC constexpr bool is_any_conversion_lossy(const Quantity<U, R> *first,
+                                                      const Quantity<U, R> *last,
+                                                      TargetUnitSlot,
+                                                      RiskPolicyT = RiskPolicyT{}) {
+    using Op = detail::BatchConversionOp<U, R, AssociatedUnit<TargetUnitSlot>, TargetRep>;
+    return detail::find_first_lossy<Op, RiskPolicyT>(first, last) != last;
+}
+
+// Find the first element of `[first, last)` whose conversion would be lossy, or `last` if there is
+// none (implicit rep).
+template <typename U,
+          typename R,
+          typename TargetUnitSlot,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
+          std::enable_if_t<IsConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
+AU_DEVICE_FUNC constexpr const Quantity<U, R> *find_first_lossy_conversion(
+    const Quantity<U, R> *first,
+    const Quantity<U, R> *last,
+    TargetUnitSlot,
+    RiskPolicyT = RiskPolicyT{}) {
+    using Op = detail::BatchConversionOp<U, R, AssociatedUnit<TargetUnitSlot>, void>;
+    return detail::find_first_lossy<Op, RiskPolicyT>(first, last);
+}
+
+// Find the first element of `[first, last)` whose conversion would be lossy, or `last` if there is
+// none (explicit rep).
+template <typename TargetRep,
+          typename U,
+          typename R,
+          typename TargetUnitSlot,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
+          std::enable_if_t<IsConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
+AU_DEVICE_FUNC constexpr const Quantity<U, R> *find_first_lossy_conversion(
+    const Quantity<U, R> *first,
+    const Quantity<U, R> *last,
+    TargetUnitSlot,
+    RiskPolicyT = RiskPolicyT{}) {
+    using Op = detail::BatchConversionOp<U, R, AssociatedUnit<TargetUnitSlot>, TargetRep>;
+    return detail::find_first_lossy<Op, RiskPolicyT>(first, last);
+}
+
+// Count the elements of `[first, last)` whose conversion would be lossy (implicit rep).
+template <typename U,
+          typename R,
+          typename TargetUnitSlot,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
+          std::enable_if_t<IsConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
+AU_DEVICE_FUNC constexpr std::size_t count_lossy_conversions(const Quantity<U, R> *first,
+                                                             const Quantity<U, R> *last,
+                                                             TargetUnitSlot,
+                                                             RiskPolicyT = RiskPolicyT{}) {
+    using Op = detail::BatchConversionOp<U, R, AssociatedUnit<TargetUnitSlot>, void>;
+    return detail::count_lossy<Op, RiskPolicyT>(first, last);
+}
+
+// Count the elements of `[first, last)` whose conversion would be lossy (explicit rep).
+template <typename TargetRep,
+          typename U,
+          typename R,
+          typename TargetUnitSlot,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
+          std::enable_if_t<IsConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
+AU_DEVICE_FUNC constexpr std::size_t count_lossy_conversions(const Quantity<U, R> *first,
+                                                             const Quantity<U, R> *last,
+                                                             TargetUnitSlot,
+                                                             RiskPolicyT = RiskPolicyT{}) {
+    using Op = detail::BatchConversionOp<U, R, AssociatedUnit<TargetUnitSlot>, TargetRep>;
+    return detail::count_lossy<Op, RiskPolicyT>(first, last);
+}
+
+// For each element of `[first, last)`, write whether its conversion would be lossy to the output
+// mask beginning at `d_first`.  Returns one past the last flag written (implicit rep).
+template <typename U,
+          typename R,
+          typename TargetUnitSlot,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
+          std::enable_if_t<IsConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
+AU_DEVICE_FUNC constexpr bool *mark_lossy_conversions(const Quantity<U, R> *first,
+                                                      const Quantity<U, R> *last,
+                                                      TargetUnitSlot,
+                                                      bool *d_first,
+                                                      RiskPolicyT = RiskPolicyT{}) {
+    using Op = detail::BatchConversionOp<U, R, AssociatedUnit<TargetUnitSlot>, void>;
+    return detail::mark_lossy<Op, RiskPolicyT>(first, last, d_first);
+}
+
+// For each element of `[first, last)`, write whether its conversion would be lossy to the output
+// mask beginning at `d_first`.  Returns one past the last flag written (explicit rep).
+template <typename TargetRep,
+          typename U,
+          typename R,
+          typename TargetUnitSlot,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
+          std::enable_if_t<IsConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
+AU_DEVICE_FUNC constexpr bool *mark_lossy_conversions(const Quantity<U, R> *first,
+                                                      const Quantity<U, R> *last,
+                                                      TargetUnitSlot,
+                                                      bool *d_first,
+                                                      RiskPolicyT = RiskPolicyT{}) {
+    using Op = detail::BatchConversionOp<U, R, AssociatedUnit<TargetUnitSlot>, TargetRep>;
+    return detail::mark_lossy<Op, RiskPolicyT>(first, last, d_first);
+}
+
+}  // namespace au
@@ -0,0 +1,324 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/batch.hh"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace au {
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::IsFalse;
+using ::testing::IsTrue;
+
+struct Inches : UnitImpl<Length> {};
+constexpr auto inches = QuantityMaker<Inches>{};
+
+struct Feet : decltype(Inches{} * mag<12>()) {};
+constexpr auto feet = QuantityMaker<Feet>{};
+
+struct Meters : decltype(Inches{} * mag<10'000>() / mag<254>()) {};
+constexpr auto meters = QuantityMaker<Meters>{};
+
+constexpr Quantity<Inches, int> sum_of_feet_converted_to_inches(Quantity<Feet, int> a,
+                                                                Quantity<Feet, int> b) {
+    const Quantity<Feet, int> src[] = {a, b};
+    Quantity<Inches, int> dst[2] = {};
+    convert(src, src + 2, dst);
+    return dst[0] + dst[1];
+}
+
+// Every possible `int8_t` value, in feet.
+std::vector<Quantity<Feet, int8_t>> all_int8_feet() {
+    std::vector<Quantity<Feet, int8_t>> result;
+    for (int i = std::numeric_limits<int8_t>::min(); i <= std::numeric_limits<int8_t>::max(); ++i) {
+        result.push_back(feet(static_cast<int8_t>(i)));
+    }
+    return result;
+}
+
+// Every possible `int8_t` value, in inches.
+std::vector<Quantity<Inches, int8_t>> all_int8_inches() {
+    std::vector<Quantity<Inches, int8_t>> result;
+    for (int i = std::numeric_limits<int8_t>::min(); i <= std::numeric_limits<int8_t>::max(); ++i) {
+        result.push_back(inches(static_cast<int8_t>(i)));
+    }
+    return result;
+}
+
+TEST(Convert, ConvertsEveryElementToTargetUnitAndRep) {
+    const std::array<Quantity<Feet, int>, 3> src = {feet(1), feet(2), feet(-3)};
+    std::array<Quantity<Inches, double>, 3> dst{};
+
+    convert(src.data(), src.data() + src.size(), dst.data());
+
+    EXPECT_THAT(dst,
+                ElementsAre(SameTypeAndValue(inches(12.0)),
+                            SameTypeAndValue(inches(24.0)),
+                            SameTypeAndValue(inches(-36.0))));
+}
+
+TEST(Convert, ReturnsOnePastLastElementWritten) {
+    const std::array<Quantity<Feet, int>, 2> src = {feet(1), feet(2)};
+    std::array<Quantity<Inches, int>, 4> dst{};
+
+    const auto end = convert(src.data(), src.data() + src.size(), dst.data());
+
+    EXPECT_THAT(end, Eq(dst.data() + 2));
+    EXPECT_THAT(dst[2u], Eq(ZERO));
+}
+
+TEST(Convert, EmptyRangeWritesNothing) {
+    const std::vector<Quantity<Feet, double>> src;
+    std::array<Quantity<Inches, double>, 1> dst = {inches(5.0)};
+
+    const auto end = convert(src.data(), src.data(), dst.data());
+
+    EXPECT_THAT(end, Eq(dst.data()));
+    EXPECT_THAT(dst[0u], SameTypeAndValue(inches(5.0)));
+}
+
+TEST(Convert, MatchesElementwiseAsForNontrivialRationalFactor) {
+    const std::array<Quantity<Meters, double>, 4> src = {
+        meters(0.0), meters(1.0), meters(-2.5), meters(123.456)};
+    std::array<Quantity<Inches, double>, 4> dst{};
+
+    convert(src.data(), src.data() + src.size(), dst.data());
+
+    for (auto i = 0u; i < src.size(); ++i) {
+        EXPECT_THAT(dst[i], SameTypeAndValue(src[i].as(inches)));
+    }
+}
+
+TEST(Convert, AcceptsRiskPolicy) {
+    const std::array<Quantity<Inches, int>, 3> src = {inches(12), inches(18), inches(-30)};
+    std::array<Quantity<Feet, int>, 3> dst{};
+
+    convert(src.data(), src.data() + src.size(), dst.data(), ignore(TRUNCATION_RISK));
+
+    EXPECT_THAT(dst,
+                ElementsAre(SameTypeAndValue(feet(1)),
+                            SameTypeAndValue(feet(1)),
+                            SameTypeAndValue(feet(-2))));
+}
+
+TEST(Convert, SaturatePolicyClampsEachOverflowingValue) {
+    const std::array<Quantity<Feet, int>, 4> src = {feet(1), feet(-11), feet(10), feet(11)};
+    std::array<Quantity<Inches, int8_t>, 4> dst{};
+
+    convert(src.data(), src.data() + src.size(), dst.data(), saturate);
+
+    EXPECT_THAT(dst,
+                ElementsAre(SameTypeAndValue(inches(int8_t{12})),
+                            SameTypeAndValue(inches(int8_t{-128})),
+                            SameTypeAndValue(inches(int8_t{120})),
+                            SameTypeAndValue(inches(int8_t{127}))));
+}
+
+TEST(Convert, RuntimeCheckedPolicyChecksEachValue) {
+    const std::array<Quantity<Feet, int>, 3> src = {feet(1), feet(11), feet(-11)};
+    std::array<Quantity<Inches, int8_t>, 3> dst{};
+
+    int failures = 0;
+    convert(src.data(),
+            src.data() + src.size(),
+            dst.data(),
+            check_at_runtime(OVERFLOW_RISK, [&failures](ConversionFailure) { ++failures; }));
+
+    EXPECT_THAT(failures, Eq(2));
+    EXPECT_THAT(dst[0], SameTypeAndValue(inches(int8_t{12})));
+}
+
+TEST(Convert, HandlesChangeOfRepWithinSameUnit) {
+    const std::array<Quantity<Inches, int32_t>, 2> src = {inches(int32_t{7}), inches(int32_t{-8})};
+    std::array<Quantity<Inches, int64_t>, 2> dst{};
+
+    convert(src.data(), src.data() + src.size(), dst.data());
+
+    EXPECT_THAT(dst,
+                ElementsAre(SameTypeAndValue(inches(int64_t{7})),
+                            SameTypeAndValue(inches(int64_t{-8}))));
+}
+
+TEST(Convert, SupportsInPlaceConversionForSameType) {
+    std::array<Quantity<Inches, double>, 2> data = {inches(1.5), inches(2.5)};
+
+    convert(data.data(), data.data() + data.size(), data.data());
+
+    EXPECT_THAT(data, ElementsAre(SameTypeAndValue(inches(1.5)), SameTypeAndValue(inches(2.5))));
+}
+
+TEST(Convert, IsConstexprCompatible) {
+    constexpr auto result = sum_of_feet_converted_to_inches(feet(2), feet(3));
+    EXPECT_THAT(result, SameTypeAndValue(inches(60)));
+}
+
+TEST(IsAnyConversionLossy, FalseForEmptyRange) {
+    const std::vector<Quantity<Feet, int8_t>> src;
+    EXPECT_THAT(is_any_conversion_lossy(src.data(), src.data(), inches), IsFalse());
+}
+
+TEST(IsAnyConversionLossy, FalseWhenEveryValueConvertsExactly) {
+    const std::array<Quantity<Feet, int8_t>, 3> src = {
+        feet(int8_t{-10}), feet(int8_t{0}), feet(int8_t{10})};
+    EXPECT_THAT(is_any_conversion_lossy(src.data(), src.data() + src.size(), inches), IsFalse());
+}
+
+TEST(IsAnyConversionLossy, TrueWhenAnyValueOverflows) {
+    const std::array<Quantity<Feet, int8_t>, 3> src = {
+        feet(int8_t{1}), feet(int8_t{11}), feet(int8_t{2})};
+    EXPECT_THAT(is_any_conversion_lossy<int8_t>(src.data(), src.data() + src.size(), inches),
+                IsTrue());
+}
+
+TEST(IsAnyConversionLossy, TrueWhenAnyValueOverflowsBelow) {
+    const std::array<Quantity<Feet, int8_t>, 3> src = {
+        feet(int8_t{1}), feet(int8_t{-11}), feet(int8_t{2})};
+    EXPECT_THAT(is_any_conversion_lossy<int8_t>(src.data(), src.data() + src.size(), inches),
+                IsTrue());
+}
+
+TEST(IsAnyConversionLossy, TrueWhenAnyValueTruncates) {
+    const std::array<Quantity<Inches, int>, 3> src = {inches(12), inches(13), inches(24)};
+    EXPECT_THAT(is_any_conversion_lossy(src.data(), src.data() + src.size(), feet), IsTrue());
+}
+
+TEST(IsAnyConversionLossy, OnlyChecksRisksInPolicy) {
+    const std::array<Quantity<Feet, int8_t>, 1> overflows = {feet(int8_t{11})};
+    EXPECT_THAT(is_any_conversion_lossy<int8_t>(overflows.data(),
+                                                overflows.data() + overflows.size(),
+                                                inches,
+                                                check_for(TRUNCATION_RISK)),
+                IsFalse());
+
+    const std::array<Quantity<Inches, int>, 1> truncates = {inches(13)};
+    EXPECT_THAT(is_any_conversion_lossy(truncates.data(),
+                                        truncates.data() + truncates.size(),
+                                        feet,
+                                        check_for(OVERFLOW_RISK)),
+                IsFalse());
+}
+
+TEST(IsAnyConversionLossy, SupportsExplicitRep) {
+    const std::array<Quantity<Feet, int>, 2> src = {feet(1), feet(11)};
+    EXPECT_THAT(is_any_conversion_lossy(src.data(), src.data() + src.size(), inches), IsFalse());
+    EXPECT_THAT(is_any_conversion_lossy<int8_t>(src.data(), src.data() + src.size(), inches),
+                IsTrue());
+}
+
+TEST(IsAnyConversionLossy, HandlesFloatingPointOverflow) {
+    const std::array<Quantity<Feet, double>, 2> src = {feet(1.0), feet(1e300)};
+    EXPECT_THAT(is_any_conversion_lossy<float>(src.data(), src.data() + src.size(), inches),
+                IsTrue());
+}
+
+TEST(IsAnyConversionLossy, LeadingNaNDoesNotHideOverflow) {
+    std::vector<Quantity<Feet, double>> src(64u, feet(1.0));
+    src[0u] = feet(std::numeric_limits<double>::quiet_NaN());
+    src[5u] = feet(1e300);
+    const auto first = src.data();
+    const auto last = first + src.size();
+
+    EXPECT_THAT(is_any_conversion_lossy<float>(first, last, inches), IsTrue());
+    EXPECT_THAT(find_first_lossy_conversion<float>(first, last, inches), Eq(first + 5));
+    EXPECT_THAT(count_lossy_conversions<float>(first, last, inches), Eq(1u));
+}
+
+TEST(IsAnyConversionLossy, AgreesWithScalarCheckForEverySingleValue) {
+    for (const auto &q : all_int8_feet()) {
+        EXPECT_THAT(is_any_conversion_lossy<int8_t>(&q, &q + 1, inches),
+                    Eq(is_conversion_lossy<int8_t>(q, inches)))
+            << q;
+    }
+    for (const auto &q : all_int8_inches()) {
+        EXPECT_THAT(is_any_conversion_lossy(&q, &q + 1, feet), Eq(is_conversion_lossy(q, feet)))
+            << q;
+    }
+}
+
+TEST(FindFirstLossyConversion, ReturnsLastIfNoConversionIsLossy) {
+    const std::vector<Quantity<Feet, int>> src(200u, feet(3));
+    const auto last = src.data() + src.size();
+    EXPECT_THAT(find_first_lossy_conversion<int8_t>(src.data(), last, inches), Eq(last));
+}
+
+TEST(FindFirstLossyConversion, FindsFirstLossyValueEvenPastFirstBlock) {
+    std::vector<Quantity<Feet, int>> src(200u, feet(3));
+    src[150u] = feet(20);
+    src[130u] = feet(-20);
+    src[170u] = feet(20);
+    const auto first = src.data();
+    EXPECT_THAT(find_first_lossy_conversion<int8_t>(first, first + src.size(), inches),
+                Eq(first + 130));
+}
+
+TEST(FindFirstLossyConversion, FindsLossyValueInFinalPartialBlock) {
+    std::vector<Quantity<Inches, int>> src(100u, inches(36));
+    src[99u] = inches(37);
+    const auto first = src.data();
+    EXPECT_THAT(find_first_lossy_conversion(first, first + src.size(), feet), Eq(first + 99));
+}
+
+TEST(CountLossyConversions, CountsEveryLossyValue) {
+    const auto src = all_int8_inches();
+    const auto first = src.data();
+    const auto last = first + src.size();
+
+    // Only multiples of 12 convert to feet without truncation.
+    const std::size_t num_multiples_of_12 = 21u;
+    EXPECT_THAT(count_lossy_conversions(first, last, feet), Eq(src.size() - num_multiples_of_12));
+    EXPECT_THAT(count_lossy_conversions(first, last, feet, check_for(OVERFLOW_RISK)), Eq(0u));
+}
+
+TEST(CountLossyConversions, AgreesWithScalarCheck) {
+    const auto src = all_int8_feet();
+    std::size_t expected = 0u;
+    for (const auto &q : src) {
+        expected += is_conversion_lossy<int8_t>(q, inches) ? 1u : 0u;
+    }
+    EXPECT_THAT(count_lossy_conversions<int8_t>(src.data(), src.data() + src.size(), inches),
+                Eq(expected));
+}
+
+TEST(MarkLossyConversions, WritesOneFlagPerElement) {
+    const std::array<Quantity<Inches, int>, 4> src = {inches(12), inches(13), inches(0), inches(1)};
+    std::array<bool, 4> mask{};
+
+    const auto end =
+        mark_lossy_conversions(src.data(), src.data() + src.size(), feet, mask.data());
+
+    EXPECT_THAT(end, Eq(mask.data() + mask.size()));
+    EXPECT_THAT(mask, ElementsAre(false, true, false, true));
+}
+
+TEST(MarkLossyConversions, SupportsExplicitRepAndPolicy) {
+    const std::array<Quantity<Inches, int>, 3> src = {inches(13), inches(2'400), inches(0)};
+    std::array<bool, 3> mask{};
+
+    mark_lossy_conversions<int8_t>(
+        src.data(), src.data() + src.size(), feet, mask.data(), check_for(OVERFLOW_RISK));
+
+    EXPECT_THAT(mask, ElementsAre(false, true, false));
+}
+
+}  // namespace au
@@ -0,0 +1,198 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/batch.hh"
+#include "au/units/inches.hh"
+#include "au/units/meters.hh"
+#include "benchmark/benchmark.h"
+
+namespace au {
+namespace {
+
+constexpr double INCHES_PER_MILLIMETER = 10.0 / 254.0;
+
+std::vector<double> make_raw_values(std::size_t n) {
+    std::vector<double> values(n);
+    for (auto i = 0u; i < n; ++i) {
+        values[i] = 0.25 * static_cast<double>(i);
+    }
+    return values;
+}
+
+std::vector<Quantity<Milli<Meters>, double>> make_quantities(std::size_t n) {
+    std::vector<Quantity<Milli<Meters>, double>> values;
+    values.reserve(n);
+    for (const auto x : make_raw_values(n)) {
+        values.push_back(milli(meters)(x));
+    }
+    return values;
+}
+
+// Baseline: a hand-written loop over raw `double` values.
+void BM_RawDoubleLoop(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto src = make_raw_values(n);
+    std::vector<double> dst(n);
+
+    for (auto _ : state) {
+        const double *in = src.data();
+        double *out = dst.data();
+        for (std::size_t i = 0u; i < n; ++i) {
+            out[i] = in[i] * INCHES_PER_MILLIMETER;
+        }
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_RawDoubleLoop)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+// A user-written loop which converts one element at a time.
+void BM_ElementwiseAs(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto src = make_quantities(n);
+    std::vector<Quantity<Inches, double>> dst(n);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < n; ++i) {
+            dst[i] = src[i].as(inches);
+        }
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_ElementwiseAs)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+// The batch conversion API.
+void BM_BatchConvert(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto src = make_quantities(n);
+    std::vector<Quantity<Inches, double>> dst(n);
+
+    for (auto _ : state) {
+        convert(src.data(), src.data() + n, dst.data());
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_BatchConvert)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+std::vector<Quantity<Milli<Meters>, int32_t>> make_integer_quantities(std::size_t n) {
+    std::vector<Quantity<Milli<Meters>, int32_t>> values;
+    values.reserve(n);
+    for (auto i = 0u; i < n; ++i) {
+        values.push_back(milli(meters)(static_cast<int32_t>(i % 2'000'000u) - 1'000'000));
+    }
+    return values;
+}
+
+// Baseline for the risk checks: a user-written loop calling the scalar checker on every element.
+void BM_ElementwiseIsConversionLossy(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto src = make_integer_quantities(n);
+
+    for (auto _ : state) {
+        bool any_lossy = false;
+        for (const auto &q : src) {
+            if (is_conversion_lossy(q, micro(meters))) {
+                any_lossy = true;
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(any_lossy);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_ElementwiseIsConversionLossy)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+void BM_IsAnyConversionLossy(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto src = make_integer_quantities(n);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            is_any_conversion_lossy(src.data(), src.data() + n, micro(meters)));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_IsAnyConversionLossy)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+void BM_FindFirstLossyConversion(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto src = make_integer_quantities(n);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            find_first_lossy_conversion(src.data(), src.data() + n, micro(meters)));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_FindFirstLossyConversion)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+void BM_CountLossyConversions(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto src = make_integer_quantities(n);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            count_lossy_conversions(src.data(), src.data() + n, micro(meters)));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_CountLossyConversions)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+// Saturating conversion of integers to a narrower rep: `int32_t` millimeters to `int16_t`
+// decimicrometers (that is, times 10'000), clamping values that don't fit.  Baseline: the usual
+// hand-written round trip through `double`.
+void BM_RawSaturateViaDoubleLoop(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto src = make_integer_quantities(n);
+    std::vector<int16_t> dst(n);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < n; ++i) {
+            const double x = static_cast<double>(src[i].in(milli(meters))) * 10'000.0;
+            dst[i] =
+                static_cast<int16_t>(x > 32'767.0 ? 32'767.0 : (x < -32'768.0 ? -32'768.0 : x));
+        }
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_RawSaturateViaDoubleLoop)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+void BM_BatchConvertSaturate(benchmark::State &state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto src = make_integer_quantities(n);
+    std::vector<Quantity<Deci<Micro<Meters>>, int16_t>> dst(n);
+
+    for (auto _ : state) {
+        convert(src.data(), src.data() + n, dst.data(), saturate);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+BENCHMARK(BM_BatchConvertSaturate)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+}  // namespace
+}  // namespace au
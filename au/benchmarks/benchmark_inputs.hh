@@ -0,0 +1,97 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+// Shared helpers for the Au benchmarks.
+//
+// Every benchmark in this package comes in (at least) a pair: one version using Au, and one using
+// raw numbers to do the same job.  Both members of a pair use the same inputs, the same number of
+// elements, and the same loop structure, so that the only difference is the Au abstraction itself.
+
+namespace au {
+namespace benchmarks {
+
+// The number of elements in the working set for most benchmarks.  Small enough to stay in L1 cache,
+// so that we measure the cost of the computation rather than memory bandwidth.
+constexpr std::size_t NUM_ELEMENTS = 1024u;
+
+// Deterministic floating point inputs, spread over a few orders of magnitude, with both signs.
+inline std::vector<double> make_doubles(std::size_t n = NUM_ELEMENTS) {
+    std::vector<double> values(n);
+    for (auto i = 0u; i < n; ++i) {
+        const double sign = (i % 2u == 0u) ? 1.0 : -1.0;
+        values[i] = sign * (0.125 * static_cast<double>(i) + 0.3 * static_cast<double>(i % 7u));
+    }
+    return values;
+}
+
+// Deterministic integer inputs, with both signs, small enough that no benchmarked conversion
+// overflows.
+inline std::vector<int32_t> make_int32s(std::size_t n = NUM_ELEMENTS) {
+    std::vector<int32_t> values(n);
+    for (auto i = 0u; i < n; ++i) {
+        const auto magnitude = static_cast<int32_t>((i * 7919u) % 100'000u);
+        values[i] = (i % 2u == 0u) ? magnitude : -magnitude;
+    }
+    return values;
+}
+
+// Deterministic `int64_t` inputs, with both signs, whose magnitudes are spread evenly up to (but
+// not including) `max_magnitude`.
+inline std::vector<int64_t> make_int64s(int64_t max_magnitude, std::size_t n = NUM_ELEMENTS) {
+    std::vector<int64_t> values(n);
+    const auto step = max_magnitude / static_cast<int64_t>(n);
+    for (auto i = 0u; i < n; ++i) {
+        // Visit the indices in a scrambled order, so that neighbouring values differ in size.
+        const auto magnitude = step * static_cast<int64_t>((i * 7919u) % n);
+        values[i] = (i % 2u == 0u) ? magnitude : -magnitude;
+    }
+    return values;
+}
+
+// Wrap each raw value in a `Quantity` (or `QuantityPoint`) using the given maker.
+template <typename Maker, typename T>
+auto make_all(Maker maker, const std::vector<T> &raw) {
+    std::vector<decltype(maker(raw.front()))> result;
+    result.reserve(raw.size());
+    for (const auto &x : raw) {
+        result.push_back(maker(x));
+    }
+    return result;
+}
+
+// Run `fn(i)` for every index in `[0, n)` on each benchmark iteration, then report throughput.
+//
+// `fn` should write its results to a buffer which the caller has already passed to
+// `benchmark::DoNotOptimize()`, so that the optimizer can't discard the work.
+template <typename Fn>
+void run_elementwise(benchmark::State &state, std::size_t n, Fn &&fn) {
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < n; ++i) {
+            fn(i);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+
+}  // namespace benchmarks
+}  // namespace au
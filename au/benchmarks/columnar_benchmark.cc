@@ -0,0 +1,118 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/benchmarks/benchmark_inputs.hh"
+#include "au/columnar.hh"
+#include "au/units/hours.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "benchmark/benchmark.h"
+
+// Benchmarks for reading columns from a columnar file (from `"au/columnar.hh"`), which is already
+// in memory (as if memory-mapped).  We compare against reading the same bytes as a raw `double*`.
+// A zero-copy span should cost exactly the same; a lazily converted view adds a load through a
+// function pointer and a multiplication per value.
+
+namespace au {
+namespace benchmarks {
+namespace {
+
+using Speed = Quantity<UnitQuotient<Meters, Seconds>, double>;
+
+// The bytes of a file with one column, "speed", holding `make_doubles()` in `unit`.
+template <typename UnitSlot>
+std::vector<uint64_t> make_file(UnitSlot) {
+    const auto values = make_quantity_vector<AssociatedUnit<UnitSlot>>(make_doubles());
+    ColumnarWriter writer;
+    writer.add_column("speed", values);
+
+    std::ostringstream out;
+    writer.write(out);
+    const std::string bytes = out.str();
+
+    // Store the bytes in `uint64_t`, so they're aligned as a memory-mapped file would be.
+    std::vector<uint64_t> file((bytes.size() + sizeof(uint64_t) - 1u) / sizeof(uint64_t));
+    std::memcpy(file.data(), bytes.data(), bytes.size());
+    return file;
+}
+
+ColumnView<UnitQuotient<Meters, Seconds>, double> open_speed_column(
+    const std::vector<uint64_t> &file) {
+    const auto reader = ColumnarReader::open(file.data(), file.size() * sizeof(uint64_t)).value;
+    return reader.column<double>("speed", meters / second).value;
+}
+
+void BM_Raw_ReadColumn(benchmark::State &state) {
+    const auto file = make_file(meters / second);
+    const auto reader = ColumnarReader::open(file.data(), file.size() * sizeof(uint64_t)).value;
+    const char *bytes = reinterpret_cast<const char *>(file.data());
+    const double *raw = reinterpret_cast<const double *>(bytes + reader.column_header(0u).offset);
+    std::vector<double> v(NUM_ELEMENTS);
+    benchmark::DoNotOptimize(v.data());
+    run_elementwise(state, v.size(), [&](std::size_t i) { v[i] = raw[i]; });
+}
+BENCHMARK(BM_Raw_ReadColumn);
+
+// Stored unit matches: read through the zero-copy span.
+void BM_Au_ReadColumnSpan(benchmark::State &state) {
+    const auto file = make_file(meters / second);
+    const auto span = open_speed_column(file).span();
+    std::vector<Speed> v(NUM_ELEMENTS);
+    benchmark::DoNotOptimize(v.data());
+    run_elementwise(state, v.size(), [&](std::size_t i) { v[i] = span[i]; });
+}
+BENCHMARK(BM_Au_ReadColumnSpan);
+
+// Stored unit matches, but we read through the view, which checks whether to convert each value.
+void BM_Au_ReadColumnView(benchmark::State &state) {
+    const auto file = make_file(meters / second);
+    const auto view = open_speed_column(file);
+    std::vector<Speed> v(NUM_ELEMENTS);
+    benchmark::DoNotOptimize(v.data());
+    run_elementwise(state, v.size(), [&](std::size_t i) { v[i] = view[i]; });
+}
+BENCHMARK(BM_Au_ReadColumnView);
+
+void BM_Raw_ReadColumnConverted(benchmark::State &state) {
+    const auto file = make_file(kilo(meters) / hour);
+    const auto reader = ColumnarReader::open(file.data(), file.size() * sizeof(uint64_t)).value;
+    const char *bytes = reinterpret_cast<const char *>(file.data());
+    const double *raw = reinterpret_cast<const double *>(bytes + reader.column_header(0u).offset);
+    const double factor = reader.column_header(0u).magnitude;
+    std::vector<double> v(NUM_ELEMENTS);
+    benchmark::DoNotOptimize(v.data());
+    run_elementwise(state, v.size(), [&](std::size_t i) { v[i] = raw[i] * factor; });
+}
+BENCHMARK(BM_Raw_ReadColumnConverted);
+
+// Stored unit differs: each value is converted on access.
+void BM_Au_ReadColumnConverted(benchmark::State &state) {
+    const auto file = make_file(kilo(meters) / hour);
+    const auto view = open_speed_column(file);
+    std::vector<Speed> v(NUM_ELEMENTS);
+    benchmark::DoNotOptimize(v.data());
+    run_elementwise(state, v.size(), [&](std::size_t i) { v[i] = view[i]; });
+}
+BENCHMARK(BM_Au_ReadColumnConverted);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace au
@@ -0,0 +1,239 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/benchmarks/benchmark_inputs.hh"
+#include "au/lazy_conversion.hh"
+#include "au/units/feet.hh"
+#include "au/units/inches.hh"
+#include "au/units/meters.hh"
+#include "benchmark/benchmark.h"
+
+// Benchmarks for `.in()`/`.as()` conversions, covering each application strategy for the conversion
+// factor: a single multiplication (floating point), a division by an integer (integral reps, where
+// the factor is the inverse of an integer), and a "nontrivial rational" factor (integral reps, where
+// we multiply by the numerator and divide by the denominator).
+
+namespace au {
+namespace benchmarks {
+namespace {
+
+//
+// Floating point: feet to meters (a single multiplication).
+//
+
+void BM_Raw_ConvertFloat(benchmark::State &state) {
+    const auto ft = make_doubles();
+    std::vector<double> m(ft.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(state, ft.size(), [&](std::size_t i) { m[i] = ft[i] * 0.3048; });
+}
+BENCHMARK(BM_Raw_ConvertFloat);
+
+void BM_Au_ConvertFloat(benchmark::State &state) {
+    const auto ft = make_all(feet, make_doubles());
+    std::vector<double> m(ft.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(state, ft.size(), [&](std::size_t i) { m[i] = ft[i].in(meters); });
+}
+BENCHMARK(BM_Au_ConvertFloat);
+
+//
+// Integer divide: millimeters to meters, on `int32_t`.
+//
+
+void BM_Raw_ConvertIntegerDivide(benchmark::State &state) {
+    const auto mm = make_int32s();
+    std::vector<int32_t> m(mm.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(state, mm.size(), [&](std::size_t i) { m[i] = mm[i] / 1000; });
+}
+BENCHMARK(BM_Raw_ConvertIntegerDivide);
+
+void BM_Au_ConvertIntegerDivide(benchmark::State &state) {
+    const auto mm = make_all(milli(meters), make_int32s());
+    std::vector<int32_t> m(mm.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(state, mm.size(), [&](std::size_t i) {
+        m[i] = mm[i].in(meters, ignore(TRUNCATION_RISK));
+    });
+}
+BENCHMARK(BM_Au_ConvertIntegerDivide);
+
+//
+// Nontrivial rational: inches to millimeters (a factor of 127/5), on `int32_t`.
+//
+
+void BM_Raw_ConvertNontrivialRational(benchmark::State &state) {
+    const auto in = make_int32s();
+    std::vector<int32_t> mm(in.size());
+    benchmark::DoNotOptimize(mm.data());
+    run_elementwise(state, in.size(), [&](std::size_t i) { mm[i] = in[i] * 127 / 5; });
+}
+BENCHMARK(BM_Raw_ConvertNontrivialRational);
+
+void BM_Au_ConvertNontrivialRational(benchmark::State &state) {
+    const auto in = make_all(inches, make_int32s());
+    std::vector<int32_t> mm(in.size());
+    benchmark::DoNotOptimize(mm.data());
+    run_elementwise(state, in.size(), [&](std::size_t i) {
+        mm[i] = in[i].in(milli(meters), ignore(TRUNCATION_RISK));
+    });
+}
+BENCHMARK(BM_Au_ConvertNontrivialRational);
+
+// The same conversion, but with a divisor that the compiler can't see at compile time.  This forces
+// a hardware division for every value.  Au makes sure its divisors are compile time constants, so
+// that compilers can use a (much faster) multiply-high-and-shift sequence instead; this shows what
+// that saves.
+void BM_Raw_ConvertNontrivialRationalRuntimeDivisor(benchmark::State &state) {
+    const auto in = make_int32s();
+    std::vector<int32_t> mm(in.size());
+    benchmark::DoNotOptimize(mm.data());
+    int32_t divisor = 5;
+    benchmark::DoNotOptimize(divisor);
+    run_elementwise(state, in.size(), [&](std::size_t i) { mm[i] = in[i] * 127 / divisor; });
+}
+BENCHMARK(BM_Raw_ConvertNontrivialRationalRuntimeDivisor);
+
+//
+// Checked conversion: inches to feet, on `int32_t`, reporting whether each value converts exactly.
+//
+
+void BM_Raw_ConvertChecked(benchmark::State &state) {
+    const auto in = make_int32s();
+    std::vector<int32_t> ft(in.size());
+    std::vector<char> ok(in.size());
+    benchmark::DoNotOptimize(ft.data());
+    benchmark::DoNotOptimize(ok.data());
+    run_elementwise(state, in.size(), [&](std::size_t i) {
+        ok[i] = (in[i] % 12 == 0);
+        ft[i] = in[i] / 12;
+    });
+}
+BENCHMARK(BM_Raw_ConvertChecked);
+
+// The usual idiom: check first, then convert.
+void BM_Au_ConvertCheckedTwoPass(benchmark::State &state) {
+    const auto in = make_all(inches, make_int32s());
+    std::vector<int32_t> ft(in.size());
+    std::vector<char> ok(in.size());
+    benchmark::DoNotOptimize(ft.data());
+    benchmark::DoNotOptimize(ok.data());
+    run_elementwise(state, in.size(), [&](std::size_t i) {
+        ok[i] = !is_conversion_lossy(in[i], feet);
+        ft[i] = in[i].in(feet, ignore(ALL_RISKS));
+    });
+}
+BENCHMARK(BM_Au_ConvertCheckedTwoPass);
+
+void BM_Au_ConvertCheckedTryIn(benchmark::State &state) {
+    const auto in = make_all(inches, make_int32s());
+    std::vector<int32_t> ft(in.size());
+    std::vector<char> ok(in.size());
+    benchmark::DoNotOptimize(ft.data());
+    benchmark::DoNotOptimize(ok.data());
+    run_elementwise(state, in.size(), [&](std::size_t i) {
+        const auto result = in[i].try_in(feet);
+        ok[i] = result.ok();
+        ft[i] = result.value;
+    });
+}
+BENCHMARK(BM_Au_ConvertCheckedTryIn);
+
+//
+// Saturating conversion: `int32_t` centimeters to `int16_t` millimeters, clamping values that don't
+// fit.  About a third of the inputs saturate.
+//
+
+std::vector<int32_t> make_saturation_inputs() {
+    auto values = make_int32s();
+    for (auto &x : values) {
+        x /= 20;
+    }
+    return values;
+}
+
+// The common hand-written approach: round trip through `double`, and clamp there.
+void BM_Raw_SaturateViaDouble(benchmark::State &state) {
+    const auto cm = make_saturation_inputs();
+    std::vector<int16_t> mm(cm.size());
+    benchmark::DoNotOptimize(mm.data());
+    run_elementwise(state, cm.size(), [&](std::size_t i) {
+        const double x = static_cast<double>(cm[i]) * 10.0;
+        mm[i] = static_cast<int16_t>(x > 32'767.0 ? 32'767.0 : (x < -32'768.0 ? -32'768.0 : x));
+    });
+}
+BENCHMARK(BM_Raw_SaturateViaDouble);
+
+void BM_Au_Saturate(benchmark::State &state) {
+    const auto cm = make_all(centi(meters), make_saturation_inputs());
+    std::vector<int16_t> mm(cm.size());
+    benchmark::DoNotOptimize(mm.data());
+    run_elementwise(state, cm.size(), [&](std::size_t i) {
+        mm[i] = cm[i].in<int16_t>(milli(meters), saturate);
+    });
+}
+BENCHMARK(BM_Au_Saturate);
+
+//
+// Chained conversions: feet to inches to meters, on `double`.  Eagerly, each step multiplies by its
+// own factor.  A lazy chain multiplies once, by the fused factor.
+//
+
+void BM_Au_ConvertChainEager(benchmark::State &state) {
+    const auto ft = make_all(feet, make_doubles());
+    std::vector<double> m(ft.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(
+        state, ft.size(), [&](std::size_t i) { m[i] = ft[i].as(inches).in(meters); });
+}
+BENCHMARK(BM_Au_ConvertChainEager);
+
+void BM_Au_ConvertChainLazy(benchmark::State &state) {
+    const auto ft = make_all(feet, make_doubles());
+    std::vector<double> m(ft.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(
+        state, ft.size(), [&](std::size_t i) { m[i] = lazy(ft[i]).as(inches).in(meters); });
+}
+BENCHMARK(BM_Au_ConvertChainLazy);
+
+//
+// Change of rep along with change of unit: `int32_t` inches to `double` meters.
+//
+
+void BM_Raw_ConvertIntToFloat(benchmark::State &state) {
+    const auto in = make_int32s();
+    std::vector<double> m(in.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(
+        state, in.size(), [&](std::size_t i) { m[i] = static_cast<double>(in[i]) * 0.0254; });
+}
+BENCHMARK(BM_Raw_ConvertIntToFloat);
+
+void BM_Au_ConvertIntToFloat(benchmark::State &state) {
+    const auto in = make_all(inches, make_int32s());
+    std::vector<double> m(in.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(state, in.size(), [&](std::size_t i) { m[i] = in[i].in<double>(meters); });
+}
+BENCHMARK(BM_Au_ConvertIntToFloat);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace au
@@ -0,0 +1,147 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if __cplusplus >= 201703L
+#include <charconv>
+#endif
+
+// Benchmarks for the CSV reader (from `"au/csv.hh"`), which reads unit-labeled columns in chunks.
+// We compare against a plain parse of the same text into two `std::vector<double>`: split each
+// line at its commas, and call `std::from_chars` on each field.  The reader adds a copy of the
+// input into its buffer, and one multiplication per value; it should stay close to the plain parse.
+//
+// `csv.hh` needs full C++17 `std::from_chars` support, so this file is empty in other builds.
+
+#if defined(__cpp_lib_to_chars)
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/benchmarks/benchmark_inputs.hh"
+#include "au/csv.hh"
+#include "au/units/hours.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "benchmark/benchmark.h"
+
+namespace au {
+namespace benchmarks {
+namespace {
+
+// The rows to read per chunk.
+constexpr std::size_t CHUNK_SIZE = NUM_ELEMENTS;
+
+// A CSV file with the given header, and one row of `time,speed` for each input value.
+std::string make_csv(const char *header, std::size_t num_rows) {
+    const auto values = make_doubles(num_rows);
+    std::string csv = header;
+    for (std::size_t i = 0u; i < values.size(); ++i) {
+        char buf[64];
+        char *end = std::to_chars(buf, buf + sizeof(buf), 0.01 * static_cast<double>(i)).ptr;
+        *end++ = ',';
+        end = std::to_chars(end, buf + sizeof(buf), values[i]).ptr;
+        *end++ = '\n';
+        csv.append(buf, end);
+    }
+    return csv;
+}
+
+// Read every row of `csv` on each iteration, `CHUNK_SIZE` rows at a time, with `read_all(in)`.
+template <typename ReadAll>
+void run_over_file(benchmark::State &state, const std::string &csv, ReadAll &&read_all) {
+    std::istringstream in{csv};
+    std::size_t rows = 0u;
+    for (auto _ : state) {
+        in.clear();
+        in.seekg(0);
+        rows = read_all(in);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(rows));
+}
+
+// The plain version: read the whole stream into memory at once, then parse each line in place.
+void BM_Raw_ParseCsv(benchmark::State &state) {
+    const auto csv = make_csv("time [s],speed [m / s]\n", 16u * NUM_ELEMENTS);
+    std::string text(csv.size(), '\0');
+    std::vector<double> time;
+    std::vector<double> speed;
+    run_over_file(state, csv, [&](std::istream &in) {
+        in.read(&text[0], static_cast<std::streamsize>(text.size()));
+        time.clear();
+        speed.clear();
+
+        const char *first = text.data();
+        const char *last = text.data() + text.size();
+        first = static_cast<const char *>(std::memchr(first, '\n', last - first)) + 1;
+        while (first < last) {
+            const char *end = static_cast<const char *>(std::memchr(first, '\n', last - first));
+            const char *comma = static_cast<const char *>(std::memchr(first, ',', end - first));
+            double t;
+            double v;
+            std::from_chars(first, comma, t);
+            std::from_chars(comma + 1, end, v);
+            time.push_back(t);
+            speed.push_back(v);
+            first = end + 1;
+        }
+        benchmark::DoNotOptimize(speed.data());
+        return time.size();
+    });
+}
+BENCHMARK(BM_Raw_ParseCsv);
+
+// Read a file in a fixed memory budget, with columns in the destination units.
+void BM_Au_ReadCsv(benchmark::State &state) {
+    const auto csv = make_csv("time [s],speed [m / s]\n", 16u * NUM_ELEMENTS);
+    run_over_file(state, csv, [&](std::istream &in) {
+        auto file = open_csv(in,
+                             csv_column<double>("time", seconds),
+                             csv_column<double>("speed", meters / second));
+        std::size_t rows = 0u;
+        while (const auto n = file.value.read_chunk(CHUNK_SIZE).value) {
+            benchmark::DoNotOptimize(file.value.column<1>().data_in(meters / second));
+            rows += n;
+        }
+        return rows;
+    });
+}
+BENCHMARK(BM_Au_ReadCsv);
+
+// The same, with the speed column in an alternative unit, which we must convert.
+void BM_Au_ReadCsvAlternativeUnit(benchmark::State &state) {
+    const auto csv = make_csv("time [s],speed [km / h]\n", 16u * NUM_ELEMENTS);
+    run_over_file(state, csv, [&](std::istream &in) {
+        auto file = open_csv(
+            in,
+            csv_column<double>("time", seconds),
+            csv_column<double>("speed", meters / second, also_accept(kilo(meters) / hour)));
+        std::size_t rows = 0u;
+        while (const auto n = file.value.read_chunk(CHUNK_SIZE).value) {
+            benchmark::DoNotOptimize(file.value.column<1>().data_in(meters / second));
+            rows += n;
+        }
+        return rows;
+    });
+}
+BENCHMARK(BM_Au_ReadCsvAlternativeUnit);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace au
+
+#endif
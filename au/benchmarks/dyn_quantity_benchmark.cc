@@ -0,0 +1,81 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include "au/au.hh"
+#include "au/benchmarks/benchmark_inputs.hh"
+#include "au/dyn_quantity.hh"
+#include "au/units/hours.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "benchmark/benchmark.h"
+
+// Benchmarks for converting values whose unit is chosen at runtime (km / h, here) to a static
+// `Quantity` (in m / s).  The baseline is the usual hand-written approach: a scale factor, looked
+// up once, then one multiplication per value.
+
+namespace au {
+namespace benchmarks {
+namespace {
+
+void BM_Raw_ConvertRuntimeUnit(benchmark::State &state) {
+    const auto kmh = make_doubles();
+    std::vector<double> mps(kmh.size());
+    benchmark::DoNotOptimize(mps.data());
+
+    // A hand-written scale table (to m / s), indexed by a runtime choice of unit.
+    static constexpr double SCALE_TO_MPS[] = {1.0, 1000.0 / 3600.0, 0.001};
+    std::size_t unit_index = 1u;
+    benchmark::DoNotOptimize(unit_index);
+    const double factor = SCALE_TO_MPS[unit_index];
+
+    run_elementwise(state, kmh.size(), [&](std::size_t i) { mps[i] = kmh[i] * factor; });
+}
+BENCHMARK(BM_Raw_ConvertRuntimeUnit);
+
+// A converter bound once, applied to every raw value.
+void BM_Au_DynConverterApply(benchmark::State &state) {
+    const auto kmh = make_doubles();
+    std::vector<double> mps(kmh.size());
+    benchmark::DoNotOptimize(mps.data());
+    auto source = dyn_unit(kilo(meters) / hour);
+    benchmark::DoNotOptimize(source);
+    const auto c = make_dyn_converter<double>(meters / second, source);
+    run_elementwise(state, kmh.size(), [&](std::size_t i) {
+        mps[i] = c.apply(kmh[i]).in(meters / second);
+    });
+}
+BENCHMARK(BM_Au_DynConverterApply);
+
+// A converter fed `DynQuantity` values, which checks each one's unit against the cached one.
+void BM_Au_DynConverterConvert(benchmark::State &state) {
+    const auto raw = make_doubles();
+    std::vector<DynQuantity<double>> kmh;
+    kmh.reserve(raw.size());
+    for (const double x : raw) {
+        kmh.emplace_back(x, dyn_unit(kilo(meters) / hour));
+    }
+    std::vector<double> mps(kmh.size());
+    benchmark::DoNotOptimize(mps.data());
+    auto c = make_dyn_converter<double>(meters / second, dyn_unit(meters / second));
+    run_elementwise(state, kmh.size(), [&](std::size_t i) {
+        mps[i] = c.convert(kmh[i]).value.in(meters / second);
+    });
+}
+BENCHMARK(BM_Au_DynConverterConvert);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace au
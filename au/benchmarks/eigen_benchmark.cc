@@ -0,0 +1,193 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Eigen/Core>
+#include <limits>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/benchmarks/benchmark_inputs.hh"
+#include "au/compatibility/eigen.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "benchmark/benchmark.h"
+
+// Benchmarks for the Eigen compatibility layer, compared with the same operations on raw Eigen
+// types.
+
+namespace au {
+namespace benchmarks {
+namespace {
+
+std::vector<Eigen::Vector3d> make_vectors() {
+    const auto x = make_doubles();
+    std::vector<Eigen::Vector3d> result;
+    result.reserve(x.size());
+    for (auto i = 0u; i < x.size(); ++i) {
+        result.emplace_back(x[i], x[(i + 1u) % x.size()], x[(i + 2u) % x.size()]);
+    }
+    return result;
+}
+
+void BM_Raw_EigenNorm(benchmark::State &state) {
+    const auto v = make_vectors();
+    std::vector<double> out(v.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, v.size(), [&](std::size_t i) { out[i] = v[i].norm(); });
+}
+BENCHMARK(BM_Raw_EigenNorm);
+
+void BM_Au_EigenNorm(benchmark::State &state) {
+    const auto v = make_all(meters, make_vectors());
+    std::vector<Quantity<Meters, double>> out(v.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, v.size(), [&](std::size_t i) { out[i] = norm(v[i]); });
+}
+BENCHMARK(BM_Au_EigenNorm);
+
+void BM_Raw_EigenDot(benchmark::State &state) {
+    const auto a = make_vectors();
+    const auto b = make_vectors();
+    std::vector<double> out(a.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, a.size(), [&](std::size_t i) { out[i] = a[i].dot(b[i]); });
+}
+BENCHMARK(BM_Raw_EigenDot);
+
+void BM_Au_EigenDot(benchmark::State &state) {
+    const auto a = make_all(meters, make_vectors());
+    const auto b = make_all(meters, make_vectors());
+    std::vector<Quantity<decltype(Meters{} * Meters{}), double>> out(a.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, a.size(), [&](std::size_t i) { out[i] = dot(a[i], b[i]); });
+}
+BENCHMARK(BM_Au_EigenDot);
+
+// Integrate velocity over a time step: `p += v * dt`, evaluated into existing storage.
+void BM_Raw_EigenAxpy(benchmark::State &state) {
+    const auto v = make_vectors();
+    std::vector<Eigen::Vector3d> p(v.size(), Eigen::Vector3d::Zero());
+    benchmark::DoNotOptimize(p.data());
+    const double dt = 0.01;
+    run_elementwise(state, v.size(), [&](std::size_t i) { p[i] += v[i] * dt; });
+}
+BENCHMARK(BM_Raw_EigenAxpy);
+
+void BM_Au_EigenAxpy(benchmark::State &state) {
+    const auto v = make_all(meters / second, make_vectors());
+    std::vector<Quantity<Meters, Eigen::Vector3d>> p(v.size(),
+                                                     meters(Eigen::Vector3d::Zero().eval()));
+    benchmark::DoNotOptimize(p.data());
+    const auto dt = seconds(0.01);
+    run_elementwise(state, v.size(), [&](std::size_t i) { p[i] += eval(v[i] * dt); });
+}
+BENCHMARK(BM_Au_EigenAxpy);
+
+// Unit conversion of a whole vector: meters to millimeters.
+void BM_Raw_EigenConvert(benchmark::State &state) {
+    const auto v = make_vectors();
+    std::vector<Eigen::Vector3d> out(v.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, v.size(), [&](std::size_t i) { out[i] = v[i] * 1000.0; });
+}
+BENCHMARK(BM_Raw_EigenConvert);
+
+void BM_Au_EigenConvert(benchmark::State &state) {
+    const auto v = make_all(meters, make_vectors());
+    std::vector<Eigen::Vector3d> out(v.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, v.size(), [&](std::size_t i) { out[i] = v[i].in(milli(meters)); });
+}
+BENCHMARK(BM_Au_EigenConvert);
+
+// Transform a batch of points, stored as the columns of one matrix, into existing storage.
+Eigen::Matrix3Xd make_points() {
+    const auto v = make_vectors();
+    Eigen::Matrix3Xd result(3, static_cast<Eigen::Index>(v.size()));
+    for (auto i = 0u; i < v.size(); ++i) {
+        result.col(static_cast<Eigen::Index>(i)) = v[i];
+    }
+    return result;
+}
+
+Eigen::Matrix3d make_transform() {
+    Eigen::Matrix3d result;
+    result << 0.0, -1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 2.0;
+    return result;
+}
+
+void BM_Raw_EigenBatchTransform(benchmark::State &state) {
+    const Eigen::Matrix3d m = make_transform();
+    const Eigen::Matrix3Xd x = make_points();
+    Eigen::Matrix3Xd out(3, x.cols());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, 1u, [&](std::size_t) { out.noalias() = m * x; });
+}
+BENCHMARK(BM_Raw_EigenBatchTransform);
+
+void BM_Au_EigenBatchTransform(benchmark::State &state) {
+    const auto m = (meters / second)(make_transform());
+    const auto x = seconds(make_points());
+    auto out = meters(Eigen::Matrix3Xd(3, x.data_in(seconds).cols()));
+    benchmark::DoNotOptimize(out.data_in(meters).data());
+    run_elementwise(state, 1u, [&](std::size_t) { noalias(out) = m * x; });
+}
+BENCHMARK(BM_Au_EigenBatchTransform);
+
+// Runtime-checked unit conversion of an integer array: meters to centimeters, with overflow checks.
+Eigen::ArrayXi make_int_array() {
+    const auto x = make_int32s();
+    return Eigen::Map<const Eigen::ArrayXi>(x.data(), static_cast<Eigen::Index>(x.size()));
+}
+
+void BM_Raw_EigenUncheckedIntConvert(benchmark::State &state) {
+    const Eigen::ArrayXi x = make_int_array();
+    Eigen::ArrayXi out(x.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, 1u, [&](std::size_t) { out = x * 100; });
+}
+BENCHMARK(BM_Raw_EigenUncheckedIntConvert);
+
+// Check each bound with a single reduction over the input, then convert.
+void BM_Raw_EigenCheckedIntConvert(benchmark::State &state) {
+    const Eigen::ArrayXi x = make_int_array();
+    Eigen::ArrayXi out(x.size());
+    int failures = 0;
+    benchmark::DoNotOptimize(out.data());
+    benchmark::DoNotOptimize(&failures);
+    constexpr int kMin = std::numeric_limits<int>::min() / 100;
+    constexpr int kMax = std::numeric_limits<int>::max() / 100;
+    run_elementwise(state, 1u, [&](std::size_t) {
+        if (x.minCoeff() < kMin || x.maxCoeff() > kMax) {
+            ++failures;
+        }
+        out = x * 100;
+    });
+}
+BENCHMARK(BM_Raw_EigenCheckedIntConvert);
+
+void BM_Au_EigenCheckedIntConvert(benchmark::State &state) {
+    const auto x = meters(make_int_array());
+    Eigen::ArrayXi out(x.data_in(meters).size());
+    ConversionFailure failure;
+    benchmark::DoNotOptimize(out.data());
+    benchmark::DoNotOptimize(&failure);
+    const auto policy = check_at_runtime(OVERFLOW_RISK, record_failure_in(failure));
+    run_elementwise(state, 1u, [&](std::size_t) { out = x.in(centi(meters), policy); });
+}
+BENCHMARK(BM_Au_EigenCheckedIntConvert);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace au
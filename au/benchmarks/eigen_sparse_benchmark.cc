@@ -0,0 +1,152 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
+#include <utility>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/benchmarks/benchmark_inputs.hh"
+#include "au/compatibility/eigen.hh"
+#include "au/compatibility/eigen_sparse.hh"
+#include "au/units/kelvins.hh"
+#include "au/units/watts.hh"
+#include "benchmark/benchmark.h"
+
+// Benchmarks for Eigen sparse matrix reps, on the conductance matrix of a large thermal model,
+// compared with the same operations on raw Eigen types.
+
+namespace au {
+namespace benchmarks {
+namespace {
+
+using SparseMatrixd = Eigen::SparseMatrix<double>;
+using WattsPerKelvin = decltype(Watts{} / Kelvins{});
+using MilliwattsPerKelvin = decltype(Milli<Watts>{} / Kelvins{});
+
+// The conductance matrix of an `n` x `n` grid of nodes, each linked to its four neighbours, with
+// the edges held at a fixed temperature.  This has `n * n` rows, and about `5 * n * n` nonzeros.
+SparseMatrixd make_grid_conductance(int n) {
+    std::vector<Eigen::Triplet<double>> entries;
+    entries.reserve(static_cast<std::size_t>(5 * n * n));
+    const auto index = [n](int i, int j) { return i * n + j; };
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            entries.emplace_back(index(i, j), index(i, j), 4.0);
+            if (i > 0) {
+                entries.emplace_back(index(i, j), index(i - 1, j), -1.0);
+                entries.emplace_back(index(i - 1, j), index(i, j), -1.0);
+            }
+            if (j > 0) {
+                entries.emplace_back(index(i, j), index(i, j - 1), -1.0);
+                entries.emplace_back(index(i, j - 1), index(i, j), -1.0);
+            }
+        }
+    }
+    SparseMatrixd k(n * n, n * n);
+    k.setFromTriplets(entries.begin(), entries.end());
+    return k;
+}
+
+// About 1.25 million nonzeros.
+constexpr int kLargeGrid = 500;
+
+// Small enough to factor quickly, while still having many thousands of unknowns.
+constexpr int kSolverGrid = 100;
+
+Eigen::VectorXd make_temperatures(int n) {
+    return Eigen::VectorXd::LinSpaced(n * n, 250.0, 350.0);
+}
+
+void BM_Raw_SparseDenseProduct(benchmark::State &state) {
+    const SparseMatrixd k = make_grid_conductance(kLargeGrid);
+    const Eigen::VectorXd t = make_temperatures(kLargeGrid);
+    Eigen::VectorXd heat(t.size());
+    benchmark::DoNotOptimize(heat.data());
+    run_elementwise(state, 1u, [&](std::size_t) { heat.noalias() = k * t; });
+}
+BENCHMARK(BM_Raw_SparseDenseProduct);
+
+void BM_Au_SparseDenseProduct(benchmark::State &state) {
+    const auto k = make_quantity<WattsPerKelvin>(make_grid_conductance(kLargeGrid));
+    const auto t = kelvins(make_temperatures(kLargeGrid));
+    auto heat = watts(Eigen::VectorXd(t.data_in(kelvins).size()));
+    benchmark::DoNotOptimize(heat.data_in(watts).data());
+    run_elementwise(state, 1u, [&](std::size_t) { noalias(heat) = k * t; });
+}
+BENCHMARK(BM_Au_SparseDenseProduct);
+
+// Convert to milliwatts per kelvin, and back, in place.
+void BM_Raw_SparseConvertInPlace(benchmark::State &state) {
+    SparseMatrixd k = make_grid_conductance(kLargeGrid);
+    benchmark::DoNotOptimize(k.valuePtr());
+    run_elementwise(state, 1u, [&](std::size_t) {
+        k.coeffs() *= 1000.0;
+        k.coeffs() /= 1000.0;
+    });
+}
+BENCHMARK(BM_Raw_SparseConvertInPlace);
+
+void BM_Au_SparseConvertInPlace(benchmark::State &state) {
+    auto k = make_quantity<WattsPerKelvin>(make_grid_conductance(kLargeGrid));
+    benchmark::DoNotOptimize(k.data_in(WattsPerKelvin{}).valuePtr());
+    run_elementwise(state, 1u, [&](std::size_t) {
+        auto k_mw = convert_in_place(std::move(k), MilliwattsPerKelvin{});
+        auto k_back = convert_in_place(std::move(k_mw), WattsPerKelvin{});
+
+        // Hand the storage back to `k` for the next iteration.  (Assigning would copy it, because
+        // Eigen 3.4's `SparseMatrix` has no move assignment.)
+        k.data_in(WattsPerKelvin{}).swap(k_back.data_in(WattsPerKelvin{}));
+    });
+}
+BENCHMARK(BM_Au_SparseConvertInPlace);
+
+// For comparison: converting by assigning `.in()` rebuilds the sparsity structure each time.
+void BM_Au_SparseConvertByAssignment(benchmark::State &state) {
+    const auto k = make_quantity<WattsPerKelvin>(make_grid_conductance(kLargeGrid));
+    SparseMatrixd k_mw;
+    SparseMatrixd k_back;
+    run_elementwise(state, 1u, [&](std::size_t) {
+        k_mw = k.in(MilliwattsPerKelvin{});
+        k_back = make_quantity<MilliwattsPerKelvin>(k_mw).in(WattsPerKelvin{});
+        benchmark::DoNotOptimize(k_back.valuePtr());
+    });
+}
+BENCHMARK(BM_Au_SparseConvertByAssignment);
+
+void BM_Raw_SparseSolve(benchmark::State &state) {
+    const SparseMatrixd k = make_grid_conductance(kSolverGrid);
+    const Eigen::VectorXd heat = k * make_temperatures(kSolverGrid);
+    const Eigen::SimplicialLDLT<SparseMatrixd> solver{k};
+    Eigen::VectorXd t(heat.size());
+    benchmark::DoNotOptimize(t.data());
+    run_elementwise(state, 1u, [&](std::size_t) { t = solver.solve(heat); });
+}
+BENCHMARK(BM_Raw_SparseSolve);
+
+void BM_Au_SparseSolve(benchmark::State &state) {
+    const auto k = make_quantity<WattsPerKelvin>(make_grid_conductance(kSolverGrid));
+    const auto heat = watts(Eigen::VectorXd(k.data_in(WattsPerKelvin{}) *
+                                            make_temperatures(kSolverGrid)));
+    const QuantitySolver<Eigen::SimplicialLDLT<SparseMatrixd>, WattsPerKelvin> solver{k};
+    auto t = kelvins(Eigen::VectorXd(heat.data_in(watts).size()));
+    benchmark::DoNotOptimize(t.data_in(kelvins).data());
+    run_elementwise(state, 1u, [&](std::size_t) { t = solver.solve(heat); });
+}
+BENCHMARK(BM_Au_SparseSolve);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace au
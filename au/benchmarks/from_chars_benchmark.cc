@@ -0,0 +1,94 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if __cplusplus >= 201703L
+#include <charconv>
+#endif
+
+// Benchmarks for `from_chars()` (from `"au/from_chars.hh"`), which parses `"value unit"` strings.
+// We compare against `std::from_chars` on the number alone, which is the lower bound: the unit
+// labels are compile time constants, so matching them should add little.
+//
+// `from_chars()` needs full C++17 `std::from_chars` support, so this file is empty in other builds.
+
+#if defined(__cpp_lib_to_chars)
+
+#include <string>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/benchmarks/benchmark_inputs.hh"
+#include "au/from_chars.hh"
+#include "au/units/hours.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "benchmark/benchmark.h"
+
+namespace au {
+namespace benchmarks {
+namespace {
+
+// Format each of `values` with `std::to_chars`, followed by `suffix`.
+std::vector<std::string> make_strings(const std::vector<double> &values, const char *suffix) {
+    std::vector<std::string> result;
+    result.reserve(values.size());
+    for (const double x : values) {
+        char buf[32];
+        const auto end = std::to_chars(buf, buf + sizeof(buf), x).ptr;
+        result.emplace_back(buf, end);
+        result.back() += suffix;
+    }
+    return result;
+}
+
+void BM_Raw_FromChars(benchmark::State &state) {
+    const auto str = make_strings(make_doubles(), "");
+    std::vector<double> v(str.size());
+    benchmark::DoNotOptimize(v.data());
+    run_elementwise(state, str.size(), [&](std::size_t i) {
+        std::from_chars(str[i].data(), str[i].data() + str[i].size(), v[i]);
+    });
+}
+BENCHMARK(BM_Raw_FromChars);
+
+// Input in the destination unit.
+void BM_Au_FromChars(benchmark::State &state) {
+    const auto str = make_strings(make_doubles(), " m / s");
+    std::vector<Quantity<UnitQuotient<Meters, Seconds>, double>> v(str.size());
+    benchmark::DoNotOptimize(v.data());
+    run_elementwise(state, str.size(), [&](std::size_t i) {
+        from_chars(str[i].data(), str[i].data() + str[i].size(), v[i]);
+    });
+}
+BENCHMARK(BM_Au_FromChars);
+
+// Input in an alternative unit, which we must match and then convert.
+void BM_Au_FromCharsAlternativeUnit(benchmark::State &state) {
+    const auto str = make_strings(make_doubles(), " km / h");
+    std::vector<Quantity<UnitQuotient<Meters, Seconds>, double>> v(str.size());
+    benchmark::DoNotOptimize(v.data());
+    run_elementwise(state, str.size(), [&](std::size_t i) {
+        from_chars(str[i].data(),
+                   str[i].data() + str[i].size(),
+                   v[i],
+                   also_accept(kilo(meters) / hour, milli(meters) / second));
+    });
+}
+BENCHMARK(BM_Au_FromCharsAlternativeUnit);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace au
+
+#endif
@@ -0,0 +1,134 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/benchmarks/benchmark_inputs.hh"
+#include "au/units/meters.hh"
+#include "benchmark/benchmark.h"
+
+// Benchmarks for the functions in `math.hh`, compared with their `<cmath>` counterparts.
+
+namespace au {
+namespace benchmarks {
+namespace {
+
+void BM_Raw_Abs(benchmark::State &state) {
+    const auto x = make_doubles();
+    std::vector<double> out(x.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, x.size(), [&](std::size_t i) { out[i] = std::abs(x[i]); });
+}
+BENCHMARK(BM_Raw_Abs);
+
+void BM_Au_Abs(benchmark::State &state) {
+    const auto x = make_all(meters, make_doubles());
+    std::vector<Quantity<Meters, double>> out(x.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, x.size(), [&](std::size_t i) { out[i] = abs(x[i]); });
+}
+BENCHMARK(BM_Au_Abs);
+
+void BM_Raw_Hypot(benchmark::State &state) {
+    const auto x = make_doubles();
+    const auto y = make_doubles();
+    std::vector<double> out(x.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, x.size(), [&](std::size_t i) { out[i] = std::hypot(x[i], y[i]); });
+}
+BENCHMARK(BM_Raw_Hypot);
+
+void BM_Au_Hypot(benchmark::State &state) {
+    const auto x = make_all(meters, make_doubles());
+    const auto y = make_all(meters, make_doubles());
+    std::vector<Quantity<Meters, double>> out(x.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, x.size(), [&](std::size_t i) { out[i] = hypot(x[i], y[i]); });
+}
+BENCHMARK(BM_Au_Hypot);
+
+void BM_Raw_Sqrt(benchmark::State &state) {
+    const auto x = make_doubles();
+    std::vector<double> out(x.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, x.size(), [&](std::size_t i) { out[i] = std::sqrt(x[i] * x[i]); });
+}
+BENCHMARK(BM_Raw_Sqrt);
+
+void BM_Au_Sqrt(benchmark::State &state) {
+    const auto x = make_all(meters, make_doubles());
+    std::vector<Quantity<Meters, double>> out(x.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, x.size(), [&](std::size_t i) { out[i] = sqrt(x[i] * x[i]); });
+}
+BENCHMARK(BM_Au_Sqrt);
+
+// Rounding to a _different_ unit: millimeters to the nearest meter.
+void BM_Raw_RoundAs(benchmark::State &state) {
+    const auto mm = make_doubles();
+    std::vector<double> m(mm.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(state, mm.size(), [&](std::size_t i) { m[i] = std::round(mm[i] / 1000.0); });
+}
+BENCHMARK(BM_Raw_RoundAs);
+
+void BM_Au_RoundAs(benchmark::State &state) {
+    const auto mm = make_all(milli(meters), make_doubles());
+    std::vector<Quantity<Meters, double>> m(mm.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(state, mm.size(), [&](std::size_t i) { m[i] = round_as(meters, mm[i]); });
+}
+BENCHMARK(BM_Au_RoundAs);
+
+void BM_Raw_FloorAs(benchmark::State &state) {
+    const auto mm = make_doubles();
+    std::vector<double> m(mm.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(state, mm.size(), [&](std::size_t i) { m[i] = std::floor(mm[i] / 1000.0); });
+}
+BENCHMARK(BM_Raw_FloorAs);
+
+void BM_Au_FloorAs(benchmark::State &state) {
+    const auto mm = make_all(milli(meters), make_doubles());
+    std::vector<Quantity<Meters, double>> m(mm.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(state, mm.size(), [&](std::size_t i) { m[i] = floor_as(meters, mm[i]); });
+}
+BENCHMARK(BM_Au_FloorAs);
+
+void BM_Raw_IntRoundAs(benchmark::State &state) {
+    const auto mm = make_doubles();
+    std::vector<int32_t> m(mm.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(state, mm.size(), [&](std::size_t i) {
+        m[i] = static_cast<int32_t>(std::round(mm[i] / 1000.0));
+    });
+}
+BENCHMARK(BM_Raw_IntRoundAs);
+
+void BM_Au_IntRoundAs(benchmark::State &state) {
+    const auto mm = make_all(milli(meters), make_doubles());
+    std::vector<Quantity<Meters, int32_t>> m(mm.size());
+    benchmark::DoNotOptimize(m.data());
+    run_elementwise(
+        state, mm.size(), [&](std::size_t i) { m[i] = int_round_as<int32_t>(meters, mm[i]); });
+}
+BENCHMARK(BM_Au_IntRoundAs);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace au
@@ -0,0 +1,134 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <vector>
+
+#include "au/au.hh"
+#include "au/benchmarks/benchmark_inputs.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "benchmark/benchmark.h"
+
+// Benchmarks for basic `Quantity` arithmetic, compared with the same arithmetic on raw numbers.
+
+namespace au {
+namespace benchmarks {
+namespace {
+
+void BM_Raw_Add(benchmark::State &state) {
+    const auto a = make_doubles();
+    const auto b = make_doubles();
+    std::vector<double> out(a.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, a.size(), [&](std::size_t i) { out[i] = a[i] + b[i]; });
+}
+BENCHMARK(BM_Raw_Add);
+
+void BM_Au_Add(benchmark::State &state) {
+    const auto a = make_all(meters, make_doubles());
+    const auto b = make_all(meters, make_doubles());
+    std::vector<Quantity<Meters, double>> out(a.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, a.size(), [&](std::size_t i) { out[i] = a[i] + b[i]; });
+}
+BENCHMARK(BM_Au_Add);
+
+// Adding quantities in different units: Au converts both to their common unit automatically.
+void BM_Raw_AddMixedUnits(benchmark::State &state) {
+    const auto a_m = make_doubles();
+    const auto b_mm = make_doubles();
+    std::vector<double> out_mm(a_m.size());
+    benchmark::DoNotOptimize(out_mm.data());
+    run_elementwise(
+        state, a_m.size(), [&](std::size_t i) { out_mm[i] = a_m[i] * 1000.0 + b_mm[i]; });
+}
+BENCHMARK(BM_Raw_AddMixedUnits);
+
+void BM_Au_AddMixedUnits(benchmark::State &state) {
+    const auto a = make_all(meters, make_doubles());
+    const auto b = make_all(milli(meters), make_doubles());
+    std::vector<Quantity<Milli<Meters>, double>> out(a.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, a.size(), [&](std::size_t i) { out[i] = a[i] + b[i]; });
+}
+BENCHMARK(BM_Au_AddMixedUnits);
+
+void BM_Raw_Divide(benchmark::State &state) {
+    const auto distance = make_doubles();
+    const auto time = make_doubles();
+    std::vector<double> out(distance.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, distance.size(), [&](std::size_t i) {
+        out[i] = distance[i] / (time[i] + 1000.0);
+    });
+}
+BENCHMARK(BM_Raw_Divide);
+
+void BM_Au_Divide(benchmark::State &state) {
+    const auto distance = make_all(meters, make_doubles());
+    const auto time = make_all(seconds, make_doubles());
+    std::vector<Quantity<UnitQuotient<Meters, Seconds>, double>> out(distance.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, distance.size(), [&](std::size_t i) {
+        out[i] = distance[i] / (time[i] + seconds(1000.0));
+    });
+}
+BENCHMARK(BM_Au_Divide);
+
+// Multiply-accumulate, mixing scalar and dimensioned factors.
+void BM_Raw_MultiplyAccumulate(benchmark::State &state) {
+    const auto velocity = make_doubles();
+    const auto time = make_doubles();
+    std::vector<double> position(velocity.size());
+    benchmark::DoNotOptimize(position.data());
+    run_elementwise(state, velocity.size(), [&](std::size_t i) {
+        position[i] += 0.5 * velocity[i] * time[i];
+    });
+}
+BENCHMARK(BM_Raw_MultiplyAccumulate);
+
+void BM_Au_MultiplyAccumulate(benchmark::State &state) {
+    const auto velocity = make_all((meters / second), make_doubles());
+    const auto time = make_all(seconds, make_doubles());
+    std::vector<Quantity<Meters, double>> position(velocity.size());
+    benchmark::DoNotOptimize(position.data());
+    run_elementwise(state, velocity.size(), [&](std::size_t i) {
+        position[i] += 0.5 * velocity[i] * time[i];
+    });
+}
+BENCHMARK(BM_Au_MultiplyAccumulate);
+
+// Comparing quantities in different units: Au converts both to their common unit automatically.
+void BM_Raw_CompareMixedUnits(benchmark::State &state) {
+    const auto a_m = make_doubles();
+    const auto b_mm = make_doubles();
+    std::vector<char> is_less(a_m.size());
+    benchmark::DoNotOptimize(is_less.data());
+    run_elementwise(
+        state, a_m.size(), [&](std::size_t i) { is_less[i] = (a_m[i] * 1000.0 < b_mm[i]); });
+}
+BENCHMARK(BM_Raw_CompareMixedUnits);
+
+void BM_Au_CompareMixedUnits(benchmark::State &state) {
+    const auto a = make_all(meters, make_doubles());
+    const auto b = make_all(milli(meters), make_doubles());
+    std::vector<char> is_less(a.size());
+    benchmark::DoNotOptimize(is_less.data());
+    run_elementwise(state, a.size(), [&](std::size_t i) { is_less[i] = (a[i] < b[i]); });
+}
+BENCHMARK(BM_Au_CompareMixedUnits);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace au
@@ -0,0 +1,106 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/benchmarks/benchmark_inputs.hh"
+#include "au/units/celsius.hh"
+#include "au/units/kelvins.hh"
+#include "au/units/meters.hh"
+#include "benchmark/benchmark.h"
+
+// Benchmarks for `QuantityPoint` operations, which must account for the offset between the origins
+// of different units.
+
+namespace au {
+namespace benchmarks {
+namespace {
+
+void BM_Raw_PointConvertWithOffset(benchmark::State &state) {
+    const auto deg_c = make_doubles();
+    std::vector<double> k(deg_c.size());
+    benchmark::DoNotOptimize(k.data());
+    run_elementwise(state, deg_c.size(), [&](std::size_t i) { k[i] = deg_c[i] + 273.15; });
+}
+BENCHMARK(BM_Raw_PointConvertWithOffset);
+
+void BM_Au_PointConvertWithOffset(benchmark::State &state) {
+    const auto temp = make_all(celsius_pt, make_doubles());
+    std::vector<double> k(temp.size());
+    benchmark::DoNotOptimize(k.data());
+    run_elementwise(state, temp.size(), [&](std::size_t i) { k[i] = temp[i].in(kelvins_pt); });
+}
+BENCHMARK(BM_Au_PointConvertWithOffset);
+
+// Integer points, where both the unit and the origin change: Celsius to milli-Kelvin.
+void BM_Raw_IntPointConvertWithOffset(benchmark::State &state) {
+    const auto deg_c = make_int32s();
+    std::vector<int32_t> mk(deg_c.size());
+    benchmark::DoNotOptimize(mk.data());
+    run_elementwise(
+        state, deg_c.size(), [&](std::size_t i) { mk[i] = deg_c[i] * 1000 + 273'150; });
+}
+BENCHMARK(BM_Raw_IntPointConvertWithOffset);
+
+void BM_Au_IntPointConvertWithOffset(benchmark::State &state) {
+    const auto temp = make_all(celsius_pt, make_int32s());
+    std::vector<int32_t> mk(temp.size());
+    benchmark::DoNotOptimize(mk.data());
+    run_elementwise(
+        state, temp.size(), [&](std::size_t i) { mk[i] = temp[i].in(milli(kelvins_pt)); });
+}
+BENCHMARK(BM_Au_IntPointConvertWithOffset);
+
+void BM_Raw_PointDifference(benchmark::State &state) {
+    const auto a = make_doubles();
+    const auto b = make_doubles();
+    std::vector<double> out(a.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, a.size(), [&](std::size_t i) { out[i] = a[i] - b[i]; });
+}
+BENCHMARK(BM_Raw_PointDifference);
+
+void BM_Au_PointDifference(benchmark::State &state) {
+    const auto a = make_all(meters_pt, make_doubles());
+    const auto b = make_all(meters_pt, make_doubles());
+    std::vector<Quantity<Meters, double>> out(a.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, a.size(), [&](std::size_t i) { out[i] = a[i] - b[i]; });
+}
+BENCHMARK(BM_Au_PointDifference);
+
+// Subtracting points in units with different origins: Au converts both to a common point unit.
+void BM_Raw_PointDifferenceMixedOrigins(benchmark::State &state) {
+    const auto k = make_doubles();
+    const auto deg_c = make_doubles();
+    std::vector<double> out(k.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, k.size(), [&](std::size_t i) { out[i] = k[i] - (deg_c[i] + 273.15); });
+}
+BENCHMARK(BM_Raw_PointDifferenceMixedOrigins);
+
+void BM_Au_PointDifferenceMixedOrigins(benchmark::State &state) {
+    const auto k = make_all(kelvins_pt, make_doubles());
+    const auto temp = make_all(celsius_pt, make_doubles());
+    std::vector<double> out(k.size());
+    benchmark::DoNotOptimize(out.data());
+    run_elementwise(state, k.size(), [&](std::size_t i) { out[i] = (k[i] - temp[i]).in(kelvins); });
+}
+BENCHMARK(BM_Au_PointDifferenceMixedOrigins);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace au
@@ -0,0 +1,120 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#if __cplusplus >= 201703L
+#include <charconv>
+#endif
+
+#if __cplusplus >= 202002L
+#include <version>
+#endif
+
+// Benchmarks for printing quantities: `to_chars()` (from `"au/to_chars.hh"`) against `operator<<`
+// (from `"au/io.hh"`), and against `std::format` (from `"au/std_format.hh"`) where the toolchain
+// supports it.  Each benchmark prints every quantity into the same buffer or stream, reusing it so
+// that we measure the formatting itself rather than repeated allocation of a fresh output.
+//
+// `to_chars()` needs full C++17 `std::to_chars` support, so this file is empty in other builds.
+
+#if defined(__cpp_lib_to_chars)
+
+#include <array>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/benchmarks/benchmark_inputs.hh"
+#include "au/io.hh"
+#include "au/to_chars.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "benchmark/benchmark.h"
+
+#if defined(__cpp_lib_format)
+#include "au/std_format.hh"
+#endif
+
+namespace au {
+namespace benchmarks {
+namespace {
+
+// A speed in `double` (exercising floating point formatting, and a compound unit label).
+auto make_speeds() { return make_all(meters / second, make_doubles()); }
+
+// A length in `int32_t`.
+auto make_lengths() { return make_all(milli(meters), make_int32s()); }
+
+//
+// `to_chars()`: writes directly into a fixed, stack-allocated buffer.
+//
+
+template <typename T>
+void BM_Au_ToChars(benchmark::State &state, std::vector<T> (*make_inputs)()) {
+    const auto q = make_inputs();
+    std::array<char, 64> buf;
+    benchmark::DoNotOptimize(buf.data());
+    run_elementwise(state, q.size(), [&](std::size_t i) {
+        const auto result = to_chars(buf.data(), buf.data() + buf.size(), q[i]);
+        benchmark::DoNotOptimize(result.ptr);
+    });
+}
+BENCHMARK_CAPTURE(BM_Au_ToChars, Double, +[] { return make_speeds(); });
+BENCHMARK_CAPTURE(BM_Au_ToChars, Int32, +[] { return make_lengths(); });
+
+//
+// `operator<<`: writes into one `std::ostringstream`, which we rewind before each value, so that
+// its buffer is allocated only once.
+//
+
+template <typename T>
+void BM_Au_Stream(benchmark::State &state, std::vector<T> (*make_inputs)()) {
+    const auto q = make_inputs();
+    std::ostringstream oss;
+    run_elementwise(state, q.size(), [&](std::size_t i) {
+        oss.seekp(0);
+        oss << q[i];
+        benchmark::DoNotOptimize(oss);
+    });
+}
+BENCHMARK_CAPTURE(BM_Au_Stream, Double, +[] { return make_speeds(); });
+BENCHMARK_CAPTURE(BM_Au_Stream, Int32, +[] { return make_lengths(); });
+
+//
+// `std::format`: writes into one `std::string`, which we clear before each value, so that its
+// buffer is allocated only once.
+//
+
+#if defined(__cpp_lib_format)
+template <typename T>
+void BM_Au_StdFormat(benchmark::State &state, std::vector<T> (*make_inputs)()) {
+    const auto q = make_inputs();
+    std::string out;
+    out.reserve(64u);
+    run_elementwise(state, q.size(), [&](std::size_t i) {
+        out.clear();
+        std::format_to(std::back_inserter(out), "{}", q[i]);
+        benchmark::DoNotOptimize(out.data());
+    });
+}
+BENCHMARK_CAPTURE(BM_Au_StdFormat, Double, +[] { return make_speeds(); });
+BENCHMARK_CAPTURE(BM_Au_StdFormat, Int32, +[] { return make_lengths(); });
+#endif
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace au
+
+#endif
@@ -0,0 +1,103 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/benchmarks/benchmark_inputs.hh"
+#include "au/units/seconds.hh"
+#include "au/widened.hh"
+#include "benchmark/benchmark.h"
+
+// Benchmarks for `widened_in()`, which converts integers by rational factors using a 128-bit
+// intermediate product.  We convert `int64_t` nanoseconds to ticks of a 90 kHz clock (a factor of
+// 9 / 100'000), and compare against the usual workaround: converting via `double`.
+//
+// The "Small" inputs are small enough that the ordinary 64-bit product can't overflow.  The "Large"
+// inputs reach about 95 years, so most of them need the wider product.
+
+#if defined(__SIZEOF_INT128__)
+
+namespace au {
+namespace benchmarks {
+namespace {
+
+struct Ticks : decltype(Seconds{} / mag<90'000>()) {};
+constexpr auto ticks = QuantityMaker<Ticks>{};
+
+// Any larger, and multiplying by 9 could overflow `int64_t`.
+constexpr int64_t SMALL_NS = 1'000'000'000'000'000'000;
+constexpr int64_t LARGE_NS = 3'000'000'000'000'000'000;
+
+void BM_Raw_ConvertInt64ViaDouble(benchmark::State &state, int64_t max_ns) {
+    const auto ns = make_int64s(max_ns);
+    std::vector<int64_t> t(ns.size());
+    benchmark::DoNotOptimize(t.data());
+    run_elementwise(state, ns.size(), [&](std::size_t i) {
+        t[i] = static_cast<int64_t>(static_cast<double>(ns[i]) * 9e-5);
+    });
+}
+BENCHMARK_CAPTURE(BM_Raw_ConvertInt64ViaDouble, Small, SMALL_NS);
+BENCHMARK_CAPTURE(BM_Raw_ConvertInt64ViaDouble, Large, LARGE_NS);
+
+void BM_Raw_ConvertInt64Widened(benchmark::State &state, int64_t max_ns) {
+    const auto ns = make_int64s(max_ns);
+    std::vector<int64_t> t(ns.size());
+    benchmark::DoNotOptimize(t.data());
+    run_elementwise(state, ns.size(), [&](std::size_t i) {
+        t[i] = static_cast<int64_t>(static_cast<__int128_t>(ns[i]) * 9 / 100'000);
+    });
+}
+BENCHMARK_CAPTURE(BM_Raw_ConvertInt64Widened, Small, SMALL_NS);
+BENCHMARK_CAPTURE(BM_Raw_ConvertInt64Widened, Large, LARGE_NS);
+
+void BM_Au_ConvertInt64ViaDouble(benchmark::State &state, int64_t max_ns) {
+    const auto ns = make_all(nano(seconds), make_int64s(max_ns));
+    std::vector<int64_t> t(ns.size());
+    benchmark::DoNotOptimize(t.data());
+    run_elementwise(state, ns.size(), [&](std::size_t i) {
+        t[i] = static_cast<int64_t>(ns[i].in<double>(ticks));
+    });
+}
+BENCHMARK_CAPTURE(BM_Au_ConvertInt64ViaDouble, Small, SMALL_NS);
+BENCHMARK_CAPTURE(BM_Au_ConvertInt64ViaDouble, Large, LARGE_NS);
+
+void BM_Au_ConvertInt64Widened(benchmark::State &state, int64_t max_ns) {
+    const auto ns = make_all(nano(seconds), make_int64s(max_ns));
+    std::vector<int64_t> t(ns.size());
+    benchmark::DoNotOptimize(t.data());
+    run_elementwise(state, ns.size(), [&](std::size_t i) {
+        t[i] = widened_in(ticks, ns[i], ignore(TRUNCATION_RISK));
+    });
+}
+BENCHMARK_CAPTURE(BM_Au_ConvertInt64Widened, Small, SMALL_NS);
+BENCHMARK_CAPTURE(BM_Au_ConvertInt64Widened, Large, LARGE_NS);
+
+// The ordinary `.in()`, for reference.  Only meaningful for the small inputs: the large ones would
+// overflow.
+void BM_Au_ConvertInt64(benchmark::State &state) {
+    const auto ns = make_all(nano(seconds), make_int64s(SMALL_NS));
+    std::vector<int64_t> t(ns.size());
+    benchmark::DoNotOptimize(t.data());
+    run_elementwise(
+        state, ns.size(), [&](std::size_t i) { t[i] = ns[i].in(ticks, ignore(TRUNCATION_RISK)); });
+}
+BENCHMARK(BM_Au_ConvertInt64);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace au
+
+#endif
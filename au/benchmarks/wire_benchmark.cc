@@ -0,0 +1,126 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/benchmarks/benchmark_inputs.hh"
+#include "au/units/hours.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "au/wire.hh"
+#include "benchmark/benchmark.h"
+
+// Benchmarks for the binary wire encoding (from `"au/wire.hh"`).  We compare against a hand-rolled
+// format with the same layout: a fixed 8-byte tag, then the raw `double`, each copied with
+// `memcpy`.  Decoding a value in the destination unit should cost the same as the raw version;
+// decoding a value in an alternative unit adds a tag search and a conversion.
+
+namespace au {
+namespace benchmarks {
+namespace {
+
+using Speed = Quantity<UnitQuotient<Meters, Seconds>, double>;
+using SpeedKmh = Quantity<UnitQuotient<Kilo<Meters>, Hours>, double>;
+
+// The tag and record size for the hand-rolled format.
+constexpr uint64_t RAW_TAG = 0x1234'5678'9ABC'DEF0u;
+constexpr std::size_t RAW_RECORD_SIZE = sizeof(RAW_TAG) + sizeof(double);
+
+// Encode every value of `qs`, back to back.
+template <typename T>
+std::vector<char> encode_all(const std::vector<T> &qs) {
+    std::vector<char> buf(qs.size() * WireSize<T>::value);
+    char *ptr = buf.data();
+    for (const auto &q : qs) {
+        ptr = to_wire(ptr, buf.data() + buf.size(), q).ptr;
+    }
+    return buf;
+}
+
+void BM_Raw_Encode(benchmark::State &state) {
+    const auto raw = make_doubles();
+    std::vector<char> buf(raw.size() * RAW_RECORD_SIZE);
+    benchmark::DoNotOptimize(buf.data());
+    run_elementwise(state, raw.size(), [&](std::size_t i) {
+        char *record = buf.data() + i * RAW_RECORD_SIZE;
+        std::memcpy(record, &RAW_TAG, sizeof(RAW_TAG));
+        std::memcpy(record + sizeof(RAW_TAG), &raw[i], sizeof(double));
+    });
+}
+BENCHMARK(BM_Raw_Encode);
+
+void BM_Au_Encode(benchmark::State &state) {
+    const auto qs = make_all(meters / second, make_doubles());
+    std::vector<char> buf(qs.size() * WireSize<Speed>::value);
+    char *const last = buf.data() + buf.size();
+    benchmark::DoNotOptimize(buf.data());
+    run_elementwise(state, qs.size(), [&](std::size_t i) {
+        to_wire(buf.data() + i * WireSize<Speed>::value, last, qs[i]);
+    });
+}
+BENCHMARK(BM_Au_Encode);
+
+void BM_Raw_Decode(benchmark::State &state) {
+    const auto raw = make_doubles();
+    std::vector<char> buf(raw.size() * RAW_RECORD_SIZE);
+    for (std::size_t i = 0u; i < raw.size(); ++i) {
+        std::memcpy(buf.data() + i * RAW_RECORD_SIZE, &RAW_TAG, sizeof(RAW_TAG));
+        std::memcpy(buf.data() + i * RAW_RECORD_SIZE + sizeof(RAW_TAG), &raw[i], sizeof(double));
+    }
+    std::vector<double> v(raw.size());
+    benchmark::DoNotOptimize(v.data());
+    run_elementwise(state, v.size(), [&](std::size_t i) {
+        const char *record = buf.data() + i * RAW_RECORD_SIZE;
+        uint64_t tag;
+        std::memcpy(&tag, record, sizeof(tag));
+        if (tag == RAW_TAG) {
+            std::memcpy(&v[i], record + sizeof(RAW_TAG), sizeof(double));
+        }
+    });
+}
+BENCHMARK(BM_Raw_Decode);
+
+// Input in the destination unit: a tag check, and a `memcpy`.
+void BM_Au_Decode(benchmark::State &state) {
+    const auto buf = encode_all(make_all(meters / second, make_doubles()));
+    const char *const last = buf.data() + buf.size();
+    std::vector<Speed> v(NUM_ELEMENTS);
+    benchmark::DoNotOptimize(v.data());
+    run_elementwise(state, v.size(), [&](std::size_t i) {
+        from_wire(buf.data() + i * WireSize<Speed>::value, last, v[i]);
+    });
+}
+BENCHMARK(BM_Au_Decode);
+
+// Input in an alternative unit, which we must find and then convert.
+void BM_Au_DecodeAlternativeUnit(benchmark::State &state) {
+    const auto buf = encode_all(make_all(kilo(meters) / hour, make_doubles()));
+    const char *const last = buf.data() + buf.size();
+    std::vector<Speed> v(NUM_ELEMENTS);
+    benchmark::DoNotOptimize(v.data());
+    run_elementwise(state, v.size(), [&](std::size_t i) {
+        from_wire(buf.data() + i * WireSize<SpeedKmh>::value,
+                  last,
+                  v[i],
+                  also_accept(milli(meters) / second, kilo(meters) / hour));
+    });
+}
+BENCHMARK(BM_Au_DecodeAlternativeUnit);
+
+}  // namespace
+}  // namespace benchmarks
+}  // namespace au
@@ -0,0 +1,311 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <limits>
+#include <type_traits>
+
+#include "au/config.hh"
+#include "au/magnitude.hh"
+#include "au/stdx/type_traits.hh"
+#include "au/stdx/utility.hh"
+#include "au/utility/type_traits.hh"
+
+namespace au {
+
+//
+// `Bounded<T, Min, Max>` is a rep which holds a value of the integral type `T`, and guarantees that
+// the value lies in the closed interval `[Min, Max]`.
+//
+// Au uses these bounds whenever it assesses overflow risk.  If a conversion can't overflow for
+// _any_ value in `[Min, Max]`, then it passes the compile time overflow check (even if the full
+// range of `T` would not), and its runtime overflow check is the constant `false`.  Conversions
+// _to_ a `Bounded` rep are checked against its bounds, rather than against the full range of `T`.
+//
+// Arithmetic between `Bounded` values (`+`, `-`, `*`, `/`, and unary `-`) produces a `Bounded`
+// result, whose bounds we compute at compile time.  If those bounds don't fit in the result type
+// (or, for division, if the divisor's bounds include zero), the result is the raw type instead.
+// Any other operation --- including arithmetic with a raw number --- acts on the raw value, via the
+// implicit conversion to `T`.
+//
+template <typename T, T Min, T Max>
+class Bounded {
+    static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value,
+                  "Bounded requires a (non-bool) integral type");
+    static_assert(Min <= Max, "Lower bound must not exceed upper bound");
+
+ public:
+    // The bounds.  (These also let `Bounded` serve as the "limits" type in `overflow_boundary.hh`.)
+    static AU_DEVICE_FUNC constexpr T lower() { return Min; }
+    static AU_DEVICE_FUNC constexpr T upper() { return Max; }
+
+    // Whether the integer `x` lies within the bounds.
+    template <typename U>
+    static AU_DEVICE_FUNC constexpr bool contains(U x) {
+        return stdx::cmp_greater_equal(x, Min) && stdx::cmp_less_equal(x, Max);
+    }
+
+    // The value within the bounds which is closest to the integer `x`.
+    template <typename U>
+    static AU_DEVICE_FUNC constexpr Bounded clamp(U x) {
+        return Bounded{stdx::cmp_less(x, Min)      ? Min
+                       : stdx::cmp_greater(x, Max) ? Max
+                                                   : static_cast<T>(x)};
+    }
+
+    // The default value is the one closest to zero.
+    AU_DEVICE_FUNC constexpr Bounded() : value_{clamp(T{0}).value()} {}
+
+    // Wrap a raw value.
+    //
+    // PRECONDITION: `contains(value)`.  Use `clamp()` if you can't guarantee this.
+    AU_DEVICE_FUNC explicit constexpr Bounded(T value) : value_{value} {}
+
+    // Implicitly convert from a `Bounded` whose bounds lie within ours.
+    template <typename U,
+              U OtherMin,
+              U OtherMax,
+              std::enable_if_t<(stdx::cmp_greater_equal(OtherMin, Min) &&
+                                stdx::cmp_less_equal(OtherMax, Max)),
+                               int> = 0>
+    AU_DEVICE_FUNC constexpr Bounded(Bounded<U, OtherMin, OtherMax> other)
+        : value_{static_cast<T>(other.value())} {}
+
+    AU_DEVICE_FUNC constexpr T value() const { return value_; }
+    AU_DEVICE_FUNC constexpr operator T() const { return value_; }
+
+ private:
+    T value_;
+};
+
+// `Bounded` is a single value of `T`, so `T` is its scalar type.
+template <typename T, T Min, T Max>
+struct ScalarOfTrait<Bounded<T, Min, Max>> : stdx::type_identity<T> {};
+
+namespace detail {
+
+// `Unbounded<T>` is the raw type held by `T` if it is a `Bounded`, and `T` itself otherwise.
+template <typename T>
+struct UnboundedImpl : stdx::type_identity<T> {};
+template <typename T, T Min, T Max>
+struct UnboundedImpl<Bounded<T, Min, Max>> : stdx::type_identity<T> {};
+template <typename T>
+using Unbounded = typename UnboundedImpl<T>::type;
+
+// `IsBounded<T>` is whether `T` is a `Bounded`.
+template <typename T>
+struct IsBounded : stdx::negation<std::is_same<Unbounded<T>, T>> {};
+
+// Any computation on a `Bounded` value takes place in the (promoted) raw type.
+template <typename T, T Min, T Max>
+struct PromotedTypeImpl<Bounded<T, Min, Max>> : PromotedTypeImpl<T> {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Compile time interval arithmetic, for propagating bounds.
+//
+// Each of these computes in the type `R`.  The result is `ok` only if every input was `ok`, and no
+// step overflowed `R`.
+
+template <typename R>
+struct CheckedValue {
+    bool ok;
+    R value;
+};
+
+template <typename R>
+struct Interval {
+    bool ok;
+    R lower;
+    R upper;
+};
+
+template <typename R, typename T>
+constexpr Interval<R> interval_in(T lower, T upper) {
+    const bool ok = stdx::in_range<R>(lower) && stdx::in_range<R>(upper);
+    return {ok, ok ? static_cast<R>(lower) : R{0}, ok ? static_cast<R>(upper) : R{0}};
+}
+
+template <typename R>
+constexpr CheckedValue<R> checked_add(R a, R b) {
+    const bool overflows = stdx::cmp_greater(b, 0) ? (a > std::numeric_limits<R>::max() - b)
+                                                   : (a < std::numeric_limits<R>::lowest() - b);
+    return {!overflows, overflows ? R{0} : static_cast<R>(a + b)};
+}
+
+template <typename R>
+constexpr CheckedValue<R> checked_subtract(R a, R b) {
+    const bool overflows = stdx::cmp_greater(b, 0) ? (a < std::numeric_limits<R>::lowest() + b)
+                                                   : (a > std::numeric_limits<R>::max() + b);
+    return {!overflows, overflows ? R{0} : static_cast<R>(a - b)};
+}
+
+template <typename R>
+constexpr CheckedValue<R> checked_multiply(R a, R b) {
+    if (a == R{0} || b == R{0}) {
+        return {true, R{0}};
+    }
+    constexpr R LOWEST = std::numeric_limits<R>::lowest();
+    constexpr R MAX = std::numeric_limits<R>::max();
+    const bool overflows = stdx::cmp_greater(a, 0)
+                               ? (stdx::cmp_greater(b, 0) ? (a > MAX / b) : (b < LOWEST / a))
+                               : (stdx::cmp_greater(b, 0) ? (a < LOWEST / b) : (b < MAX / a));
+    return {!overflows, overflows ? R{0} : static_cast<R>(a * b)};
+}
+
+// PRECONDITION: `b` is not zero.
+template <typename R>
+constexpr CheckedValue<R> checked_divide(R a, R b) {
+    const bool overflows = std::is_signed<R>::value && (a == std::numeric_limits<R>::lowest()) &&
+                           (b == static_cast<R>(R{0} - R{1}));
+    return {!overflows, overflows ? R{0} : static_cast<R>(a / b)};
+}
+
+// The smallest interval containing all four (checked) corner values.
+template <typename R>
+constexpr Interval<R> hull_of_corners(CheckedValue<R> a,
+                                      CheckedValue<R> b,
+                                      CheckedValue<R> c,
+                                      CheckedValue<R> d) {
+    const R lo_ab = (a.value < b.value) ? a.value : b.value;
+    const R lo_cd = (c.value < d.value) ? c.value : d.value;
+    const R hi_ab = (a.value < b.value) ? b.value : a.value;
+    const R hi_cd = (c.value < d.value) ? d.value : c.value;
+    return {a.ok && b.ok && c.ok && d.ok,
+            (lo_ab < lo_cd) ? lo_ab : lo_cd,
+            (hi_ab < hi_cd) ? hi_cd : hi_ab};
+}
+
+template <typename R>
+constexpr Interval<R> interval_sum(Interval<R> a, Interval<R> b) {
+    const auto lower = checked_add(a.lower, b.lower);
+    const auto upper = checked_add(a.upper, b.upper);
+    return {a.ok && b.ok && lower.ok && upper.ok, lower.value, upper.value};
+}
+
+template <typename R>
+constexpr Interval<R> interval_difference(Interval<R> a, Interval<R> b) {
+    const auto lower = checked_subtract(a.lower, b.upper);
+    const auto upper = checked_subtract(a.upper, b.lower);
+    return {a.ok && b.ok && lower.ok && upper.ok, lower.value, upper.value};
+}
+
+template <typename R>
+constexpr Interval<R> interval_product(Interval<R> a, Interval<R> b) {
+    const auto result = hull_of_corners(checked_multiply(a.lower, b.lower),
+                                        checked_multiply(a.lower, b.upper),
+                                        checked_multiply(a.upper, b.lower),
+                                        checked_multiply(a.upper, b.upper));
+    return {a.ok && b.ok && result.ok, result.lower, result.upper};
+}
+
+// Integer division truncates toward zero, which is monotonic in each argument (as long as the
+// divisor keeps the same sign), so the extreme values occur at the corners.
+template <typename R>
+constexpr Interval<R> interval_quotient(Interval<R> a, Interval<R> b) {
+    const bool divisor_excludes_zero = stdx::cmp_greater(b.lower, 0) || stdx::cmp_less(b.upper, 0);
+    if (!(a.ok && b.ok && divisor_excludes_zero)) {
+        return {false, R{0}, R{0}};
+    }
+    return hull_of_corners(checked_divide(a.lower, b.lower),
+                           checked_divide(a.lower, b.upper),
+                           checked_divide(a.upper, b.lower),
+                           checked_divide(a.upper, b.upper));
+}
+
+// The smallest interval containing both `a` and `b`.
+template <typename R>
+constexpr Interval<R> interval_union(Interval<R> a, Interval<R> b) {
+    return {a.ok && b.ok,
+            (a.lower < b.lower) ? a.lower : b.lower,
+            (a.upper < b.upper) ? b.upper : a.upper};
+}
+
+// `BoundedIfOk<Ok, R, Lower, Upper>` is `Bounded<R, Lower, Upper>` if `Ok`, and `R` otherwise.
+template <bool Ok, typename R, R Lower, R Upper>
+struct BoundedIfOkImpl : stdx::type_identity<Bounded<R, Lower, Upper>> {};
+template <typename R, R Lower, R Upper>
+struct BoundedIfOkImpl<false, R, Lower, Upper> : stdx::type_identity<R> {};
+template <bool Ok, typename R, R Lower, R Upper>
+using BoundedIfOk = typename BoundedIfOkImpl<Ok, R, Lower, Upper>::type;
+
+// The common type of two `Bounded` types covers both intervals, if it can.
+template <typename T, T MinT, T MaxT, typename U, U MinU, U MaxU>
+struct CommonBoundedType {
+    using C = std::common_type_t<T, U>;
+    static constexpr auto BOUNDS = interval_union(interval_in<C>(MinT, MaxT),
+                                                  interval_in<C>(MinU, MaxU));
+    using type = BoundedIfOk<BOUNDS.ok, C, BOUNDS.lower, BOUNDS.upper>;
+};
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Arithmetic which propagates bounds.
+
+template <typename T, T MinT, T MaxT, typename U, U MinU, U MaxU>
+AU_DEVICE_FUNC constexpr auto operator+(Bounded<T, MinT, MaxT> a, Bounded<U, MinU, MaxU> b) {
+    using R = decltype(a.value() + b.value());
+    constexpr auto BOUNDS = detail::interval_sum(detail::interval_in<R>(MinT, MaxT),
+                                                 detail::interval_in<R>(MinU, MaxU));
+    return detail::BoundedIfOk<BOUNDS.ok, R, BOUNDS.lower, BOUNDS.upper>{a.value() + b.value()};
+}
+
+template <typename T, T MinT, T MaxT, typename U, U MinU, U MaxU>
+AU_DEVICE_FUNC constexpr auto operator-(Bounded<T, MinT, MaxT> a, Bounded<U, MinU, MaxU> b) {
+    using R = decltype(a.value() - b.value());
+    constexpr auto BOUNDS = detail::interval_difference(detail::interval_in<R>(MinT, MaxT),
+                                                        detail::interval_in<R>(MinU, MaxU));
+    return detail::BoundedIfOk<BOUNDS.ok, R, BOUNDS.lower, BOUNDS.upper>{a.value() - b.value()};
+}
+
+template <typename T, T MinT, T MaxT, typename U, U MinU, U MaxU>
+AU_DEVICE_FUNC constexpr auto operator*(Bounded<T, MinT, MaxT> a, Bounded<U, MinU, MaxU> b) {
+    using R = decltype(a.value() * b.value());
+    constexpr auto BOUNDS = detail::interval_product(detail::interval_in<R>(MinT, MaxT),
+                                                     detail::interval_in<R>(MinU, MaxU));
+    return detail::BoundedIfOk<BOUNDS.ok, R, BOUNDS.lower, BOUNDS.upper>{a.value() * b.value()};
+}
+
+template <typename T, T MinT, T MaxT, typename U, U MinU, U MaxU>
+AU_DEVICE_FUNC constexpr auto operator/(Bounded<T, MinT, MaxT> a, Bounded<U, MinU, MaxU> b) {
+    using R = decltype(a.value() / b.value());
+    constexpr auto BOUNDS = detail::interval_quotient(detail::interval_in<R>(MinT, MaxT),
+                                                      detail::interval_in<R>(MinU, MaxU));
+    return detail::BoundedIfOk<BOUNDS.ok, R, BOUNDS.lower, BOUNDS.upper>{a.value() / b.value()};
+}
+
+template <typename T, T Min, T Max>
+AU_DEVICE_FUNC constexpr auto operator-(Bounded<T, Min, Max> a) {
+    using R = decltype(-a.value());
+    constexpr auto BOUNDS =
+        detail::interval_difference(detail::interval_in<R>(0, 0), detail::interval_in<R>(Min, Max));
+    return detail::BoundedIfOk<BOUNDS.ok, R, BOUNDS.lower, BOUNDS.upper>{-a.value()};
+}
+
+}  // namespace au
+
+namespace std {
+
+// Mixing a `Bounded` with any other type loses the bounds.
+template <typename T, T Min, T Max, typename U>
+struct common_type<au::Bounded<T, Min, Max>, U> : common_type<T, U> {};
+template <typename T, typename U, U Min, U Max>
+struct common_type<T, au::Bounded<U, Min, Max>> : common_type<T, U> {};
+
+template <typename T, T MinT, T MaxT, typename U, U MinU, U MaxU>
+struct common_type<au::Bounded<T, MinT, MaxT>, au::Bounded<U, MinU, MaxU>>
+    : au::detail::CommonBoundedType<T, MinT, MaxT, U, MinU, MaxU> {};
+
+}  // namespace std
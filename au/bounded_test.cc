@@ -0,0 +1,212 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/bounded.hh"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "au/prefix.hh"
+#include "au/quantity.hh"
+#include "au/testing.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace au {
+
+using ::testing::Eq;
+using ::testing::IsFalse;
+using ::testing::IsTrue;
+using ::testing::StaticAssertTypeEq;
+
+struct Meters : UnitImpl<Length> {};
+constexpr auto meters = QuantityMaker<Meters>{};
+
+struct Seconds : UnitImpl<Time> {};
+constexpr auto seconds = QuantityMaker<Seconds>{};
+
+// A wheel speed, known to lie between 0 and 100 m/s.
+using WheelSpeedRep = Bounded<int16_t, 0, 100>;
+using MetersPerSecond = UnitQuotient<Meters, Seconds>;
+constexpr auto meters_per_second = QuantityMaker<MetersPerSecond>{};
+
+TEST(Bounded, ExposesBoundsAndValue) {
+    constexpr WheelSpeedRep x{42};
+    EXPECT_THAT(WheelSpeedRep::lower(), Eq(0));
+    EXPECT_THAT(WheelSpeedRep::upper(), Eq(100));
+    EXPECT_THAT(x.value(), Eq(42));
+
+    const int16_t raw = x;
+    EXPECT_THAT(raw, Eq(42));
+}
+
+TEST(Bounded, ContainsChecksBoundsForAnyIntegerType) {
+    EXPECT_THAT(WheelSpeedRep::contains(0), IsTrue());
+    EXPECT_THAT(WheelSpeedRep::contains(100u), IsTrue());
+    EXPECT_THAT(WheelSpeedRep::contains(-1), IsFalse());
+    EXPECT_THAT(WheelSpeedRep::contains(int64_t{65'536 + 50}), IsFalse());
+}
+
+TEST(Bounded, ClampProducesClosestValueInBounds) {
+    EXPECT_THAT(WheelSpeedRep::clamp(-5).value(), Eq(0));
+    EXPECT_THAT(WheelSpeedRep::clamp(55).value(), Eq(55));
+    EXPECT_THAT(WheelSpeedRep::clamp(int64_t{65'536 + 50}).value(), Eq(100));
+}
+
+TEST(Bounded, DefaultValueIsClosestToZero) {
+    EXPECT_THAT(WheelSpeedRep{}.value(), Eq(0));
+    EXPECT_THAT((Bounded<int, 5, 10>{}.value()), Eq(5));
+    EXPECT_THAT((Bounded<int, -10, -5>{}.value()), Eq(-5));
+}
+
+TEST(Bounded, ImplicitlyConvertsOnlyToWiderBounds) {
+    EXPECT_THAT((std::is_convertible<WheelSpeedRep, Bounded<int32_t, -1, 100>>::value), IsTrue());
+    EXPECT_THAT((std::is_convertible<WheelSpeedRep, Bounded<int16_t, 1, 100>>::value), IsFalse());
+    EXPECT_THAT((std::is_convertible<WheelSpeedRep, Bounded<int16_t, 0, 99>>::value), IsFalse());
+
+    const Bounded<int32_t, -1, 100> wide = WheelSpeedRep{7};
+    EXPECT_THAT(wide.value(), Eq(7));
+}
+
+TEST(Bounded, ArithmeticPropagatesBounds) {
+    constexpr Bounded<int16_t, 0, 100> a{60};
+    constexpr Bounded<int16_t, -3, 2> b{-2};
+
+    StaticAssertTypeEq<decltype(a + b), Bounded<int, -3, 102>>();
+    StaticAssertTypeEq<decltype(a - b), Bounded<int, -2, 103>>();
+    StaticAssertTypeEq<decltype(a * b), Bounded<int, -300, 200>>();
+    StaticAssertTypeEq<decltype(-b), Bounded<int, -2, 3>>();
+
+    EXPECT_THAT((a + b).value(), Eq(58));
+    EXPECT_THAT((a - b).value(), Eq(62));
+    EXPECT_THAT((a * b).value(), Eq(-120));
+    EXPECT_THAT((-b).value(), Eq(2));
+}
+
+TEST(Bounded, DivisionPropagatesBoundsOnlyIfDivisorExcludesZero) {
+    constexpr Bounded<int, -100, 100> a{-99};
+    constexpr Bounded<int, 2, 10> positive{4};
+    constexpr Bounded<int, -1, 1> maybe_zero{1};
+
+    StaticAssertTypeEq<decltype(a / positive), Bounded<int, -50, 50>>();
+    EXPECT_THAT((a / positive).value(), Eq(-24));
+
+    StaticAssertTypeEq<decltype(a / maybe_zero), int>();
+}
+
+TEST(Bounded, ArithmeticFallsBackToRawTypeIfBoundsDoNotFit) {
+    using Big = Bounded<int32_t, 0, std::numeric_limits<int32_t>::max()>;
+    StaticAssertTypeEq<decltype(Big{} + Big{}), int32_t>();
+    StaticAssertTypeEq<decltype(Big{} * Big{}), int32_t>();
+    StaticAssertTypeEq<decltype(-Bounded<int32_t, std::numeric_limits<int32_t>::min(), 0>{}),
+                       int32_t>();
+
+    // Unsigned subtraction could wrap around.
+    using U = Bounded<uint32_t, 0u, 10u>;
+    StaticAssertTypeEq<decltype(U{} - U{}), uint32_t>();
+}
+
+TEST(Bounded, ArithmeticWithRawNumbersProducesRawResult) {
+    StaticAssertTypeEq<decltype(WheelSpeedRep{} * 2), int>();
+    StaticAssertTypeEq<decltype(WheelSpeedRep{} + 2.0), double>();
+}
+
+TEST(Bounded, CommonTypeCoversBothIntervals) {
+    StaticAssertTypeEq<std::common_type_t<WheelSpeedRep, Bounded<int32_t, -5, 5>>,
+                       Bounded<int32_t, -5, 100>>();
+    StaticAssertTypeEq<std::common_type_t<WheelSpeedRep, int32_t>, int32_t>();
+    StaticAssertTypeEq<std::common_type_t<double, WheelSpeedRep>, double>();
+}
+
+TEST(BoundedQuantity, ArithmeticPropagatesBounds) {
+    const auto v = meters_per_second(WheelSpeedRep{30});
+    const auto t = seconds(Bounded<int16_t, 0, 10>{2});
+
+    const auto sum = v + v;
+    StaticAssertTypeEq<decltype(sum), const Quantity<MetersPerSecond, Bounded<int, 0, 200>>>();
+    EXPECT_THAT(sum.in(meters_per_second).value(), Eq(60));
+
+    const auto d = v * t;
+    StaticAssertTypeEq<decltype(d), const Quantity<Meters, Bounded<int, 0, 1'000>>>();
+    EXPECT_THAT(d.in(meters).value(), Eq(60));
+}
+
+TEST(BoundedQuantity, BoundsProveConversionSafeWhereRawTypeDoesNot) {
+    using Factor = UnitRatio<MetersPerSecond, Centi<MetersPerSecond>>;
+    using RawOp =
+        detail::ConversionForRepsAndFactor<detail::UseStaticCast, int16_t, int16_t, Factor>;
+    using BoundedOp =
+        detail::ConversionForRepsAndFactor<detail::UseStaticCast, WheelSpeedRep, int16_t, Factor>;
+
+    // `int16_t` overflows at 328 m/s, which is too close for comfort...
+    EXPECT_THAT(detail::OverflowRiskAcceptablyLow<RawOp>::value, IsFalse());
+
+    // ...but the bounds guarantee that we never get there, so we need no runtime check at all.
+    EXPECT_THAT(detail::CanOverflowAbove<BoundedOp>::value, IsFalse());
+    EXPECT_THAT(detail::CanOverflowBelow<BoundedOp>::value, IsFalse());
+
+    const auto v = meters_per_second(WheelSpeedRep{100});
+    EXPECT_THAT(v.in<int16_t>(centi(meters_per_second), check_for(ALL_RISKS)),
+                SameTypeAndValue(int16_t{10'000}));
+    EXPECT_THAT(will_conversion_overflow<int16_t>(v, centi(meters_per_second)), IsFalse());
+}
+
+TEST(BoundedQuantity, ImplicitConversionPermittedWhenBoundsProveItSafe) {
+    using Raw = Quantity<MetersPerSecond, int16_t>;
+    using WheelSpeed = Quantity<MetersPerSecond, WheelSpeedRep>;
+    using CentiSpeed = Quantity<Centi<MetersPerSecond>, int16_t>;
+
+    EXPECT_THAT((std::is_convertible<Raw, CentiSpeed>::value), IsFalse());
+    EXPECT_THAT((std::is_convertible<WheelSpeed, CentiSpeed>::value), IsTrue());
+
+    const CentiSpeed v = meters_per_second(WheelSpeedRep{12});
+    EXPECT_THAT(v, SameTypeAndValue(centi(meters_per_second)(int16_t{1'200})));
+
+    CentiSpeed w;
+    w = meters_per_second(WheelSpeedRep{3});
+    EXPECT_THAT(w, SameTypeAndValue(centi(meters_per_second)(int16_t{300})));
+}
+
+TEST(BoundedQuantity, BoundsThatDoNotProveSafetyStillGetRuntimeChecks) {
+    using Wide = Bounded<int16_t, 0, 1'000>;
+    using Factor = UnitRatio<MetersPerSecond, Centi<MetersPerSecond>>;
+    using Op = detail::ConversionForRepsAndFactor<detail::UseStaticCast, Wide, int16_t, Factor>;
+    EXPECT_THAT(detail::CanOverflowAbove<Op>::value, IsTrue());
+
+    EXPECT_THAT(will_conversion_overflow<int16_t>(meters_per_second(Wide{327}),
+                                                  centi(meters_per_second)),
+                IsFalse());
+    EXPECT_THAT(will_conversion_overflow<int16_t>(meters_per_second(Wide{328}),
+                                                  centi(meters_per_second)),
+                IsTrue());
+}
+
+TEST(BoundedQuantity, ConversionToBoundedRepChecksAgainstBounds) {
+    using Cm = Bounded<int32_t, 0, 250>;
+
+    EXPECT_THAT(will_conversion_overflow<Cm>(meters(2), centi(meters)), IsFalse());
+    EXPECT_THAT(will_conversion_overflow<Cm>(meters(3), centi(meters)), IsTrue());
+    EXPECT_THAT(will_conversion_overflow<Cm>(meters(-1), centi(meters)), IsTrue());
+
+    const auto x = meters(2).as<Cm>(centi(meters), ignore(OVERFLOW_RISK));
+    StaticAssertTypeEq<decltype(x), const Quantity<Centi<Meters>, Cm>>();
+    EXPECT_THAT(x.in(centi(meters)).value(), Eq(200));
+
+    // Narrower bounds convert into wider bounds with no risk.
+    const auto y = meters(Bounded<int32_t, 0, 2>{1}).as<Cm>(centi(meters), check_for(ALL_RISKS));
+    EXPECT_THAT(y.in(centi(meters)).value(), Eq(100));
+}
+
+}  // namespace au
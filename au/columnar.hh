@@ -0,0 +1,525 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#include "au/containers.hh"
+#include "au/dyn_quantity.hh"
+#include "au/magnitude.hh"
+#include "au/quantity.hh"
+#include "au/unit_id.hh"
+#include "au/unit_of_measure.hh"
+#include "au/wire.hh"
+
+// A columnar file format for streams of quantities, which can be read in place.
+//
+// A file holds named columns.  Each column header records the column's unit (its `unit_id()`,
+// dimension, magnitude, and label), its rep type, and where its values are.  The values themselves
+// are raw, contiguous reps, each column starting on a 64-byte boundary.  Everything is stored in
+// the writer's native byte order, so the reader doesn't need to decode anything: it can work
+// directly on the bytes of a memory-mapped file.
+//
+// `ColumnarReader::column<R>(name, unit)` gives a `ColumnView<U, R>`.  If the stored unit and rep
+// match the requested ones, the view points straight at the stored values, and `span()` gives them
+// as a zero-copy `QuantitySpan<U, R>`.  Otherwise, if the dimensions match and `R` is a floating
+// point type, the view converts each value lazily, when it's accessed.
+
+namespace au {
+
+class ColumnarWriter;
+class ColumnarReader;
+
+template <typename U, typename R>
+class ColumnView;
+
+enum class ColumnarOutcome {
+    OK,
+    ERR_NAME_TOO_LONG,
+    ERR_DUPLICATE_COLUMN,
+    ERR_TRUNCATED_FILE,
+    ERR_NOT_A_COLUMNAR_FILE,
+    ERR_WRONG_BYTE_ORDER,
+    ERR_UNSUPPORTED_VERSION,
+    ERR_CORRUPT_COLUMN_HEADER,
+    ERR_NO_SUCH_COLUMN,
+    ERR_DIMENSION_MISMATCH,
+    ERR_UNSUPPORTED_CONVERSION,
+    ERR_MISALIGNED_DATA,
+};
+
+template <typename T>
+struct ColumnarResult {
+    ColumnarOutcome outcome;
+
+    // Only valid/meaningful if `outcome` is `OK`.
+    T value = {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// The file layout.
+//
+// A file is a `ColumnarFileHeader`, then `num_columns` consecutive `ColumnarColumnHeader`s, then
+// the column values.  Every field has a fixed size, and no struct has any padding, so each struct
+// is stored as its exact in-memory image.
+
+struct ColumnarFileHeader {
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304u;
+    static constexpr uint32_t CURRENT_VERSION = 1u;
+
+    char magic[8];  // "AUCOLUMN"
+    uint32_t byte_order_mark;
+    uint32_t version;
+    uint64_t num_columns;
+};
+
+struct ColumnarBasePower {
+    int64_t base_dim_index;
+    int64_t exp_num;
+    int64_t exp_den;
+};
+
+struct ColumnarColumnHeader {
+    // The longest name (or label) we can store, not counting the terminating null character.
+    static constexpr std::size_t MAX_NAME_LENGTH = 47u;
+
+    char name[MAX_NAME_LENGTH + 1u];
+
+    // The `unit_label()` of the unit, for humans.  Truncated if it's too long.
+    char unit_label[MAX_NAME_LENGTH + 1u];
+
+    uint64_t unit_id;
+
+    // What kind of number the rep is, and its size; the same code as the wire encoding uses.
+    uint64_t rep_code;
+
+    // The number of values, and the offset of the first one from the start of the file.
+    uint64_t count;
+    uint64_t offset;
+
+    // The magnitude of the unit, relative to the coherent unit of its dimension.
+    double magnitude;
+
+    uint64_t num_base_powers;
+    ColumnarBasePower base_powers[DynDimension::MAX_BASE_DIMENSIONS];
+};
+
+static_assert(sizeof(ColumnarFileHeader) == 24u, "ColumnarFileHeader must have no padding");
+static_assert(sizeof(ColumnarColumnHeader) == 360u, "ColumnarColumnHeader must have no padding");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Implementation details below
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+constexpr char COLUMNAR_MAGIC[8] = {'A', 'U', 'C', 'O', 'L', 'U', 'M', 'N'};
+
+// Every column's values start at a multiple of this many bytes from the start of the file.
+constexpr std::size_t COLUMNAR_ALIGNMENT = 64u;
+
+constexpr uint64_t round_up_to_column_alignment(uint64_t n) {
+    return (n + COLUMNAR_ALIGNMENT - 1u) / COLUMNAR_ALIGNMENT * COLUMNAR_ALIGNMENT;
+}
+
+template <typename R>
+struct IsColumnarRep : stdx::bool_constant<std::is_arithmetic<R>::value &&
+                                           !std::is_same<R, bool>::value &&
+                                           !std::is_same<R, long double>::value> {};
+
+// A function which reads the `i`th value of a column, as an `R`.
+template <typename R>
+using ColumnLoader = R (*)(const char *, std::size_t);
+
+// The `ColumnLoader` for columns whose rep is `SourceR`.
+template <typename SourceR, typename R>
+R load_column_value(const char *values, std::size_t i) {
+    SourceR x;
+    std::memcpy(&x, values + i * sizeof(SourceR), sizeof(SourceR));
+    return static_cast<R>(x);
+}
+
+// The loader for the rep with `rep_code`, or `nullptr` if there's no such rep.
+template <typename R>
+ColumnLoader<R> column_loader(uint64_t rep_code) {
+    switch (rep_code) {
+        case wire_rep_code<float>():
+            return &load_column_value<float, R>;
+        case wire_rep_code<double>():
+            return &load_column_value<double, R>;
+        case wire_rep_code<int8_t>():
+            return &load_column_value<int8_t, R>;
+        case wire_rep_code<int16_t>():
+            return &load_column_value<int16_t, R>;
+        case wire_rep_code<int32_t>():
+            return &load_column_value<int32_t, R>;
+        case wire_rep_code<int64_t>():
+            return &load_column_value<int64_t, R>;
+        case wire_rep_code<uint8_t>():
+            return &load_column_value<uint8_t, R>;
+        case wire_rep_code<uint16_t>():
+            return &load_column_value<uint16_t, R>;
+        case wire_rep_code<uint32_t>():
+            return &load_column_value<uint32_t, R>;
+        case wire_rep_code<uint64_t>():
+            return &load_column_value<uint64_t, R>;
+        default:
+            return nullptr;
+    }
+}
+
+inline std::size_t rep_size_from_code(uint64_t rep_code) {
+    return static_cast<std::size_t>(rep_code & 0xFFu);
+}
+
+// Copy `str` into `dst`, truncating if necessary, and null-padding the rest.
+inline void copy_column_name(char (&dst)[ColumnarColumnHeader::MAX_NAME_LENGTH + 1u],
+                             const char *str) {
+    std::memset(dst, 0, sizeof(dst));
+    for (std::size_t i = 0u; i < ColumnarColumnHeader::MAX_NAME_LENGTH && str[i] != '\0'; ++i) {
+        dst[i] = str[i];
+    }
+}
+
+// Whether the stored dimension of a column is the same as `DynDimension` `dim`.
+inline bool column_has_dimension(const ColumnarColumnHeader &header, const DynDimension &dim) {
+    if (header.num_base_powers != dim.size()) {
+        return false;
+    }
+    for (std::size_t i = 0u; i < dim.size(); ++i) {
+        const auto &stored = header.base_powers[i];
+        if (stored.base_dim_index != dim[i].base_dim_index || stored.exp_num != dim[i].exp_num ||
+            stored.exp_den != dim[i].exp_den) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `ColumnarWriter`: collects columns, and writes them out as a columnar file.
+
+class ColumnarWriter {
+ public:
+    // Add a column, named `name`, holding `values`.
+    //
+    // The writer doesn't copy the values: they must stay alive until the last call to `write()`.
+    template <typename U, typename R>
+    ColumnarOutcome add_column(const char *name, QuantitySpan<U, R> values) {
+        static_assert(detail::IsColumnarRep<R>::value,
+                      "Columns must hold floating point (except long double) or integral "
+                      "(except bool) reps");
+
+        if (std::strlen(name) > ColumnarColumnHeader::MAX_NAME_LENGTH) {
+            return ColumnarOutcome::ERR_NAME_TOO_LONG;
+        }
+        for (const auto &column : columns_) {
+            if (std::strcmp(column.header.name, name) == 0) {
+                return ColumnarOutcome::ERR_DUPLICATE_COLUMN;
+            }
+        }
+
+        PendingColumn column{};
+        auto &header = column.header;
+        detail::copy_column_name(header.name, name);
+        detail::copy_column_name(header.unit_label, unit_label(U{}));
+        header.unit_id = UnitId<U>::value;
+        header.rep_code = detail::wire_rep_code<R>();
+        header.count = values.size();
+        header.magnitude = get_value<double>(detail::MagT<U>{});
+
+        constexpr DynDimension dim{detail::DimT<U>{}};
+        header.num_base_powers = dim.size();
+        for (std::size_t i = 0u; i < dim.size(); ++i) {
+            header.base_powers[i] = {dim[i].base_dim_index, dim[i].exp_num, dim[i].exp_den};
+        }
+
+        column.values = reinterpret_cast<const char *>(values.data_in(U{}));
+        columns_.push_back(column);
+        return ColumnarOutcome::OK;
+    }
+
+    // Add a column, named `name`, holding the values of `v`.  `v` must outlive `write()`.
+    template <typename U, typename R, typename Alloc>
+    ColumnarOutcome add_column(const char *name, const QuantityVector<U, R, Alloc> &v) {
+        return add_column(name, make_quantity_span<U>(v.data_in(U{}), v.size()));
+    }
+
+    // The size of the file which `write()` will produce.
+    std::size_t size_in_bytes() const {
+        uint64_t size = first_column_offset();
+        for (const auto &column : columns_) {
+            size = detail::round_up_to_column_alignment(size) + column_size_in_bytes(column);
+        }
+        return static_cast<std::size_t>(size);
+    }
+
+    // Write the whole file to `out`.
+    void write(std::ostream &out) const {
+        ColumnarFileHeader file_header{};
+        std::memcpy(file_header.magic, detail::COLUMNAR_MAGIC, sizeof(file_header.magic));
+        file_header.byte_order_mark = ColumnarFileHeader::BYTE_ORDER_MARK;
+        file_header.version = ColumnarFileHeader::CURRENT_VERSION;
+        file_header.num_columns = columns_.size();
+        write_bytes(out, &file_header, sizeof(file_header));
+
+        uint64_t offset = first_column_offset();
+        for (const auto &column : columns_) {
+            offset = detail::round_up_to_column_alignment(offset);
+            ColumnarColumnHeader header = column.header;
+            header.offset = offset;
+            write_bytes(out, &header, sizeof(header));
+            offset += column_size_in_bytes(column);
+        }
+
+        uint64_t position = first_column_offset();
+        for (const auto &column : columns_) {
+            const char padding[detail::COLUMNAR_ALIGNMENT] = {};
+            const auto aligned = detail::round_up_to_column_alignment(position);
+            write_bytes(out, padding, static_cast<std::size_t>(aligned - position));
+            write_bytes(out, column.values, static_cast<std::size_t>(column_size_in_bytes(column)));
+            position = aligned + column_size_in_bytes(column);
+        }
+    }
+
+ private:
+    struct PendingColumn {
+        ColumnarColumnHeader header;
+        const char *values;
+    };
+
+    static uint64_t column_size_in_bytes(const PendingColumn &column) {
+        return column.header.count * detail::rep_size_from_code(column.header.rep_code);
+    }
+
+    uint64_t first_column_offset() const {
+        return sizeof(ColumnarFileHeader) + columns_.size() * sizeof(ColumnarColumnHeader);
+    }
+
+    static void write_bytes(std::ostream &out, const void *data, std::size_t n) {
+        out.write(static_cast<const char *>(data), static_cast<std::streamsize>(n));
+    }
+
+    std::vector<PendingColumn> columns_;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `ColumnView<U, R>`: the values of one column, as quantities of unit `U` and rep `R`.
+
+template <typename U, typename R>
+class ColumnView {
+ public:
+    using Unit = U;
+    using Rep = R;
+    using value_type = Quantity<U, R>;
+    using size_type = std::size_t;
+    static constexpr auto unit = Unit{};
+
+    // An empty view.
+    ColumnView() = default;
+
+    size_type size() const { return size_; }
+    bool empty() const { return size_ == 0u; }
+
+    // Whether the stored values are already in unit `U` and rep `R`, so no conversion is needed.
+    bool is_zero_copy() const { return is_zero_copy_; }
+
+    // The stored values, without copying.
+    //
+    // Precondition: `is_zero_copy()`.
+    QuantitySpan<U, R> span() const { return make_quantity_span<U>(values_, size_); }
+
+    // Element access, by value, converting the stored value if necessary.
+    Quantity<U, R> operator[](size_type i) const {
+        if (is_zero_copy_) {
+            return make_quantity<U>(values_[i]);
+        }
+        const R stored = (loader_ == nullptr) ? values_[i] : loader_(bytes_, i);
+        return make_quantity<U>(static_cast<R>(stored * factor_));
+    }
+
+ private:
+    friend class ColumnarReader;
+
+    // Read the stored values in place: as they are (if `factor` is `nullptr`), or scaled by it.
+    ColumnView(const R *values, size_type size, const R *factor)
+        : values_{values},
+          size_{size},
+          is_zero_copy_{factor == nullptr},
+          factor_{(factor == nullptr) ? R{1} : *factor} {}
+
+    // Read each stored value with `loader`, and scale it by `factor`.
+    ColumnView(const char *bytes, size_type size, detail::ColumnLoader<R> loader, R factor)
+        : bytes_{bytes}, size_{size}, is_zero_copy_{false}, loader_{loader}, factor_{factor} {}
+
+    // If the stored rep is `R`, and suitably aligned, we read the values in place.
+    const R *values_ = nullptr;
+
+    // Otherwise, we need the raw bytes, and a loader for their rep.
+    const char *bytes_ = nullptr;
+
+    size_type size_ = 0u;
+    bool is_zero_copy_ = true;
+    detail::ColumnLoader<R> loader_ = nullptr;
+    R factor_ = R{1};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `ColumnarReader`: reads columns in place, from the bytes of a columnar file.
+
+class ColumnarReader {
+ public:
+    // A reader with no columns.
+    ColumnarReader() = default;
+
+    // Check the headers of the file whose bytes are `[data, data + size)`, and make a reader.
+    //
+    // The reader doesn't copy the bytes: they must stay alive (and mapped) as long as the reader,
+    // or any view it returns, is in use.  To read columns in place, `data` must be suitably aligned
+    // for their reps; the start of a memory-mapped file always is.
+    static ColumnarResult<ColumnarReader> open(const void *data, std::size_t size) {
+        const char *bytes = static_cast<const char *>(data);
+
+        if (size < sizeof(ColumnarFileHeader)) {
+            return {ColumnarOutcome::ERR_TRUNCATED_FILE};
+        }
+        ColumnarFileHeader file_header;
+        std::memcpy(&file_header, bytes, sizeof(file_header));
+        if (std::memcmp(file_header.magic, detail::COLUMNAR_MAGIC, sizeof(file_header.magic)) !=
+            0) {
+            return {ColumnarOutcome::ERR_NOT_A_COLUMNAR_FILE};
+        }
+        if (file_header.byte_order_mark != ColumnarFileHeader::BYTE_ORDER_MARK) {
+            return {ColumnarOutcome::ERR_WRONG_BYTE_ORDER};
+        }
+        if (file_header.version != ColumnarFileHeader::CURRENT_VERSION) {
+            return {ColumnarOutcome::ERR_UNSUPPORTED_VERSION};
+        }
+        const std::size_t max_columns =
+            (size - sizeof(ColumnarFileHeader)) / sizeof(ColumnarColumnHeader);
+        if (file_header.num_columns > max_columns) {
+            return {ColumnarOutcome::ERR_TRUNCATED_FILE};
+        }
+
+        ColumnarReader reader{bytes, static_cast<std::size_t>(file_header.num_columns)};
+        for (std::size_t i = 0u; i < reader.num_columns(); ++i) {
+            const auto outcome = check_column_header(reader.column_header(i), size);
+            if (outcome != ColumnarOutcome::OK) {
+                return {outcome};
+            }
+        }
+        return {ColumnarOutcome::OK, reader};
+    }
+
+    std::size_t num_columns() const { return num_columns_; }
+
+    // A copy of the header of the `i`th column, for inspection.
+    //
+    // Precondition: `i < num_columns()`.
+    ColumnarColumnHeader column_header(std::size_t i) const {
+        ColumnarColumnHeader header;
+        std::memcpy(&header, header_bytes(i), sizeof(header));
+        return header;
+    }
+
+    // The column named `name`, as quantities in `unit` with rep `R`.
+    //
+    // If the stored unit and rep are exactly `unit` and `R`, the result refers to the stored values
+    // in place.  Otherwise, it converts each value on access, which needs `R` to be a floating
+    // point type.
+    template <typename R, typename UnitSlot>
+    ColumnarResult<ColumnView<AssociatedUnit<UnitSlot>, R>> column(const char *name,
+                                                                   UnitSlot) const {
+        using U = AssociatedUnit<UnitSlot>;
+        static_assert(IsUnit<U>::value, "Invalid type passed to unit slot");
+
+        std::size_t i = 0u;
+        while (i < num_columns_ && std::strcmp(header_bytes(i), name) != 0) {
+            ++i;
+        }
+        if (i == num_columns_) {
+            return {ColumnarOutcome::ERR_NO_SUCH_COLUMN};
+        }
+
+        const auto header = column_header(i);
+        constexpr DynDimension dim{detail::DimT<U>{}};
+        if (!detail::column_has_dimension(header, dim)) {
+            return {ColumnarOutcome::ERR_DIMENSION_MISMATCH};
+        }
+
+        const char *values = bytes_ + header.offset;
+        const auto count = static_cast<std::size_t>(header.count);
+        const bool is_same_rep = (header.rep_code == detail::wire_rep_code<R>());
+        const bool is_aligned = (reinterpret_cast<std::uintptr_t>(values) % alignof(R) == 0u);
+        if (is_same_rep && header.unit_id == UnitId<U>::value) {
+            if (!is_aligned) {
+                return {ColumnarOutcome::ERR_MISALIGNED_DATA};
+            }
+            return {ColumnarOutcome::OK,
+                    ColumnView<U, R>{reinterpret_cast<const R *>(values), count, nullptr}};
+        }
+
+        if (!std::is_floating_point<R>::value) {
+            return {ColumnarOutcome::ERR_UNSUPPORTED_CONVERSION};
+        }
+        const auto factor =
+            static_cast<R>(header.magnitude / get_value<double>(detail::MagT<U>{}));
+        if (is_same_rep && is_aligned) {
+            return {ColumnarOutcome::OK,
+                    ColumnView<U, R>{reinterpret_cast<const R *>(values), count, &factor}};
+        }
+        return {ColumnarOutcome::OK,
+                ColumnView<U, R>{
+                    values, count, detail::column_loader<R>(header.rep_code), factor}};
+    }
+
+ private:
+    ColumnarReader(const char *bytes, std::size_t num_columns)
+        : bytes_{bytes}, num_columns_{num_columns} {}
+
+    const char *header_bytes(std::size_t i) const {
+        return bytes_ + sizeof(ColumnarFileHeader) + i * sizeof(ColumnarColumnHeader);
+    }
+
+    static ColumnarOutcome check_column_header(const ColumnarColumnHeader &header,
+                                               std::size_t file_size) {
+        const bool is_name_terminated =
+            std::memchr(header.name, '\0', sizeof(header.name)) != nullptr;
+        const bool is_known_rep = detail::column_loader<double>(header.rep_code) != nullptr;
+        if (!is_name_terminated || !is_known_rep ||
+            header.num_base_powers > DynDimension::MAX_BASE_DIMENSIONS ||
+            header.offset % detail::COLUMNAR_ALIGNMENT != 0u) {
+            return ColumnarOutcome::ERR_CORRUPT_COLUMN_HEADER;
+        }
+
+        const auto rep_size = detail::rep_size_from_code(header.rep_code);
+        if (header.offset > file_size || header.count > (file_size - header.offset) / rep_size) {
+            return ColumnarOutcome::ERR_TRUNCATED_FILE;
+        }
+        return ColumnarOutcome::OK;
+    }
+
+    const char *bytes_ = nullptr;
+    std::size_t num_columns_ = 0u;
+};
+
+}  // namespace au
@@ -0,0 +1,204 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/columnar.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/feet.hh"
+#include "au/units/hours.hh"
+#include "au/units/meters.hh"
+#include "au/units/minutes.hh"
+#include "au/units/seconds.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace au {
+namespace {
+
+using ::testing::DoubleEq;
+using ::testing::Eq;
+using ::testing::IsFalse;
+using ::testing::IsTrue;
+using ::testing::StrEq;
+
+// The bytes of a file, held in storage aligned well enough to read any column in place (as a
+// memory-mapped file would be).
+class FileBytes {
+ public:
+    explicit FileBytes(const ColumnarWriter &writer) {
+        std::ostringstream out;
+        writer.write(out);
+        const std::string bytes = out.str();
+        size_ = bytes.size();
+        storage_.resize((size_ + sizeof(uint64_t) - 1u) / sizeof(uint64_t));
+        std::memcpy(storage_.data(), bytes.data(), size_);
+    }
+
+    char *data() { return reinterpret_cast<char *>(storage_.data()); }
+    std::size_t size() const { return size_; }
+
+    ColumnarReader open() {
+        const auto result = ColumnarReader::open(data(), size());
+        EXPECT_THAT(result.outcome, Eq(ColumnarOutcome::OK));
+        return result.value;
+    }
+
+ private:
+    std::vector<uint64_t> storage_;
+    std::size_t size_ = 0u;
+};
+
+// A file with a speed column (in km/h, as `double`), and a time column (in seconds, as `int32_t`).
+ColumnarWriter make_writer(const QuantityVector<UnitQuotient<Kilo<Meters>, Hours>, double> &speeds,
+                           const QuantityVector<Seconds, int32_t> &times) {
+    ColumnarWriter writer;
+    EXPECT_THAT(writer.add_column("speed", speeds), Eq(ColumnarOutcome::OK));
+    EXPECT_THAT(writer.add_column("time", times), Eq(ColumnarOutcome::OK));
+    return writer;
+}
+
+TEST(ColumnarWriter, SizeInBytesMatchesWrittenSize) {
+    const QuantityVector<UnitQuotient<Kilo<Meters>, Hours>, double> speeds{
+        (kilo(meters) / hour)(36.0)};
+    const QuantityVector<Seconds, int32_t> times{seconds(1), seconds(2), seconds(3)};
+    const auto writer = make_writer(speeds, times);
+
+    std::ostringstream out;
+    writer.write(out);
+    EXPECT_THAT(out.str().size(), Eq(writer.size_in_bytes()));
+}
+
+TEST(ColumnarWriter, RejectsLongAndDuplicateNames) {
+    const QuantityVector<Meters, float> v{meters(1.0f)};
+    ColumnarWriter writer;
+
+    EXPECT_THAT(writer.add_column("x", v), Eq(ColumnarOutcome::OK));
+    EXPECT_THAT(writer.add_column("x", v), Eq(ColumnarOutcome::ERR_DUPLICATE_COLUMN));
+    EXPECT_THAT(writer.add_column(std::string(48u, 'a').c_str(), v),
+                Eq(ColumnarOutcome::ERR_NAME_TOO_LONG));
+}
+
+TEST(ColumnarReader, ColumnHeadersRecordTheUnit) {
+    const QuantityVector<UnitQuotient<Kilo<Meters>, Hours>, double> speeds{
+        (kilo(meters) / hour)(36.0)};
+    const QuantityVector<Seconds, int32_t> times{seconds(1)};
+    FileBytes file{make_writer(speeds, times)};
+    const auto reader = file.open();
+
+    ASSERT_THAT(reader.num_columns(), Eq(2u));
+    const auto header = reader.column_header(0u);
+    EXPECT_THAT(header.name, StrEq("speed"));
+    EXPECT_THAT(header.unit_label, StrEq("km / h"));
+    EXPECT_THAT(header.unit_id, Eq(unit_id(kilo(meters) / hour)));
+    EXPECT_THAT(header.magnitude, DoubleEq(1.0 / 3.6));
+    EXPECT_THAT(header.count, Eq(1u));
+    EXPECT_THAT(header.offset % 64u, Eq(0u));
+}
+
+TEST(ColumnarReader, MatchingUnitAndRepGivesZeroCopySpan) {
+    const QuantityVector<UnitQuotient<Kilo<Meters>, Hours>, double> speeds{
+        (kilo(meters) / hour)(36.0), (kilo(meters) / hour)(72.0)};
+    const QuantityVector<Seconds, int32_t> times{seconds(1), seconds(2), seconds(3)};
+    FileBytes file{make_writer(speeds, times)};
+    const auto reader = file.open();
+
+    const auto result = reader.column<int32_t>("time", seconds);
+    ASSERT_THAT(result.outcome, Eq(ColumnarOutcome::OK));
+    ASSERT_THAT(result.value.is_zero_copy(), IsTrue());
+
+    const auto span = result.value.span();
+    ASSERT_THAT(span.size(), Eq(3u));
+    EXPECT_THAT(span[2], SameTypeAndValue(seconds(int32_t{3})));
+    EXPECT_THAT(span.data_in(seconds),
+                Eq(reinterpret_cast<const int32_t *>(file.data() +
+                                                     reader.column_header(1u).offset)));
+}
+
+TEST(ColumnarReader, MismatchedUnitGivesLazilyConvertedView) {
+    const QuantityVector<UnitQuotient<Kilo<Meters>, Hours>, double> speeds{
+        (kilo(meters) / hour)(36.0), (kilo(meters) / hour)(72.0)};
+    const QuantityVector<Seconds, int32_t> times{seconds(1)};
+    FileBytes file{make_writer(speeds, times)};
+    const auto reader = file.open();
+
+    const auto result = reader.column<double>("speed", meters / second);
+    ASSERT_THAT(result.outcome, Eq(ColumnarOutcome::OK));
+    const auto &speeds_si = result.value;
+
+    EXPECT_THAT(speeds_si.is_zero_copy(), IsFalse());
+    ASSERT_THAT(speeds_si.size(), Eq(2u));
+    EXPECT_THAT(speeds_si[0].in(meters / second), DoubleEq(10.0));
+    EXPECT_THAT(speeds_si[1].in(meters / second), DoubleEq(20.0));
+}
+
+TEST(ColumnarReader, ConvertsIntegralColumnsToFloatingPointReps) {
+    const QuantityVector<UnitQuotient<Kilo<Meters>, Hours>, double> speeds{};
+    const QuantityVector<Seconds, int32_t> times{seconds(90), seconds(-45)};
+    FileBytes file{make_writer(speeds, times)};
+    const auto reader = file.open();
+
+    const auto in_seconds = reader.column<float>("time", seconds);
+    ASSERT_THAT(in_seconds.outcome, Eq(ColumnarOutcome::OK));
+    EXPECT_THAT(in_seconds.value[1], SameTypeAndValue(seconds(-45.0f)));
+
+    const auto in_minutes = reader.column<double>("time", minutes);
+    ASSERT_THAT(in_minutes.outcome, Eq(ColumnarOutcome::OK));
+    EXPECT_THAT(in_minutes.value[0].in(minutes), DoubleEq(1.5));
+}
+
+TEST(ColumnarReader, ReportsLookupErrors) {
+    const QuantityVector<UnitQuotient<Kilo<Meters>, Hours>, double> speeds{};
+    const QuantityVector<Seconds, int32_t> times{seconds(1)};
+    FileBytes file{make_writer(speeds, times)};
+    const auto reader = file.open();
+
+    EXPECT_THAT(reader.column<double>("altitude", meters).outcome,
+                Eq(ColumnarOutcome::ERR_NO_SUCH_COLUMN));
+    EXPECT_THAT(reader.column<double>("time", meters).outcome,
+                Eq(ColumnarOutcome::ERR_DIMENSION_MISMATCH));
+    EXPECT_THAT(reader.column<int64_t>("time", seconds).outcome,
+                Eq(ColumnarOutcome::ERR_UNSUPPORTED_CONVERSION));
+    EXPECT_THAT(reader.column<int32_t>("time", milli(seconds)).outcome,
+                Eq(ColumnarOutcome::ERR_UNSUPPORTED_CONVERSION));
+}
+
+TEST(ColumnarReader, RejectsInvalidFiles) {
+    const QuantityVector<UnitQuotient<Kilo<Meters>, Hours>, double> speeds{};
+    const QuantityVector<Seconds, int32_t> times{seconds(1), seconds(2)};
+    FileBytes file{make_writer(speeds, times)};
+
+    EXPECT_THAT(ColumnarReader::open(file.data(), 10u).outcome,
+                Eq(ColumnarOutcome::ERR_TRUNCATED_FILE));
+    EXPECT_THAT(ColumnarReader::open(file.data(), file.size() - 1u).outcome,
+                Eq(ColumnarOutcome::ERR_TRUNCATED_FILE));
+
+    file.data()[8] ^= 0x7F;
+    EXPECT_THAT(ColumnarReader::open(file.data(), file.size()).outcome,
+                Eq(ColumnarOutcome::ERR_WRONG_BYTE_ORDER));
+    file.data()[8] ^= 0x7F;
+
+    file.data()[0] = 'X';
+    EXPECT_THAT(ColumnarReader::open(file.data(), file.size()).outcome,
+                Eq(ColumnarOutcome::ERR_NOT_A_COLUMNAR_FILE));
+}
+
+}  // namespace
+}  // namespace au
@@ -59,6 +59,259 @@ auto cast(const Quantity<U, R> &q) {
     return make_quantity<U>(q.data_in(U{}).template cast<NewScalar>());
 }
 
+//
+// Runtime conversion risk checks.
+//
+// Au's runtime risk checks (`check_at_runtime()`, `try_in()`, `will_conversion_overflow()`, and so
+// on) compare values lane-wise by default.  Eigen's types don't support that: its matrix types have
+// no coefficient-wise comparisons at all.  So, we check them with Eigen's own reductions instead.
+// Each check is a single pass over the coefficients (even when we need both bounds), with no
+// intermediate mask or copy.
+//
+// For Eigen's sparse types, see `"au/compatibility/eigen_sparse.hh"`.
+//
+
+namespace detail {
+template <typename T>
+using MinCoeffResult = decltype(std::declval<const T &>().minCoeff());
+template <typename T>
+using HasCoeffReductions = stdx::experimental::is_detected<MinCoeffResult, T>;
+
+// Finds the smallest and largest coefficients together, in one pass of Eigen's `visit()`.
+//
+// A NaN never overflows, so we skip it.  (If we didn't, a leading NaN would become both bounds, and
+// hide every other coefficient.)  If every coefficient is NaN, so are both bounds, and every
+// comparison with them is false.
+template <typename Scalar>
+struct CoeffBoundsVisitor {
+    template <typename I, typename J>
+    void init(const Scalar &value, I, J) {
+        lo = value;
+        hi = value;
+    }
+
+    // `lo != lo` only if `lo` is NaN, which happens only if every value so far was NaN.
+    template <typename I, typename J>
+    void operator()(const Scalar &value, I, J) {
+        lo = (value < lo || lo != lo) ? value : lo;
+        hi = (hi < value || hi != hi) ? value : hi;
+    }
+
+    Scalar lo;
+    Scalar hi;
+};
+
+template <typename T>
+struct LaneChecks<T, std::enable_if_t<HasCoeffReductions<T>::value>> {
+    using Scalar = std::decay_t<MinCoeffResult<T>>;
+
+    // We use `visit()` even when we need only one bound, because Eigen's `minCoeff()` and
+    // `maxCoeff()` give unspecified results when there's a NaN.
+    template <typename L>
+    static bool any_below(const T &x, const L &limit) {
+        return x.size() != 0 && bounds(x).lo < limit;
+    }
+
+    template <typename L>
+    static bool any_above(const T &x, const L &limit) {
+        return x.size() != 0 && bounds(x).hi > limit;
+    }
+
+    template <typename L>
+    static bool any_outside(const T &x, const L &lo, const L &hi) {
+        if (x.size() == 0) {
+            return false;
+        }
+        const auto b = bounds(x);
+        return b.lo < lo || b.hi > hi;
+    }
+
+    static bool any_nonzero(const T &x) { return any_outside(x, Scalar{0}, Scalar{0}); }
+
+    // Eigen types have no `%` operator, so we compute the remainder as `x - (x / d) * d`.
+    template <typename D>
+    static bool any_not_multiple_of(const T &x, const D &d) {
+        return any_lane_nonzero(x - (x / d) * d);
+    }
+
+ private:
+    // The smallest and largest non-NaN coefficients of the nonempty `x`.
+    static CoeffBoundsVisitor<Scalar> bounds(const T &x) {
+        CoeffBoundsVisitor<Scalar> result;
+        x.visit(result);
+        return result;
+    }
+};
+
+// Applies the conversion `Op` to a single coefficient, saturating if it would overflow.
+template <typename Op>
+struct SaturatingLaneApply {
+    OpOutput<LaneOp<Op>> operator()(const OpInput<LaneOp<Op>> &x) const {
+        return saturating_apply<LaneOp<Op>>(x);
+    }
+};
+
+template <typename T>
+using PlainObjectOf = typename T::PlainObject;
+
+// A runtime checked conversion of an Eigen rep evaluates its result, so that when a check finds an
+// overflow, it can saturate each coefficient separately, just as for a scalar rep.  (A lazy result
+// would refer to the values which overflow, and evaluating those could be undefined behavior.)
+template <typename Op>
+struct RuntimeCheckedApply<
+    Op,
+    std::enable_if_t<stdx::experimental::is_detected<PlainObjectOf, OpInput<Op>>::value>> {
+    using Result = PlainObjectOf<std::decay_t<OpOutput<Op>>>;
+
+    static Result apply_to(const OpInput<Op> &x) { return Op::apply_to(x); }
+
+    static Result apply_after_overflow(const OpInput<Op> &x) {
+        return x.unaryExpr(SaturatingLaneApply<Op>{});
+    }
+};
+}  // namespace detail
+
+//
+// Non-owning reps.
+//
+// A `Quantity` can wrap an `Eigen::Map` (including strided and `const` maps), to give units to
+// a buffer that something else owns.  Every function in this header works on such quantities, and
+// so do unit conversions.  Copying the `Quantity` copies the map, not the data.
+//
+// The functions below write into that storage.  Eigen evaluates the (lazy) converted values
+// straight into the destination, so there are no temporaries.  (The exception is a runtime checked
+// policy, whose conversion evaluates its result first; see `RuntimeCheckedApply` above.)
+//
+
+namespace detail {
+// Whether the Eigen type `R` owns its data (as opposed to, say, a `Map` or a `Block`).
+template <typename R>
+struct OwnsItsData : std::is_same<std::remove_const_t<R>, typename R::PlainObject> {};
+
+template <typename U, typename SourceU, typename SourceR, typename RiskPolicyT>
+auto converted_rep_impl(const Quantity<SourceU, SourceR> &src,
+                        RiskPolicyT policy,
+                        std::false_type /* is identity */) {
+    return src.in(U{}, policy);
+}
+template <typename U, typename SourceU, typename SourceR, typename RiskPolicyT>
+const SourceR &converted_rep_impl(const Quantity<SourceU, SourceR> &src,
+                                  RiskPolicyT,
+                                  std::true_type /* is identity */) {
+    return src.data_in(SourceU{});
+}
+
+// The rep of `src`, converted to `U`, ready to assign to some destination.
+//
+// Skips the identity conversion, which would materialize a copy of an owning rep.
+template <typename U, typename SourceU, typename SourceR, typename RiskPolicyT>
+decltype(auto) converted_rep(const Quantity<SourceU, SourceR> &src, RiskPolicyT policy) {
+    return converted_rep_impl<U>(src, policy, std::is_same<UnitRatio<SourceU, U>, Magnitude<>>{});
+}
+}  // namespace detail
+
+// Write `src`, converted to the unit of `dst`, into the storage of `dst`.
+//
+// Uses the same risk checks as `.in()`, controlled by the (optional) risk policy.  `dst` may also
+// be a temporary, as long as it doesn't own its data: for example,
+// `assign(meters(Eigen::Map<Eigen::Vector3d>{buffer}), src)`.
+template <typename U,
+          typename R,
+          typename SourceU,
+          typename SourceR,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+void assign(Quantity<U, R> &dst,
+            const Quantity<SourceU, SourceR> &src,
+            RiskPolicyT policy = RiskPolicyT{}) {
+    dst.data_in(U{}) = detail::converted_rep<U>(src, policy);
+}
+template <typename U,
+          typename R,
+          typename SourceU,
+          typename SourceR,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
+          std::enable_if_t<!detail::OwnsItsData<R>::value, int> = 0>
+void assign(Quantity<U, R> &&dst,
+            const Quantity<SourceU, SourceR> &src,
+            RiskPolicyT policy = RiskPolicyT{}) {
+    assign(dst, src, policy);
+}
+
+// Convert the values in the storage of `q` to `new_unit`, in place.
+//
+// Returns a `Quantity` in `new_unit` which refers to the same storage.  `q` must not own its data
+// (it could be an `Eigen::Map`, for example).  Afterwards, its storage holds values in `new_unit`,
+// so `q` itself should no longer be used.
+template <typename NewUnitSlot,
+          typename U,
+          typename R,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+auto convert_in_place(const Quantity<U, R> &q,
+                      NewUnitSlot new_unit,
+                      RiskPolicyT policy = RiskPolicyT{}) {
+    static_assert(!detail::OwnsItsData<R>::value,
+                  "convert_in_place() needs a rep that refers to storage it doesn't own, such as "
+                  "an Eigen::Map; use .as() for reps that own their data");
+    R storage = q.data_in(U{});  // Copies the reference to the storage, not the data.
+    storage = q.in(new_unit, policy);
+    return make_quantity<AssociatedUnit<NewUnitSlot>>(storage);
+}
+
+//
+// Assignment without aliasing temporaries.
+//
+// Products of `Quantity` values are lazy, just as in Eigen: `a * b` (with unit `UnitProductT<U1,
+// U2>`) holds an `Eigen::Product` expression.  Assigning a product evaluates it into a temporary
+// first, in case the destination is also one of the operands.  When you know that it isn't, write
+// `noalias(dst) = a * b` instead, the unit-aware form of Eigen's `dst.noalias() = a * b`.
+//
+
+// The destination of `noalias(q)`.  Supports `=`, `+=`, and `-=` for any quantity whose unit can
+// be implicitly converted to `U`.
+template <typename U, typename R>
+class NoAliasQuantity {
+ public:
+    explicit NoAliasQuantity(Quantity<U, R> &dst) : dst_{dst} {}
+
+    template <typename SourceU, typename SourceR>
+    NoAliasQuantity &operator=(const Quantity<SourceU, SourceR> &src) {
+        dst_.data_in(U{}).noalias() = detail::converted_rep<U>(src, check_for(ALL_RISKS));
+        return *this;
+    }
+
+    template <typename SourceU, typename SourceR>
+    NoAliasQuantity &operator+=(const Quantity<SourceU, SourceR> &src) {
+        dst_.data_in(U{}).noalias() += detail::converted_rep<U>(src, check_for(ALL_RISKS));
+        return *this;
+    }
+
+    template <typename SourceU, typename SourceR>
+    NoAliasQuantity &operator-=(const Quantity<SourceU, SourceR> &src) {
+        dst_.data_in(U{}).noalias() -= detail::converted_rep<U>(src, check_for(ALL_RISKS));
+        return *this;
+    }
+
+ private:
+    Quantity<U, R> &dst_;
+};
+
+// Assign to `dst` without evaluating into a temporary first.
+//
+// The caller promises that `dst` doesn't alias any operand of the right hand side, exactly as for
+// Eigen's `.noalias()`.  To use a conversion risk policy other than the default, apply it on the
+// right hand side: `noalias(dst) = (a * b).as(unit, policy)`.
+template <typename U, typename R>
+NoAliasQuantity<U, R> noalias(Quantity<U, R> &dst) {
+    return NoAliasQuantity<U, R>{dst};
+}
+
+// `noalias()` for a temporary `Quantity` which doesn't own its data, such as one wrapping an
+// `Eigen::Map`.  The temporary lives until the end of the full expression, so this is safe.
+template <typename U, typename R, std::enable_if_t<!detail::OwnsItsData<R>::value, int> = 0>
+NoAliasQuantity<U, R> noalias(Quantity<U, R> &&dst) {
+    return NoAliasQuantity<U, R>{dst};
+}
+
 //
 // Free-function forms of Eigen member functions, made unit-aware.
 //
@@ -344,14 +597,25 @@ auto cwiseSqrt(const Quantity<U, R> &q) {
     return make_quantity<UnitPowerT<U, 1, 2>>(q.data_in(U{}).cwiseSqrt());
 }
 
+// The coefficient-based product.  The result unit is the product of the operand units.  LAZY: see
+// the lifetime note above.
+//
+// Unlike `a * b`, which may evaluate into a temporary (or call an optimized matrix-matrix kernel),
+// each coefficient of this product is computed when it's read.  This is usually faster for very
+// small matrices, and never allocates.
+template <typename U1, typename R1, typename U2, typename R2>
+auto lazyProduct(const Quantity<U1, R1> &a, const Quantity<U2, R2> &b) {
+    return make_quantity<UnitProductT<U1, U2>>(a.data_in(U1{}).lazyProduct(b.data_in(U2{})));
+}
+
 // The matrix inverse.  Inverts the unit (since `A * A.inverse()` is dimensionless).  LAZY: see the
 // lifetime note above.
 //
 // This is exact for a matrix with a single shared unit, which is all `Quantity<U, Matrix>` can
-// represent today: every cell carries `U`, so every cell of the inverse carries `1 / U`.  A
-// heterogeneous matrix (distinct per-row/per-col units) also has a well-defined inverse --- the
-// cell units are the reciprocal of the transposed original --- but representing such matrices is
-// planned future work.  Until then, this is a known (temporary) gap.
+// represent: every cell carries `U`, so every cell of the inverse carries `1 / U`.  A heterogeneous
+// matrix (distinct per-row/per-col units) also has a well-defined inverse --- the cell units are
+// the reciprocal of the transposed original.  For those, see `UnitMatrix`, in
+// `"au/compatibility/eigen_unit_matrix.hh"`.
 template <typename U, typename R>
 auto inverse(const Quantity<U, R> &q) {
     return make_quantity<UnitInverseT<U>>(q.data_in(U{}).inverse());
@@ -0,0 +1,237 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Eigen/SparseCore>
+#include <type_traits>
+#include <utility>
+
+#include "au/au.hh"
+#include "au/compatibility/eigen.hh"
+
+// Eigen's sparse matrices as `Quantity` reps.
+//
+// Most of the support needs nothing from this header.  `Quantity<U, Eigen::SparseMatrix<...>>`
+// already supports arithmetic, sparse-sparse and sparse-dense products (`k * t`, with unit
+// `UnitProductT<UK, UT>`), the functions in `"au/compatibility/eigen.hh"` which Eigen's sparse
+// types provide (such as `cwiseProduct` and `transpose`), and unit conversions.  Conversions only
+// touch the stored values: every unit conversion of a sparse rep maps zero to zero.
+//
+// This header adds three things that sparse models need on top of that:
+//
+// - Runtime conversion checks (`check_at_runtime()`, `will_conversion_overflow()`, and so on).
+//   These check only the stored values, too.
+//
+// - `convert_in_place`, for sparse matrices.  `q.in(new_unit)` is a sparse expression, and
+//   assigning it to a `SparseMatrix` rebuilds the whole sparsity structure.  Converting in place
+//   rescales the stored values, and leaves the structure alone.
+//
+// - `QuantitySolver`, which wraps an Eigen solver so that solving `A x = b` gives `x` in the unit
+//   `UnitQuotientT<UB, UA>`.
+
+namespace au {
+
+//
+// Runtime conversion checks.
+//
+// Eigen's compressed sparse types (`SparseMatrix`, and maps of one) have neither lane-wise
+// comparisons nor reductions, but they expose their stored values as a dense array, via `coeffs()`.
+// Every check is false for a zero, so we only need to check the stored values.
+//
+
+namespace detail {
+template <typename T>
+using StoredCoeffs = decltype(std::declval<const T &>().coeffs());
+template <typename T>
+using HasStoredCoeffs = stdx::conjunction<stdx::negation<HasCoeffReductions<T>>,
+                                          stdx::experimental::is_detected<StoredCoeffs, T>>;
+
+// Whether `check` holds for any segment of the values stored in the sparse `x`.
+//
+// In compressed form, the stored values are a single contiguous segment.  Otherwise, each inner
+// vector (that is, each column, for column-major storage) has its own segment.
+template <typename T, typename Check>
+bool any_stored_segment(const T &x, Check check) {
+    if (x.isCompressed()) {
+        return check(x.coeffs());
+    }
+    using Segment = std::decay_t<StoredCoeffs<T>>;
+    for (auto j = decltype(x.outerSize()){0}; j < x.outerSize(); ++j) {
+        if (check(Segment{x.valuePtr() + x.outerIndexPtr()[j], x.innerNonZeroPtr()[j]})) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+struct LaneChecks<T, std::enable_if_t<HasStoredCoeffs<T>::value>> {
+    template <typename L>
+    static bool any_below(const T &x, const L &limit) {
+        return any_stored_segment(x, [&limit](const auto &s) { return any_lane_below(s, limit); });
+    }
+
+    template <typename L>
+    static bool any_above(const T &x, const L &limit) {
+        return any_stored_segment(x, [&limit](const auto &s) { return any_lane_above(s, limit); });
+    }
+
+    template <typename L>
+    static bool any_outside(const T &x, const L &lo, const L &hi) {
+        return any_stored_segment(
+            x, [&lo, &hi](const auto &s) { return any_lane_outside(s, lo, hi); });
+    }
+
+    static bool any_nonzero(const T &x) {
+        return any_stored_segment(x, [](const auto &s) { return any_lane_nonzero(s); });
+    }
+
+    template <typename D>
+    static bool any_not_multiple_of(const T &x, const D &d) {
+        return any_stored_segment(
+            x, [&d](const auto &s) { return any_lane_not_multiple_of(s, d); });
+    }
+};
+}  // namespace detail
+
+//
+// In-place conversion of sparse matrices.
+//
+
+namespace detail {
+// Convert the stored values of the sparse matrix `storage` (in `U`) to `new_unit`.
+//
+// In compressed form, the stored values are a single contiguous segment.  Otherwise, each inner
+// vector has its own segment, followed by some reserved space, which we leave alone.
+template <typename U, typename NewUnitSlot, typename SparseT, typename RiskPolicyT>
+void convert_stored_values(SparseT &storage, NewUnitSlot new_unit, RiskPolicyT policy) {
+    if (storage.isCompressed()) {
+        convert_in_place(make_quantity<U>(storage.coeffs()), new_unit, policy);
+        return;
+    }
+    using Segment = std::decay_t<decltype(storage.coeffs())>;
+    for (auto j = decltype(storage.outerSize()){0}; j < storage.outerSize(); ++j) {
+        const auto segment = Segment{storage.valuePtr() + storage.outerIndexPtr()[j],
+                                     storage.innerNonZeroPtr()[j]};
+        convert_in_place(make_quantity<U>(segment), new_unit, policy);
+    }
+}
+}  // namespace detail
+
+// Convert the stored values of the sparse matrix in `q` to `new_unit`, in place, and return it as
+// a `Quantity` in `new_unit`.
+//
+// This takes the storage from `q`, so it never copies or reallocates the values, and it keeps the
+// sparsity structure exactly as it was.  (If the matrix isn't in compressed form, this compresses
+// it first.)  Uses the same risk checks as `.in()`, controlled by the (optional) risk policy.
+template <typename NewUnitSlot,
+          typename U,
+          typename Scalar,
+          int Options,
+          typename StorageIndex,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+auto convert_in_place(Quantity<U, Eigen::SparseMatrix<Scalar, Options, StorageIndex>> &&q,
+                      NewUnitSlot new_unit,
+                      RiskPolicyT policy = RiskPolicyT{}) {
+    using NewUnit = AssociatedUnit<NewUnitSlot>;
+
+    // Eigen 3.4's `SparseMatrix` has no move constructor, but it has a cheap `swap()`.
+    auto result = make_quantity<NewUnit>(Eigen::SparseMatrix<Scalar, Options, StorageIndex>{});
+    auto &storage = result.data_in(NewUnit{});
+    storage.swap(q.data_in(U{}));
+    storage.makeCompressed();
+    detail::convert_stored_values<U>(storage, new_unit, policy);
+    return result;
+}
+
+// Convert the stored values of the mapped sparse matrix in `q` to `new_unit`, in place.
+//
+// Like `convert_in_place` for dense maps (in `"au/compatibility/eigen.hh"`), this returns
+// a `Quantity` in `new_unit` which refers to the same storage, and `q` should no longer be used.
+//
+// We can't compress a map.  If it isn't in compressed form, we convert each inner vector
+// separately, so a runtime checked policy calls its handler once for each inner vector that fails.
+template <typename NewUnitSlot,
+          typename U,
+          typename Scalar,
+          int Options,
+          typename StorageIndex,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+auto convert_in_place(
+    const Quantity<U, Eigen::Map<Eigen::SparseMatrix<Scalar, Options, StorageIndex>>> &q,
+    NewUnitSlot new_unit,
+    RiskPolicyT policy = RiskPolicyT{}) {
+    auto storage = q.data_in(U{});  // Copies the map, not the data.
+    detail::convert_stored_values<U>(storage, new_unit, policy);
+    return make_quantity<AssociatedUnit<NewUnitSlot>>(storage);
+}
+
+//
+// Unit-aware linear solvers.
+//
+// `QuantitySolver<Solver, U>` wraps any Eigen solver with Eigen's usual interface (`compute()`,
+// `solve()`, and `info()`): for example, `Eigen::SimplicialLDLT`, `Eigen::SparseLU`, or
+// `Eigen::ConjugateGradient`.  It factors (or prepares) a matrix `A` with unit `U`.  Solving
+// `A x = b` for `b` with unit `UB` then gives `x` with unit `UnitQuotientT<UB, U>`.
+//
+// LIFETIME NOTE: just like Eigen's `solve()`, the result of `solve()` is lazy: it refers to the
+// solver and to `b`.  It is valid only while both are alive: assign it, or `eval()` it, to keep it.
+//
+template <typename Solver, typename U>
+class QuantitySolver {
+ public:
+    QuantitySolver() = default;
+
+    // Factor (or prepare) `a`.
+    template <typename R>
+    explicit QuantitySolver(const Quantity<U, R> &a) {
+        compute(a);
+    }
+
+    // Factor (or prepare) `a`, replacing any previous matrix.
+    template <typename R>
+    QuantitySolver &compute(const Quantity<U, R> &a) {
+        solver_.compute(a.data_in(U{}));
+        return *this;
+    }
+
+    // Whether the last computation (or, for iterative solvers, the last solve) succeeded.
+    Eigen::ComputationInfo info() const { return solver_.info(); }
+
+    // The `x` which solves `A x = b`.  LAZY: see the lifetime note above.
+    template <typename UB, typename RB>
+    auto solve(const Quantity<UB, RB> &b) const {
+        return make_quantity<UnitQuotientT<UB, U>>(solver_.solve(b.data_in(UB{})));
+    }
+
+    // The `x` which solves `A x = b`, for an iterative solver which starts from the guess `x0`.
+    // LAZY: see the lifetime note above.
+    template <typename UB, typename RB, typename UX, typename RX>
+    auto solveWithGuess(const Quantity<UB, RB> &b, const Quantity<UX, RX> &x0) const {
+        using SolutionUnit = UnitQuotientT<UB, U>;
+        return make_quantity<SolutionUnit>(
+            solver_.solveWithGuess(b.data_in(UB{}), x0.data_in(SolutionUnit{})));
+    }
+
+    // The wrapped solver, for its other settings and diagnostics (such as `setTolerance()`, or
+    // `iterations()`).
+    const Solver &solver() const { return solver_; }
+    Solver &solver() { return solver_; }
+
+ private:
+    Solver solver_;
+};
+
+}  // namespace au
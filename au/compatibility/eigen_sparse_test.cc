@@ -0,0 +1,303 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/compatibility/eigen_sparse.hh"
+
+#include <Eigen/Cholesky>
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/compatibility/eigen.hh"
+#include "au/testing.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace au {
+
+using ::testing::DoubleNear;
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::IsFalse;
+using ::testing::IsTrue;
+using ::testing::StaticAssertTypeEq;
+
+struct Kelvins : UnitImpl<Temperature> {};
+constexpr auto kelvins = QuantityMaker<Kelvins>{};
+
+struct Watts : UnitImpl<decltype(Mass{} * pow<2>(Length{}) / pow<3>(Time{}))> {};
+constexpr auto watts = QuantityMaker<Watts>{};
+
+using WattsPerKelvin = UnitQuotient<Watts, Kelvins>;
+constexpr auto watts_per_kelvin = QuantityMaker<WattsPerKelvin>{};
+
+using SparseMatrixd = Eigen::SparseMatrix<double>;
+
+// The conductance matrix of a chain of `n` nodes, each linked to its neighbours (and the first
+// and last to a fixed temperature) by a conductance of 1.
+SparseMatrixd chain_conductance(int n) {
+    std::vector<Eigen::Triplet<double>> entries;
+    for (int i = 0; i < n; ++i) {
+        entries.emplace_back(i, i, 2.0);
+        if (i > 0) {
+            entries.emplace_back(i, i - 1, -1.0);
+            entries.emplace_back(i - 1, i, -1.0);
+        }
+    }
+    SparseMatrixd k(n, n);
+    k.setFromTriplets(entries.begin(), entries.end());
+    return k;
+}
+
+std::vector<double> stored_values(const SparseMatrixd &m) {
+    return std::vector<double>(m.valuePtr(), m.valuePtr() + m.nonZeros());
+}
+
+TEST(EigenSparse, ConvertingScalesOnlyStoredValues) {
+    const auto k = watts_per_kelvin(chain_conductance(3));
+
+    const SparseMatrixd k_mw = k.in(milli(watts) / kelvins);
+
+    EXPECT_THAT(k_mw.nonZeros(), Eq(7));
+    EXPECT_THAT(stored_values(k_mw),
+                ElementsAre(2000.0, -1000.0, -1000.0, 2000.0, -1000.0, -1000.0, 2000.0));
+}
+
+TEST(EigenSparse, SparseDenseProductCarriesProductUnit) {
+    const auto k = watts_per_kelvin(chain_conductance(3));
+    const auto t = kelvins(Eigen::Vector3d{1.0, 2.0, 4.0});
+
+    const auto heat = k * t;
+    StaticAssertTypeEq<decltype(heat)::Unit, UnitProductT<WattsPerKelvin, Kelvins>>();
+
+    const Eigen::VectorXd heat_watts = heat.in(watts);
+    EXPECT_THAT(heat_watts, Eq(Eigen::Vector3d{0.0, -1.0, 6.0}));
+}
+
+TEST(EigenSparse, CwiseProductCarriesProductUnit) {
+    const auto k = watts_per_kelvin(chain_conductance(3));
+
+    const SparseMatrixd k_squared = cwiseProduct(k, k).in(squared(watts_per_kelvin));
+    EXPECT_THAT(k_squared.nonZeros(), Eq(7));
+    EXPECT_THAT(k_squared.coeff(0, 0), Eq(4.0));
+    EXPECT_THAT(k_squared.coeff(0, 1), Eq(1.0));
+}
+
+TEST(EigenSparse, RuntimeCheckFlagsOverflowInStoredValue) {
+    Eigen::SparseMatrix<int32_t> m(1000, 1000);
+    m.insert(3, 4) = 10;
+    m.insert(500, 2) = 30'000'000;
+    m.makeCompressed();
+    const auto q = watts(m);
+
+    ConversionFailure failure;
+    const Eigen::SparseMatrix<int32_t> mw =
+        q.in(milli(watts), check_at_runtime(OVERFLOW_RISK, record_failure_in(failure)));
+    EXPECT_THAT(static_cast<bool>(failure), IsTrue());
+    EXPECT_THAT(mw.nonZeros(), Eq(2));
+    EXPECT_THAT(mw.coeff(3, 4), Eq(10'000));
+    EXPECT_THAT(mw.coeff(500, 2), Eq(std::numeric_limits<int32_t>::max()));
+
+    EXPECT_THAT(will_conversion_overflow(q, milli(watts)), IsTrue());
+
+    const auto smaller = watts(Eigen::SparseMatrix<int32_t>(m / 100));
+    EXPECT_THAT(will_conversion_overflow(smaller, milli(watts)), IsFalse());
+}
+
+TEST(EigenSparse, RuntimeCheckHandlesUncompressedStorage) {
+    Eigen::SparseMatrix<int32_t> m(4, 4);
+    m.reserve(Eigen::VectorXi::Constant(4, 2));
+    m.insert(0, 0) = 12;
+    m.insert(2, 3) = 7;
+    ASSERT_THAT(m.isCompressed(), IsFalse());
+
+    EXPECT_THAT(will_conversion_truncate(watts(m), kilo(watts)), IsTrue());
+    EXPECT_THAT(will_conversion_truncate(watts(m), deci(watts)), IsFalse());
+    EXPECT_THAT(will_conversion_overflow(watts(m), deci(watts)), IsFalse());
+}
+
+TEST(EigenSparse, ImplicitZerosNeverFail) {
+    const auto q = watts(Eigen::SparseMatrix<int32_t>(100, 100));
+    EXPECT_THAT(will_conversion_truncate(q, kilo(watts)), IsFalse());
+    EXPECT_THAT(is_conversion_lossy(q, kilo(watts)), IsFalse());
+}
+
+TEST(EigenSparse, ConvertInPlaceKeepsStorageAndStructure) {
+    auto k = watts_per_kelvin(chain_conductance(3));
+    const double *values = k.data_in(watts_per_kelvin).valuePtr();
+    const int *inner_indices = k.data_in(watts_per_kelvin).innerIndexPtr();
+
+    const auto k_mw = convert_in_place(std::move(k), milli(watts) / kelvins);
+    const auto &raw = k_mw.data_in(milli(watts) / kelvins);
+
+    EXPECT_THAT(raw.valuePtr(), Eq(values));
+    EXPECT_THAT(raw.innerIndexPtr(), Eq(inner_indices));
+    EXPECT_THAT(stored_values(raw),
+                ElementsAre(2000.0, -1000.0, -1000.0, 2000.0, -1000.0, -1000.0, 2000.0));
+}
+
+TEST(EigenSparse, ConvertInPlaceCompressesFirst) {
+    SparseMatrixd m(4, 4);
+    m.reserve(Eigen::VectorXi::Constant(4, 2));
+    m.insert(0, 0) = 1.5;
+    m.insert(2, 3) = 2.0;
+
+    const auto m_mw = convert_in_place(watts(std::move(m)), milli(watts));
+    const auto &raw = m_mw.data_in(milli(watts));
+
+    EXPECT_THAT(raw.isCompressed(), IsTrue());
+    EXPECT_THAT(stored_values(raw), ElementsAre(1500.0, 2000.0));
+}
+
+TEST(EigenSparse, ConvertInPlaceAppliesRiskPolicy) {
+    Eigen::SparseMatrix<int32_t> m(2, 2);
+    m.insert(1, 1) = 1'500;
+
+    ConversionFailure failure;
+    const auto policy = check_at_runtime(TRUNCATION_RISK, record_failure_in(failure));
+    const auto m_kw = convert_in_place(watts(std::move(m)), kilo(watts), policy);
+    EXPECT_THAT(failure.truncation(), IsTrue());
+    EXPECT_THAT(m_kw.data_in(kilo(watts)).coeff(1, 1), Eq(1));
+}
+
+TEST(EigenSparse, ConvertInPlaceSaturatesStoredValuesWhichOverflow) {
+    Eigen::SparseMatrix<int32_t> m(2, 2);
+    m.insert(0, 0) = 2;
+    m.insert(1, 1) = 30'000'000;
+
+    ConversionFailure failure;
+    const auto policy = check_at_runtime(OVERFLOW_RISK, record_failure_in(failure));
+    const auto m_mw = convert_in_place(watts(std::move(m)), milli(watts), policy);
+    EXPECT_THAT(failure.overflow(), IsTrue());
+    EXPECT_THAT(m_mw.data_in(milli(watts)).coeff(0, 0), Eq(2'000));
+    EXPECT_THAT(m_mw.data_in(milli(watts)).coeff(1, 1), Eq(std::numeric_limits<int32_t>::max()));
+}
+
+TEST(EigenSparse, ConvertInPlaceWorksOnMappedSparseMatrix) {
+    SparseMatrixd m = chain_conductance(2);
+    const auto q = watts_per_kelvin(Eigen::Map<SparseMatrixd>{
+        m.rows(), m.cols(), m.nonZeros(), m.outerIndexPtr(), m.innerIndexPtr(), m.valuePtr()});
+
+    convert_in_place(q, milli(watts) / kelvins);
+
+    EXPECT_THAT(stored_values(m), ElementsAre(2000.0, -1000.0, -1000.0, 2000.0));
+}
+
+TEST(EigenSparse, ConvertInPlaceWorksOnUncompressedMappedSparseMatrix) {
+    SparseMatrixd m(4, 4);
+    m.reserve(Eigen::VectorXi::Constant(4, 2));
+    m.insert(0, 0) = 1.5;
+    m.insert(2, 3) = 2.0;
+    m.insert(3, 3) = -0.5;
+    ASSERT_THAT(m.isCompressed(), IsFalse());
+    const auto q = watts(Eigen::Map<SparseMatrixd>{m.rows(),
+                                                   m.cols(),
+                                                   m.nonZeros(),
+                                                   m.outerIndexPtr(),
+                                                   m.innerIndexPtr(),
+                                                   m.valuePtr(),
+                                                   m.innerNonZeroPtr()});
+
+    convert_in_place(q, milli(watts));
+
+    EXPECT_THAT(m.isCompressed(), IsFalse());
+    EXPECT_THAT(m.coeff(0, 0), Eq(1500.0));
+    EXPECT_THAT(m.coeff(2, 3), Eq(2000.0));
+    EXPECT_THAT(m.coeff(3, 3), Eq(-500.0));
+}
+
+TEST(EigenSparse, ConvertInPlaceChecksEachInnerVectorOfUncompressedMap) {
+    Eigen::SparseMatrix<int32_t> m(4, 4);
+    m.reserve(Eigen::VectorXi::Constant(4, 2));
+    m.insert(0, 0) = 12'000;
+    m.insert(2, 1) = 1'500;
+    m.insert(2, 3) = 2'500;
+    ASSERT_THAT(m.isCompressed(), IsFalse());
+    const auto q = watts(Eigen::Map<Eigen::SparseMatrix<int32_t>>{m.rows(),
+                                                                  m.cols(),
+                                                                  m.nonZeros(),
+                                                                  m.outerIndexPtr(),
+                                                                  m.innerIndexPtr(),
+                                                                  m.valuePtr(),
+                                                                  m.innerNonZeroPtr()});
+
+    // The handler is called once for each inner vector (here, column) with a failure.
+    int failures = 0;
+    convert_in_place(
+        q, kilo(watts), check_at_runtime(TRUNCATION_RISK, [&failures](ConversionFailure) {
+            ++failures;
+        }));
+    EXPECT_THAT(failures, Eq(2));
+    EXPECT_THAT(m.coeff(0, 0), Eq(12));
+    EXPECT_THAT(m.coeff(2, 1), Eq(1));
+    EXPECT_THAT(m.coeff(2, 3), Eq(2));
+}
+
+TEST(QuantitySolver, SolutionHasQuotientUnit) {
+    const auto k = watts_per_kelvin(chain_conductance(3));
+    const auto heat = watts(Eigen::Vector3d{0.0, -1.0, 6.0});
+
+    const QuantitySolver<Eigen::SimplicialLDLT<SparseMatrixd>, WattsPerKelvin> solver{k};
+    ASSERT_THAT(solver.info(), Eq(Eigen::Success));
+
+    const auto t = eval(solver.solve(heat));
+    StaticAssertTypeEq<decltype(t)::Unit, UnitQuotientT<Watts, WattsPerKelvin>>();
+
+    const Eigen::VectorXd t_kelvins = t.in(kelvins);
+    EXPECT_THAT(t_kelvins(0), DoubleNear(1.0, 1e-12));
+    EXPECT_THAT(t_kelvins(1), DoubleNear(2.0, 1e-12));
+    EXPECT_THAT(t_kelvins(2), DoubleNear(4.0, 1e-12));
+}
+
+TEST(QuantitySolver, SolutionConvertsToOtherUnits) {
+    const auto k = watts_per_kelvin(chain_conductance(3));
+    const auto heat = milli(watts)(Eigen::Vector3d{0.0, -1000.0, 6000.0});
+
+    QuantitySolver<Eigen::SimplicialLDLT<SparseMatrixd>, WattsPerKelvin> solver;
+    solver.compute(k);
+
+    const Eigen::VectorXd t_kelvins = solver.solve(heat).in(kelvins);
+    EXPECT_THAT(t_kelvins(2), DoubleNear(4.0, 1e-12));
+}
+
+TEST(QuantitySolver, IterativeSolverAcceptsGuessInSolutionUnit) {
+    const auto k = watts_per_kelvin(chain_conductance(50));
+    const auto heat = watts(Eigen::VectorXd::Ones(50));
+
+    QuantitySolver<Eigen::ConjugateGradient<SparseMatrixd>, WattsPerKelvin> solver{k};
+    solver.solver().setTolerance(1e-12);
+
+    const auto guess = kelvins(Eigen::VectorXd::Zero(50));
+    const Eigen::VectorXd t = solver.solveWithGuess(heat, guess).in(kelvins);
+    ASSERT_THAT(solver.info(), Eq(Eigen::Success));
+
+    const Eigen::VectorXd residual = chain_conductance(50) * t - Eigen::VectorXd::Ones(50);
+    EXPECT_THAT(residual.norm(), DoubleNear(0.0, 1e-9));
+}
+
+TEST(QuantitySolver, WorksWithDenseSolvers) {
+    const auto k = watts_per_kelvin(Eigen::MatrixXd(chain_conductance(3)));
+    const auto heat = watts(Eigen::Vector3d{0.0, -1.0, 6.0});
+
+    const QuantitySolver<Eigen::LDLT<Eigen::MatrixXd>, WattsPerKelvin> solver{k};
+
+    const Eigen::VectorXd t_kelvins = solver.solve(heat).in(kelvins);
+    EXPECT_THAT(t_kelvins(1), DoubleNear(2.0, 1e-12));
+}
+
+}  // namespace au
@@ -14,9 +14,13 @@
 
 #include "au/compatibility/eigen.hh"
 
+// Lets tests assert that an operation performs no heap allocation (see `NoMallocScope` below).
+#define EIGEN_RUNTIME_NO_MALLOC
+
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 #include <Eigen/LU>
+#include <limits>
 
 #include "au/au.hh"
 #include "au/testing.hh"
@@ -809,4 +813,294 @@ TEST(EigenFreeFunctions, CastAcceptsExpressionTemplateInput) {
     EXPECT_THAT(result.data_in(meters), SameTypeAndValue(Eigen::Vector3d(2.0, 4.0, 6.0)));
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Non-owning reps (`Eigen::Map`).
+
+// Makes any heap allocation by Eigen fail an assertion, for as long as it's alive.
+class NoMallocScope {
+ public:
+    NoMallocScope() { Eigen::internal::set_is_malloc_allowed(false); }
+    ~NoMallocScope() { Eigen::internal::set_is_malloc_allowed(true); }
+};
+
+TEST(EigenMap, QuantityOfMapRefersToExternalBuffer) {
+    double buffer[3] = {1.0, 2.0, 3.0};
+    auto q = meters(Eigen::Map<Eigen::Vector3d>{buffer});
+
+    q.data_in(meters)(1) = 20.0;
+    EXPECT_THAT(buffer[1], Eq(20.0));
+
+    auto copy = q;
+    EXPECT_THAT(copy.data_in(meters).data(), Eq(buffer));
+}
+
+TEST(EigenMap, FreeFunctionsWorkOnConstMaps) {
+    const double a[3] = {3.0, 0.0, 4.0};
+    const double b[3] = {1.0, 2.0, 3.0};
+    const auto qa = meters(Eigen::Map<const Eigen::Vector3d>{a});
+    const auto qb = secs(Eigen::Map<const Eigen::Vector3d>{b});
+
+    EXPECT_THAT(norm(qa), SameTypeAndValue(meters(5.0)));
+    EXPECT_THAT(dot(qa, qb), SameTypeAndValue((meters * secs)(15.0)));
+    EXPECT_THAT(eval(cwiseProduct(qa, qb)).data_in(meters * secs),
+                Eq(Eigen::Vector3d(3.0, 0.0, 12.0)));
+    EXPECT_THAT(eval(block(qa, 1, 0, 2, 1)).data_in(meters), Eq(Eigen::Vector2d(0.0, 4.0)));
+}
+
+TEST(EigenMap, FreeFunctionsAndConversionsWorkOnStridedMaps) {
+    // Every other value of an interleaved buffer.
+    double buffer[6] = {1.0, -1.0, 2.0, -1.0, 3.0, -1.0};
+    using StridedMap = Eigen::Map<Eigen::VectorXd, 0, Eigen::InnerStride<2>>;
+    const auto q = meters(StridedMap{buffer, 3});
+
+    EXPECT_THAT(sum(q), SameTypeAndValue(meters(6.0)));
+    EXPECT_THAT(maxCoeff(q), SameTypeAndValue(meters(3.0)));
+
+    const Eigen::VectorXd in_cm = q.in(centi(meters));
+    EXPECT_THAT(in_cm, Eq(Eigen::Vector3d(100.0, 200.0, 300.0)));
+}
+
+TEST(EigenMap, AssignWritesConvertedValuesIntoBufferWithoutAllocating) {
+    Eigen::VectorXd buffer(3);
+    auto dst = meters(Eigen::Map<Eigen::VectorXd>{buffer.data(), 3});
+    const Eigen::VectorXd src_cm = Eigen::Vector3d(100.0, 250.0, -50.0);
+    const auto src = centi(meters)(src_cm);
+
+    {
+        NoMallocScope no_malloc;
+        assign(dst, src);
+    }
+    EXPECT_THAT(buffer, Eq(Eigen::VectorXd{Eigen::Vector3d(1.0, 2.5, -0.5)}));
+}
+
+TEST(EigenMap, AssignCanWriteThroughTemporaryQuantityOfMap) {
+    double buffer[2] = {0.0, 0.0};
+
+    assign(meters(Eigen::Map<Eigen::Vector2d>{buffer}),
+           centi(meters)(Eigen::Vector2d(100.0, 50.0)));
+
+    EXPECT_THAT(buffer[0], Eq(1.0));
+    EXPECT_THAT(buffer[1], Eq(0.5));
+}
+
+TEST(EigenMap, AssignChecksConversionRisk) {
+    int buffer[2] = {0, 0};
+    auto dst = feet(Eigen::Map<Eigen::Vector2i>{buffer});
+
+    assign(dst, meters(Eigen::Vector2i(381, 762)), ignore(TRUNCATION_RISK));
+    EXPECT_THAT(buffer[0], Eq(1250));
+    EXPECT_THAT(buffer[1], Eq(2500));
+}
+
+TEST(EigenMap, AssignAndConvertInPlaceSaturateValuesWhichOverflow) {
+    ConversionFailure failure;
+    const auto policy = check_at_runtime(OVERFLOW_RISK, record_failure_in(failure));
+
+    int dst_buffer[2] = {0, 0};
+    assign(centi(meters)(Eigen::Map<Eigen::Vector2i>{dst_buffer}),
+           meters(Eigen::Vector2i(3, 30'000'000)),
+           policy);
+    EXPECT_THAT(failure.overflow(), IsTrue());
+    EXPECT_THAT(dst_buffer[0], Eq(300));
+    EXPECT_THAT(dst_buffer[1], Eq(std::numeric_limits<int>::max()));
+
+    failure = ConversionFailure{};
+    int buffer[2] = {-30'000'000, 4};
+    convert_in_place(meters(Eigen::Map<Eigen::Vector2i>{buffer}), centi(meters), policy);
+    EXPECT_THAT(failure.overflow(), IsTrue());
+    EXPECT_THAT(buffer[0], Eq(std::numeric_limits<int>::lowest()));
+    EXPECT_THAT(buffer[1], Eq(400));
+}
+
+TEST(EigenMap, ConvertInPlaceRescalesBufferAndReturnsQuantityInNewUnit) {
+    Eigen::VectorXd buffer = Eigen::Vector3d(1.0, 2.0, 3.0);
+    const auto q_m = meters(Eigen::Map<Eigen::VectorXd>{buffer.data(), 3});
+
+    const auto q_cm = [&] {
+        NoMallocScope no_malloc;
+        return convert_in_place(q_m, centi(meters));
+    }();
+
+    EXPECT_THAT(q_cm.data_in(centi(meters)).data(), Eq(buffer.data()));
+    EXPECT_THAT(buffer, Eq(Eigen::VectorXd{Eigen::Vector3d(100.0, 200.0, 300.0)}));
+}
+
+TEST(EigenMap, ConvertInPlaceWorksOnStridedMaps) {
+    double buffer[4] = {1.0, 7.0, 2.0, 7.0};
+    using StridedMap = Eigen::Map<Eigen::Vector2d, 0, Eigen::InnerStride<2>>;
+
+    const auto q = convert_in_place(meters(StridedMap{buffer}), centi(meters));
+
+    StaticAssertTypeEq<decltype(q), const Quantity<Centi<Meters>, StridedMap>>();
+    EXPECT_THAT(buffer[0], Eq(100.0));
+    EXPECT_THAT(buffer[1], Eq(7.0));
+    EXPECT_THAT(buffer[2], Eq(200.0));
+    EXPECT_THAT(buffer[3], Eq(7.0));
+}
+
+TEST(EigenProduct, MatrixVectorProductIsLazyAndMultipliesUnits) {
+    const auto a = meters(Eigen::Matrix3d{Eigen::Matrix3d::Identity() * 2.0});
+    const auto v = secs(Eigen::Vector3d{1.0, 2.0, 3.0});
+
+    const auto p = a * v;
+    StaticAssertTypeEq<decltype(p),
+                       const Quantity<UnitProductT<Meters, Secs>,
+                                      Eigen::Product<Eigen::Matrix3d, Eigen::Vector3d>>>();
+
+    const Quantity<UnitProductT<Meters, Secs>, Eigen::Vector3d> result = p;
+    EXPECT_THAT(result.data_in(meters * secs), Eq(Eigen::Vector3d{2.0, 4.0, 6.0}));
+}
+
+TEST(EigenProduct, LazyProductMatchesProduct) {
+    Eigen::Matrix2d a;
+    a << 1.0, 2.0, 3.0, 4.0;
+    const auto qa = meters(a);
+    const auto qb = secs(Eigen::Matrix2d{a.transpose()});
+
+    const auto lazy = lazyProduct(qa, qb);
+    StaticAssertTypeEq<decltype(lazy)::Unit, UnitProductT<Meters, Secs>>();
+    EXPECT_THAT(eval(lazy).data_in(meters * secs), Eq(eval(qa * qb).data_in(meters * secs)));
+}
+
+TEST(EigenProduct, NoAliasAssignsProductWithoutAllocating) {
+    const Eigen::MatrixXd a = Eigen::Matrix3d::Identity() * 2.0;
+    const Eigen::VectorXd v = Eigen::Vector3d{1.0, 2.0, 3.0};
+    const auto qa = meters(a);
+    const auto qv = secs(v);
+    auto dst = (meters * secs)(Eigen::VectorXd{Eigen::VectorXd::Zero(3)});
+
+    {
+        NoMallocScope no_malloc;
+        noalias(dst) = qa * qv;
+    }
+
+    EXPECT_THAT(dst.data_in(meters * secs), Eq(Eigen::VectorXd{Eigen::Vector3d{2.0, 4.0, 6.0}}));
+}
+
+TEST(EigenProduct, NoAliasConvertsToDestinationUnit) {
+    const auto qa = meters(Eigen::Matrix2d{Eigen::Matrix2d::Identity()});
+    const auto qv = secs(Eigen::Vector2d{1.0, 2.0});
+    auto dst = (centi(meters) * secs)(Eigen::Vector2d{});
+
+    noalias(dst) = qa * qv;
+
+    EXPECT_THAT(dst.data_in(centi(meters) * secs), Eq(Eigen::Vector2d{100.0, 200.0}));
+}
+
+TEST(EigenProduct, NoAliasSupportsCompoundAssignment) {
+    const auto qa = meters(Eigen::Matrix2d{Eigen::Matrix2d::Identity() * 3.0});
+    const auto qv = secs(Eigen::Vector2d{1.0, 2.0});
+    auto dst = (meters * secs)(Eigen::Vector2d{10.0, 10.0});
+
+    noalias(dst) += qa * qv;
+    EXPECT_THAT(dst.data_in(meters * secs), Eq(Eigen::Vector2d{13.0, 16.0}));
+
+    noalias(dst) -= qa * qv;
+    EXPECT_THAT(dst.data_in(meters * secs), Eq(Eigen::Vector2d{10.0, 10.0}));
+}
+
+TEST(EigenProduct, NoAliasWritesThroughTemporaryQuantityOfMap) {
+    double buffer[2] = {0.0, 0.0};
+    const auto qa = meters(Eigen::Matrix2d{Eigen::Matrix2d::Identity() * 2.0});
+    const auto qv = secs(Eigen::Vector2d{1.0, 2.0});
+
+    noalias((meters * secs)(Eigen::Map<Eigen::Vector2d>{buffer})) = qa * qv;
+
+    EXPECT_THAT(buffer[0], Eq(2.0));
+    EXPECT_THAT(buffer[1], Eq(4.0));
+}
+
+TEST(EigenRuntimeChecks, CheckAtRuntimeFlagsOverflowInAnyCoefficientOfArray) {
+    Eigen::ArrayXi small(3);
+    small << 1, -2, 3;
+    Eigen::ArrayXi big(3);
+    big << 1, -30'000'000, 3;
+
+    ConversionFailure failure;
+    const auto policy = check_at_runtime(ALL_RISKS, record_failure_in(failure));
+
+    const Eigen::ArrayXi small_cm = meters(small).in(centi(meters), policy);
+    EXPECT_THAT(failure.overflow(), IsFalse());
+    EXPECT_THAT(small_cm(1), Eq(-200));
+
+    const Eigen::ArrayXi big_cm = meters(big).in(centi(meters), policy);
+    EXPECT_THAT(failure.overflow(), IsTrue());
+    EXPECT_THAT(failure.truncation(), IsFalse());
+
+    // Only the coefficient which overflows saturates.
+    EXPECT_THAT(big_cm(0), Eq(100));
+    EXPECT_THAT(big_cm(1), Eq(std::numeric_limits<int>::lowest()));
+    EXPECT_THAT(big_cm(2), Eq(300));
+}
+
+TEST(EigenRuntimeChecks, CheckAtRuntimeWorksForMatricesAndExpressions) {
+    const Eigen::Vector3i a{1, 2, 3};
+    const Eigen::Vector3i b{0, 0, 30'000'000};
+
+    ConversionFailure failure;
+    const auto policy = check_at_runtime(ALL_RISKS, record_failure_in(failure));
+
+    const Eigen::Vector3i a_cm = meters(a).in(centi(meters), policy);
+    EXPECT_THAT(static_cast<bool>(failure), IsFalse());
+    EXPECT_THAT(a_cm, Eq(Eigen::Vector3i{100, 200, 300}));
+
+    const Eigen::Vector3i sum_cm = (meters(a) + meters(b)).in(centi(meters), policy);
+    EXPECT_THAT(failure.overflow(), IsTrue());
+    EXPECT_THAT(sum_cm(0), Eq(100));
+    EXPECT_THAT(sum_cm(2), Eq(std::numeric_limits<int>::max()));
+}
+
+TEST(EigenRuntimeChecks, CheckAtRuntimeFlagsTruncationInAnyCoefficient) {
+    ConversionFailure failure;
+    const auto policy = check_at_runtime(ALL_RISKS, record_failure_in(failure));
+
+    const Eigen::Vector3i exact = centi(meters)(Eigen::Vector3i{100, -200, 300}).in(meters, policy);
+    EXPECT_THAT(static_cast<bool>(failure), IsFalse());
+    EXPECT_THAT(exact, Eq(Eigen::Vector3i{1, -2, 3}));
+
+    const Eigen::Vector3i lossy = centi(meters)(Eigen::Vector3i{100, -250, 300}).in(meters, policy);
+    EXPECT_THAT(failure.truncation(), IsTrue());
+    EXPECT_THAT(lossy, Eq(Eigen::Vector3i{1, -2, 3}));
+    EXPECT_THAT(failure.overflow(), IsFalse());
+}
+
+TEST(EigenRuntimeChecks, NaNDoesNotHideOverflowInOtherCoefficients) {
+    constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_THAT(will_conversion_overflow(meters(Eigen::Vector3d{NaN, 1e300, 1.0}), nano(meters)),
+                IsTrue());
+    EXPECT_THAT(will_conversion_overflow(meters(Eigen::Vector3d{1e300, 1.0, NaN}), nano(meters)),
+                IsTrue());
+    EXPECT_THAT(will_conversion_overflow(meters(Eigen::Vector3d{NaN, -1e300, 1.0}), nano(meters)),
+                IsTrue());
+    EXPECT_THAT(will_conversion_overflow(meters(Eigen::Vector3d{NaN, 1.0, NaN}), nano(meters)),
+                IsFalse());
+    EXPECT_THAT(will_conversion_overflow(meters(Eigen::Vector2d{NaN, NaN}), nano(meters)),
+                IsFalse());
+}
+
+TEST(EigenRuntimeChecks, EmptyArrayHasNoRisk) {
+    const Eigen::ArrayXi empty(0);
+    EXPECT_THAT(will_conversion_overflow(meters(empty), centi(meters)), IsFalse());
+    EXPECT_THAT(is_conversion_lossy(centi(meters)(empty), meters), IsFalse());
+}
+
+TEST(EigenRuntimeChecks, LossinessCheckersWorkOnEigenReps) {
+    EXPECT_THAT(will_conversion_overflow(meters(Eigen::Vector2i{1, 30'000'000}), centi(meters)),
+                IsTrue());
+    EXPECT_THAT(will_conversion_overflow(meters(Eigen::Vector2i{1, 3'000'000}), centi(meters)),
+                IsFalse());
+    EXPECT_THAT(will_conversion_truncate(centi(meters)(Eigen::Vector2i{100, 150}), meters),
+                IsTrue());
+}
+
+TEST(EigenRuntimeChecks, TryInReportsFailureForEigenReps) {
+    const auto result = meters(Eigen::Vector2i{1, 30'000'000}).try_in(centi(meters));
+    EXPECT_THAT(result.ok(), IsFalse());
+    EXPECT_THAT(result.failure.overflow(), IsTrue());
+
+    const auto ok = meters(Eigen::Vector2i{1, 2}).try_in(centi(meters));
+    ASSERT_THAT(ok.ok(), IsTrue());
+    EXPECT_THAT(Eigen::Vector2i{ok.value}, Eq(Eigen::Vector2i{100, 200}));
+}
+
 }  // namespace au
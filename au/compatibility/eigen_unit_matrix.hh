@@ -0,0 +1,259 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "au/au.hh"
+
+// Vectors and matrices whose entries have _different_ units, in a single Eigen storage.
+//
+// A state vector such as [position, velocity, heading] can't be a `Quantity<U, Eigen::Vector3d>`,
+// because that needs one unit for every entry.  A tuple of quantities has the right units, but it
+// gives up the contiguous storage which Eigen's solvers need.  `UnitMatrix` keeps a plain
+// `Eigen::Matrix`, and tracks the units in its type, as a `UnitList` for the rows and another for
+// the columns.
+//
+// Every unit we meet in practice factors into one unit per row and one per column: entry `(i, j)`
+// has unit `R_i * C_j`.  (A state vector has `C = [1]`; its covariance has `R = C = [state units]`;
+// a Jacobian from `x` to `y` has `R = [y units]` and `C = [1 / x units]`.)  This is the form that
+// `UnitMatrix` stores, and it's closed under transposes, products, and inverses.  All of the unit
+// bookkeeping happens at compile time: at runtime, these are exactly the Eigen operations.
+
+namespace au {
+
+// `UnitMatrix<Scalar, UnitList<R...>, UnitList<C...>>`: entry `(i, j)` has unit `R_i * C_j`.
+template <typename Scalar, typename RowUnits, typename ColUnits>
+class UnitMatrix;
+
+// A column vector whose entry `i` has unit `Units_i`.
+template <typename Scalar, typename... Units>
+using UnitVectorOf = UnitMatrix<Scalar, UnitList<Units...>, UnitList<UnitProduct<>>>;
+template <typename... Units>
+using UnitVector = UnitVectorOf<double, Units...>;
+
+namespace detail {
+template <typename V>
+struct CovarianceImpl;
+template <typename Scalar, typename... Units>
+struct CovarianceImpl<UnitVectorOf<Scalar, Units...>> {
+    using type = UnitMatrix<Scalar, UnitList<Units...>, UnitList<Units...>>;
+};
+
+template <typename OutputVector, typename InputVector>
+struct JacobianImpl;
+template <typename Scalar, typename... OutputUnits, typename... InputUnits>
+struct JacobianImpl<UnitVectorOf<Scalar, OutputUnits...>, UnitVectorOf<Scalar, InputUnits...>> {
+    using type = UnitMatrix<Scalar, UnitList<OutputUnits...>, UnitList<UnitInverse<InputUnits>...>>;
+};
+}  // namespace detail
+
+// The covariance of a `UnitVector` `V`: entry `(i, j)` has unit `V_i * V_j`.
+template <typename V>
+using Covariance = typename detail::CovarianceImpl<V>::type;
+
+// The Jacobian of a function from `InputVector` to `OutputVector`: entry `(i, j)` has unit
+// `Output_i / Input_j`.
+template <typename OutputVector, typename InputVector>
+using Jacobian = typename detail::JacobianImpl<OutputVector, InputVector>::type;
+
+namespace detail {
+template <std::size_t I, typename... Units>
+using UnitAt = std::tuple_element_t<I, std::tuple<Units...>>;
+
+// For a product `A * B`, each term `A(i, k) * B(k, j)` has unit `RA_i * (CA_k * RB_k) * CB_j`.  The
+// sum only makes sense if every `CA_k * RB_k` is the same unit: this is that unit.
+template <typename LeftColUnits, typename RightRowUnits>
+struct InnerUnitImpl;
+template <typename C, typename... Cs, typename R, typename... Rs>
+struct InnerUnitImpl<UnitList<C, Cs...>, UnitList<R, Rs...>> {
+    static_assert(sizeof...(Cs) == sizeof...(Rs), "Inner dimensions of product must match");
+    static_assert(stdx::conjunction<AreUnitsQuantityEquivalent<UnitProduct<C, R>,
+                                                               UnitProduct<Cs, Rs>>...>::value,
+                  "Matrix product would add entries with different units");
+    using type = UnitProduct<C, R>;
+};
+template <typename LeftColUnits, typename RightRowUnits>
+using InnerUnit = typename InnerUnitImpl<LeftColUnits, RightRowUnits>::type;
+
+template <typename T>
+struct IsQuantity : std::false_type {};
+template <typename U, typename R>
+struct IsQuantity<Quantity<U, R>> : std::true_type {};
+
+template <typename RowUnits, typename K>
+struct ScaleUnitsImpl;
+template <typename... Units, typename K>
+struct ScaleUnitsImpl<UnitList<Units...>, K> {
+    using type = UnitList<UnitProduct<Units, K>...>;
+};
+template <typename RowUnits, typename K>
+using ScaleUnits = typename ScaleUnitsImpl<RowUnits, K>::type;
+
+// Whether every diagonal entry is dimensionless, with magnitude 1.
+template <typename RowUnits, typename ColUnits, typename Indices>
+struct HasUnitlessDiagonal;
+template <typename... RowUnits, typename... ColUnits, std::size_t... Is>
+struct HasUnitlessDiagonal<UnitList<RowUnits...>, UnitList<ColUnits...>, std::index_sequence<Is...>>
+    : stdx::conjunction<AreUnitsQuantityEquivalent<
+          UnitProduct<UnitAt<Is, RowUnits...>, UnitAt<Is, ColUnits...>>,
+          UnitProduct<>>...> {};
+}  // namespace detail
+
+template <typename Scalar, typename... RowUnits, typename... ColUnits>
+class UnitMatrix<Scalar, UnitList<RowUnits...>, UnitList<ColUnits...>> {
+    static constexpr std::size_t ROWS = sizeof...(RowUnits);
+    static constexpr std::size_t COLS = sizeof...(ColUnits);
+
+ public:
+    using Storage = Eigen::Matrix<Scalar, static_cast<int>(ROWS), static_cast<int>(COLS)>;
+
+    // The unit of entry `(I, J)`.
+    template <std::size_t I, std::size_t J>
+    using EntryUnit =
+        UnitProduct<detail::UnitAt<I, RowUnits...>, detail::UnitAt<J, ColUnits...>>;
+
+    // Fixed-size Eigen members may need aligned allocation (before C++17).
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    // All entries are zero.
+    UnitMatrix() : storage_{Storage::Zero()} {}
+    UnitMatrix(Zero) : UnitMatrix{} {}
+
+    // A vector, from one quantity per entry.  Each must be implicitly convertible to its entry.
+    template <typename... Qs,
+              std::enable_if_t<COLS == 1 && sizeof...(Qs) == ROWS &&
+                                   stdx::conjunction<detail::IsQuantity<Qs>...>::value,
+                               int> = 0>
+    UnitMatrix(const Qs &...entries)
+        : UnitMatrix{from_entries(Quantity<RowUnits, Scalar>{entries}.in(RowUnits{})...)} {}
+
+    // Wrap raw values, which must already be in the units of each entry.
+    static UnitMatrix from_raw(Storage values) { return UnitMatrix{std::move(values), RawTag{}}; }
+
+    // The raw values, each in the unit of its entry.
+    //
+    // This is the escape hatch for handing the storage to Eigen (for example, to a decomposition).
+    const Storage &raw() const { return storage_; }
+    Storage &raw() { return storage_; }
+
+    // The identity matrix.  Only available when every diagonal entry is dimensionless with
+    // magnitude 1, such as for `Jacobian<V, V>`.
+    static UnitMatrix identity() {
+        static_assert(ROWS == COLS, "Only square matrices have an identity");
+        static_assert(detail::HasUnitlessDiagonal<UnitList<RowUnits...>,
+                                                  UnitList<ColUnits...>,
+                                                  std::make_index_sequence<ROWS>>::value,
+                      "Identity needs a unitless diagonal");
+        return from_raw(Storage::Identity());
+    }
+
+    // Entry `(I, J)`.
+    template <std::size_t I, std::size_t J>
+    Quantity<EntryUnit<I, J>, Scalar> at() const {
+        return make_quantity<EntryUnit<I, J>>(storage_(I, J));
+    }
+
+    // Entry `I` of a vector.
+    template <std::size_t I>
+    Quantity<EntryUnit<I, 0>, Scalar> at() const {
+        static_assert(COLS == 1, "Single-index access is only for vectors");
+        return at<I, 0>();
+    }
+
+    // Set entry `(I, J)` to `q`, which must be implicitly convertible to that entry.
+    template <std::size_t I, std::size_t J, typename U, typename R>
+    void set(Quantity<U, R> q) {
+        storage_(I, J) = Quantity<EntryUnit<I, J>, Scalar>{q}.in(EntryUnit<I, J>{});
+    }
+
+    // Set entry `I` of a vector to `q`, which must be implicitly convertible to that entry.
+    template <std::size_t I, typename U, typename R>
+    void set(Quantity<U, R> q) {
+        static_assert(COLS == 1, "Single-index access is only for vectors");
+        set<I, 0>(q);
+    }
+
+    UnitMatrix<Scalar, UnitList<ColUnits...>, UnitList<RowUnits...>> transpose() const {
+        return UnitMatrix<Scalar, UnitList<ColUnits...>, UnitList<RowUnits...>>::from_raw(
+            storage_.transpose());
+    }
+
+    // The inverse: entry `(i, j)` has unit `1 / (C_i * R_j)`.
+    UnitMatrix<Scalar, UnitList<UnitInverse<ColUnits>...>, UnitList<UnitInverse<RowUnits>...>>
+    inverse() const {
+        static_assert(ROWS == COLS, "Only square matrices have an inverse");
+        return UnitMatrix<Scalar,
+                          UnitList<UnitInverse<ColUnits>...>,
+                          UnitList<UnitInverse<RowUnits>...>>::from_raw(storage_.inverse());
+    }
+
+    UnitMatrix operator-() const { return from_raw(-storage_); }
+
+    UnitMatrix &operator+=(const UnitMatrix &other) {
+        storage_ += other.storage_;
+        return *this;
+    }
+    UnitMatrix &operator-=(const UnitMatrix &other) {
+        storage_ -= other.storage_;
+        return *this;
+    }
+    UnitMatrix &operator*=(Scalar s) {
+        storage_ *= s;
+        return *this;
+    }
+    UnitMatrix &operator/=(Scalar s) {
+        storage_ /= s;
+        return *this;
+    }
+
+    friend UnitMatrix operator+(UnitMatrix a, const UnitMatrix &b) { return a += b; }
+    friend UnitMatrix operator-(UnitMatrix a, const UnitMatrix &b) { return a -= b; }
+    friend UnitMatrix operator*(UnitMatrix a, Scalar s) { return a *= s; }
+    friend UnitMatrix operator*(Scalar s, UnitMatrix a) { return a *= s; }
+    friend UnitMatrix operator/(UnitMatrix a, Scalar s) { return a /= s; }
+
+    friend bool operator==(const UnitMatrix &a, const UnitMatrix &b) {
+        return a.storage_ == b.storage_;
+    }
+    friend bool operator!=(const UnitMatrix &a, const UnitMatrix &b) { return !(a == b); }
+
+ private:
+    struct RawTag {};
+
+    UnitMatrix(Storage values, RawTag) : storage_{std::move(values)} {}
+
+    template <typename... Ts>
+    static UnitMatrix from_entries(Ts... values) {
+        const Scalar raw[] = {static_cast<Scalar>(values)...};
+        return from_raw(Eigen::Map<const Storage>{raw});
+    }
+
+    Storage storage_;
+};
+
+// The matrix product.  Every term of each sum must have the same unit.
+template <typename Scalar, typename R1, typename C1, typename R2, typename C2>
+auto operator*(const UnitMatrix<Scalar, R1, C1> &a, const UnitMatrix<Scalar, R2, C2> &b) {
+    using Result = UnitMatrix<Scalar, detail::ScaleUnits<R1, detail::InnerUnit<C1, R2>>, C2>;
+    return Result::from_raw(a.raw() * b.raw());
+}
+
+}  // namespace au
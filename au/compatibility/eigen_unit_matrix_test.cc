@@ -0,0 +1,201 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/compatibility/eigen_unit_matrix.hh"
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+#include "au/au.hh"
+#include "au/testing.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace au {
+
+using ::testing::Eq;
+using ::testing::IsTrue;
+using ::testing::StaticAssertTypeEq;
+
+struct Meters : UnitImpl<Length> {};
+constexpr auto meters = QuantityMaker<Meters>{};
+
+struct Feet : decltype(Meters{} * mag<381>() / mag<1250>()) {};
+constexpr auto feet = QuantityMaker<Feet>{};
+
+struct Secs : UnitImpl<Time> {};
+constexpr auto secs = QuantityMaker<Secs>{};
+
+using MetersPerSec = UnitQuotient<Meters, Secs>;
+constexpr auto meters_per_sec = QuantityMaker<MetersPerSec>{};
+
+using RadiansPerSec = UnitQuotient<Radians, Secs>;
+constexpr auto radians_per_sec = QuantityMaker<RadiansPerSec>{};
+
+// [position, velocity, heading, heading rate bias]
+using State = UnitVector<Meters, MetersPerSec, Radians, RadiansPerSec>;
+
+// [position, heading]
+using Measurement = UnitVector<Meters, Radians>;
+
+// A constant velocity model over a time step `dt`.
+Jacobian<State, State> transition(double dt) {
+    Eigen::Matrix4d f = Eigen::Matrix4d::Identity();
+    f(0, 1) = dt;
+    f(2, 3) = -dt;
+    return Jacobian<State, State>::from_raw(f);
+}
+
+Jacobian<Measurement, State> measurement_model() {
+    Eigen::Matrix<double, 2, 4> h = Eigen::Matrix<double, 2, 4>::Zero();
+    h(0, 0) = 1.0;
+    h(1, 2) = 1.0;
+    return Jacobian<Measurement, State>::from_raw(h);
+}
+
+Covariance<State> diagonal_covariance() {
+    return Covariance<State>::from_raw(Eigen::Vector4d{4.0, 1.0, 0.25, 0.01}.asDiagonal());
+}
+
+TEST(UnitVector, StorageIsExactlyOneEigenVector) {
+    StaticAssertTypeEq<State::Storage, Eigen::Vector4d>();
+    EXPECT_THAT(sizeof(State), Eq(sizeof(Eigen::Vector4d)));
+    EXPECT_THAT(sizeof(Covariance<State>), Eq(sizeof(Eigen::Matrix4d)));
+}
+
+TEST(UnitVector, ConstructsFromOneQuantityPerEntry) {
+    const State x{meters(1.0), meters_per_sec(2.0), radians(3.0), radians_per_sec(4.0)};
+
+    EXPECT_THAT(x.at<0>(), SameTypeAndValue(meters(1.0)));
+    EXPECT_THAT(x.at<1>(), SameTypeAndValue(meters_per_sec(2.0)));
+    EXPECT_THAT(x.at<2>(), SameTypeAndValue(radians(3.0)));
+    EXPECT_THAT(x.at<3>(), SameTypeAndValue(radians_per_sec(4.0)));
+    EXPECT_THAT(x.raw(), Eq(Eigen::Vector4d{1.0, 2.0, 3.0, 4.0}));
+}
+
+TEST(UnitVector, ConvertsEntriesToTheirUnits) {
+    const Measurement z{feet(1'250.0), radians(0.5f)};
+    EXPECT_THAT(z.at<0>(), SameTypeAndValue(meters(381.0)));
+    EXPECT_THAT(z.at<1>(), SameTypeAndValue(radians(0.5)));
+}
+
+TEST(UnitVector, DefaultsToZero) {
+    EXPECT_THAT(State{}.raw(), Eq(Eigen::Vector4d::Zero()));
+    EXPECT_THAT(State{ZERO}, Eq(State{}));
+}
+
+TEST(UnitVector, SetConvertsToUnitOfEntry) {
+    Measurement z;
+    z.set<0>(feet(1'250.0));
+    z.set<1>(radians(2.0));
+    EXPECT_THAT(z, Eq(Measurement{meters(381.0), radians(2.0)}));
+}
+
+TEST(UnitMatrix, EntryUnitIsProductOfRowAndColumnUnits) {
+    StaticAssertTypeEq<Covariance<State>::EntryUnit<0, 0>, UnitPower<Meters, 2>>();
+    StaticAssertTypeEq<Covariance<State>::EntryUnit<0, 2>, UnitProduct<Meters, Radians>>();
+    StaticAssertTypeEq<Jacobian<Measurement, State>::EntryUnit<0, 1>, Secs>();
+    StaticAssertTypeEq<Jacobian<State, State>::EntryUnit<2, 2>, UnitProduct<>>();
+
+    const auto p = diagonal_covariance();
+    EXPECT_THAT((p.at<1, 1>()), SameTypeAndValue(squared(meters_per_sec)(1.0)));
+    EXPECT_THAT((p.at<1, 3>()), SameTypeAndValue((meters_per_sec * radians_per_sec)(0.0)));
+}
+
+TEST(UnitMatrix, TransposeSwapsRowAndColumnUnits) {
+    const auto h = measurement_model();
+    const auto ht = h.transpose();
+    StaticAssertTypeEq<decltype(ht)::EntryUnit<1, 0>, decltype(h)::EntryUnit<0, 1>>();
+    EXPECT_THAT(ht.raw(), Eq(h.raw().transpose()));
+}
+
+TEST(UnitMatrix, JacobianMapsInputVectorToOutputVector) {
+    const State x{meters(1.0), meters_per_sec(2.0), radians(3.0), radians_per_sec(4.0)};
+
+    const auto z = measurement_model() * x;
+    StaticAssertTypeEq<decltype(z), const Measurement>();
+    EXPECT_THAT(z, Eq(Measurement{meters(1.0), radians(3.0)}));
+
+    const auto x_next = transition(0.5) * x;
+    StaticAssertTypeEq<decltype(x_next), const State>();
+    EXPECT_THAT(x_next.at<0>(), SameTypeAndValue(meters(2.0)));
+    EXPECT_THAT(x_next.at<2>(), SameTypeAndValue(radians(1.0)));
+}
+
+TEST(UnitMatrix, CovariancePropagatesThroughJacobian) {
+    const auto f = transition(0.5);
+    const auto p = diagonal_covariance();
+
+    const auto p_next = f * p * f.transpose() + p;
+    StaticAssertTypeEq<decltype(p_next), const Covariance<State>>();
+    EXPECT_THAT(p_next.raw(), Eq(f.raw() * p.raw() * f.raw().transpose() + p.raw()));
+    EXPECT_THAT((p_next.at<0, 1>()), SameTypeAndValue((meters * meters_per_sec)(0.5)));
+
+    const auto s = measurement_model() * p * measurement_model().transpose();
+    StaticAssertTypeEq<decltype(s), const Covariance<Measurement>>();
+}
+
+TEST(UnitMatrix, KalmanUpdateKeepsUnitsConsistent) {
+    const auto h = measurement_model();
+    const auto p = diagonal_covariance();
+    const auto r = Covariance<Measurement>::from_raw(Eigen::Vector2d{1.0, 0.01}.asDiagonal());
+    const State x{meters(1.0), meters_per_sec(2.0), radians(0.0), radians_per_sec(0.0)};
+    const Measurement z{meters(2.0), radians(0.5)};
+
+    const auto s = h * p * h.transpose() + r;
+    const auto k = p * h.transpose() * s.inverse();
+    StaticAssertTypeEq<decltype(k), const Jacobian<State, Measurement>>();
+
+    const auto x_new = x + k * (z - h * x);
+    StaticAssertTypeEq<decltype(x_new), const State>();
+
+    const auto p_new = (Jacobian<State, State>::identity() - k * h) * p;
+    StaticAssertTypeEq<decltype(p_new), const Covariance<State>>();
+
+    // Position: gain 4 / (4 + 1) on an innovation of 1 m.
+    EXPECT_THAT(x_new.at<0>(), IsNear(meters(1.8), meters(1e-12)));
+    EXPECT_THAT((p_new.at<0, 0>()), IsNear(squared(meters)(0.8), squared(meters)(1e-12)));
+}
+
+TEST(UnitMatrix, InverseInvertsEntryUnits) {
+    const auto p = diagonal_covariance();
+    const auto p_inv = p.inverse();
+    StaticAssertTypeEq<decltype(p_inv)::EntryUnit<0, 2>,
+                       UnitInverse<Covariance<State>::EntryUnit<0, 2>>>();
+    EXPECT_THAT((p_inv.at<0, 0>()), SameTypeAndValue(inverse(squared(meters))(0.25)));
+    EXPECT_THAT((p * p_inv).raw().isIdentity(), IsTrue());
+}
+
+TEST(UnitMatrix, SupportsLinearOperations) {
+    const Measurement a{meters(1.0), radians(2.0)};
+    const Measurement b{meters(3.0), radians(5.0)};
+
+    EXPECT_THAT(a + b, Eq(Measurement{meters(4.0), radians(7.0)}));
+    EXPECT_THAT(b - a, Eq(Measurement{meters(2.0), radians(3.0)}));
+    EXPECT_THAT(-a, Eq(Measurement{meters(-1.0), radians(-2.0)}));
+    EXPECT_THAT(2.0 * a, Eq(Measurement{meters(2.0), radians(4.0)}));
+    EXPECT_THAT(a * 2.0, Eq(2.0 * a));
+    EXPECT_THAT(b / 2.0, Eq(Measurement{meters(1.5), radians(2.5)}));
+}
+
+TEST(UnitMatrix, WorksWithFloatScalars) {
+    using StateF = UnitVectorOf<float, Meters, MetersPerSec>;
+    StaticAssertTypeEq<StateF::Storage, Eigen::Vector2f>();
+
+    const StateF x{meters(1.0f), meters_per_sec(2.0f)};
+    const auto f = Jacobian<StateF, StateF>::from_raw((Eigen::Matrix2f{} << 1, 3, 0, 1).finished());
+    EXPECT_THAT((f * x).at<0>(), SameTypeAndValue(meters(7.0f)));
+}
+
+}  // namespace au
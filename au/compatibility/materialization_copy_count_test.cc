@@ -22,6 +22,7 @@
 // the theoretical minimum for each path.  Each `Tracked` copy is O(n) (it duplicates a
 // `std::vector<double>`); each move is O(1); so "copies" is the number that actually matters.
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -48,6 +49,7 @@ struct Counts {
     int copies = 0;  // copy-constructions + copy-assignments of `Tracked`
     int moves = 0;   // move-constructions + move-assignments of `Tracked`
     int evals = 0;   // materializations of a lazy expression rep into a concrete `Tracked`
+    int passes = 0;  // full passes over the coefficients, for scaling or for a risk check
 };
 Counts &counts() {
     static Counts c;
@@ -84,6 +86,7 @@ class Tracked {
     // Eager scalar scaling.  This is the "one conversion pass" for a unit conversion: it produces a
     // brand-new `Tracked` from a fresh computation, so it is NOT a copy of any existing `Tracked`.
     Tracked operator*(double s) const {
+        ++counts().passes;
         std::vector<double> out = data_;
         for (auto &x : out) {
             x *= s;
@@ -113,6 +116,27 @@ class Tracked {
     // `eval(q)`.
     Tracked eval() const { return *this; }
 
+    // Eigen-style reductions.  Au's runtime risk checks (via `"au/compatibility/eigen.hh"`) detect
+    // Eigen-like reps by `minCoeff()`, and use `visit()`.  Each is one pass over the coefficients,
+    // and copies nothing.
+    std::size_t size() const { return data_.size(); }
+    double minCoeff() const {
+        ++counts().passes;
+        return *std::min_element(data_.begin(), data_.end());
+    }
+    double maxCoeff() const {
+        ++counts().passes;
+        return *std::max_element(data_.begin(), data_.end());
+    }
+    template <typename Visitor>
+    void visit(Visitor &visitor) const {
+        ++counts().passes;
+        visitor.init(data_[0], std::size_t{0}, std::size_t{0});
+        for (std::size_t i = 1; i < data_.size(); ++i) {
+            visitor(data_[i], i, std::size_t{0});
+        }
+    }
+
     const std::vector<double> &data() const { return data_; }
 
  private:
@@ -233,5 +257,32 @@ TEST_F(MaterializationCopyCount, SameUnitAsCopiesExactlyOnce) {
     EXPECT_THAT(same.data_in(meters).data().size(), Eq(std::size_t{8}));
 }
 
+// (5) A runtime-checked unit conversion: the risk check makes a single pass over the coefficients
+// in place (finding both bounds at once), and the conversion is the usual single scaling pass.
+// Nothing is copied, and no intermediate mask or converted value is materialized.
+TEST_F(MaterializationCopyCount, RuntimeCheckedConversionZeroCopies) {
+    auto q = meters(make_tracked(8));
+
+    ConversionFailure failure;
+    auto in_feet = q.as<Tracked>(feet, check_at_runtime(ALL_RISKS, record_failure_in(failure)));
+    EXPECT_THAT(counts().copies, Eq(0));
+    EXPECT_THAT(counts().passes, Eq(2));
+    EXPECT_THAT(static_cast<bool>(failure), Eq(false));
+
+    EXPECT_THAT(in_feet.data_in(feet).data().size(), Eq(std::size_t{8}));
+}
+
+// (6) A conversion which can't overflow for any input (here, a multiplication by less than 1 in
+// `double`) skips the reductions entirely: the only pass is the scaling.
+TEST_F(MaterializationCopyCount, RuntimeCheckSkipsReductionsWhenConversionCannotOverflow) {
+    auto q = feet(make_tracked(8));
+
+    auto in_meters = q.as<Tracked>(meters, check_at_runtime(ALL_RISKS));
+    EXPECT_THAT(counts().copies, Eq(0));
+    EXPECT_THAT(counts().passes, Eq(1));
+
+    EXPECT_THAT(in_meters.data_in(meters).data().size(), Eq(std::size_t{8}));
+}
+
 }  // namespace
 }  // namespace au
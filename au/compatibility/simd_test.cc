@@ -0,0 +1,147 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <experimental/simd>
+#include <vector>
+
+#include "au/au.hh"
+#include "au/testing.hh"
+#include "au/units/feet.hh"
+#include "au/units/inches.hh"
+#include "au/units/meters.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+// `std::experimental::simd` needs C++17, and a standard library which provides it (for example,
+// libstdc++ from GCC 11 or later), so this test is tagged `manual`.
+
+namespace au {
+namespace {
+
+namespace stdx = std::experimental;
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::FloatEq;
+using ::testing::IsFalse;
+using ::testing::IsTrue;
+using ::testing::StaticAssertTypeEq;
+
+using FloatLanes = stdx::fixed_size_simd<float, 4>;
+using IntLanes = stdx::fixed_size_simd<int32_t, 4>;
+
+template <typename T, typename Abi>
+stdx::simd<T, Abi> make_lanes(std::initializer_list<T> values) {
+    stdx::simd<T, Abi> result;
+    result.copy_from(values.begin(), stdx::element_aligned);
+    return result;
+}
+
+FloatLanes float_lanes(float a, float b, float c, float d) {
+    return make_lanes<float, FloatLanes::abi_type>({a, b, c, d});
+}
+
+IntLanes int_lanes(int32_t a, int32_t b, int32_t c, int32_t d) {
+    return make_lanes<int32_t, IntLanes::abi_type>({a, b, c, d});
+}
+
+template <typename T, typename Abi>
+std::vector<T> lanes(const stdx::simd<T, Abi> &x) {
+    std::vector<T> result;
+    for (std::size_t i = 0u; i < x.size(); ++i) {
+        result.push_back(x[i]);
+    }
+    return result;
+}
+
+TEST(SimdRep, ArithmeticIsLaneWise) {
+    const auto a = meters(float_lanes(1.0f, 2.0f, 3.0f, 4.0f));
+    const auto b = meters(float_lanes(0.5f, 0.5f, 0.5f, 0.5f));
+
+    const auto sum = a + b;
+    StaticAssertTypeEq<decltype(sum), const Quantity<Meters, FloatLanes>>();
+    EXPECT_THAT(lanes(sum.in(meters)), ElementsAre(1.5f, 2.5f, 3.5f, 4.5f));
+    EXPECT_THAT(lanes((a * b).in(squared(meters))), ElementsAre(0.5f, 1.0f, 1.5f, 2.0f));
+}
+
+TEST(SimdRep, ConversionsApplyMagnitudeLaneWise) {
+    const auto d = meters(float_lanes(1.0f, 2.0f, -3.0f, 0.25f));
+    EXPECT_THAT(lanes(d.in(centi(meters))), ElementsAre(100.0f, 200.0f, -300.0f, 25.0f));
+
+    const auto f = feet(int_lanes(1, 2, -3, 0));
+    StaticAssertTypeEq<decltype(f.as(inches)), Quantity<Inches, IntLanes>>();
+    EXPECT_THAT(lanes(f.in(inches)), ElementsAre(12, 24, -36, 0));
+}
+
+TEST(SimdRep, TruncationCheckIsTrueIfAnyLaneTruncates) {
+    EXPECT_THAT(will_conversion_truncate(inches(int_lanes(12, 24, -36, 0)), feet), IsFalse());
+    EXPECT_THAT(will_conversion_truncate(inches(int_lanes(12, 24, -35, 0)), feet), IsTrue());
+}
+
+TEST(SimdRep, OverflowCheckIsTrueIfAnyLaneOverflows) {
+    // 2 m is 2'000'000'000 nm, which fits in `int32_t`; 3 m does not.
+    EXPECT_THAT(will_conversion_overflow(meters(int_lanes(0, 1, -2, 2)), nano(meters)), IsFalse());
+    EXPECT_THAT(will_conversion_overflow(meters(int_lanes(0, 1, -3, 2)), nano(meters)), IsTrue());
+    EXPECT_THAT(will_conversion_overflow(meters(int_lanes(0, 1, -2, 3)), nano(meters)), IsTrue());
+}
+
+TEST(SimdRep, IsConversionLossyReducesAcrossLanes) {
+    EXPECT_THAT(is_conversion_lossy(inches(int_lanes(12, 24, 36, 48)), feet), IsFalse());
+    EXPECT_THAT(is_conversion_lossy(inches(int_lanes(12, 24, 36, 47)), feet), IsTrue());
+    EXPECT_THAT(is_conversion_lossy(meters(int_lanes(3, 0, 0, 0)), nano(meters)), IsTrue());
+}
+
+TEST(SimdRep, AbsIsLaneWise) {
+    const auto x = abs(meters(float_lanes(-1.0f, 2.0f, -0.5f, 0.0f)));
+    StaticAssertTypeEq<decltype(x), const Quantity<Meters, FloatLanes>>();
+    EXPECT_THAT(lanes(x.in(meters)), ElementsAre(1.0f, 2.0f, 0.5f, 0.0f));
+}
+
+TEST(SimdRep, SqrtIsLaneWise) {
+    const auto x = sqrt(squared(meters)(float_lanes(1.0f, 4.0f, 9.0f, 0.25f)));
+    StaticAssertTypeEq<decltype(x), const Quantity<Meters, FloatLanes>>();
+    EXPECT_THAT(lanes(x.in(meters)), ElementsAre(1.0f, 2.0f, 3.0f, 0.5f));
+}
+
+TEST(SimdRep, HypotIsLaneWiseInCommonUnit) {
+    const auto x = hypot(meters(float_lanes(3.0f, 0.0f, 5.0f, 1.0f)),
+                         centi(meters)(float_lanes(400.0f, 100.0f, 1200.0f, 0.0f)));
+    EXPECT_THAT(lanes(x.in(meters)),
+                ElementsAre(FloatEq(5.0f), FloatEq(1.0f), FloatEq(13.0f), FloatEq(1.0f)));
+}
+
+TEST(SimdRep, FmodIsLaneWise) {
+    const auto x = fmod(meters(float_lanes(5.5f, -5.5f, 1.0f, 3.0f)), meters(FloatLanes{2.0f}));
+    EXPECT_THAT(lanes(x.in(meters)), ElementsAre(1.5f, -1.5f, 1.0f, 1.0f));
+}
+
+TEST(SimdRep, RoundingIsLaneWise) {
+    const auto x = meters(float_lanes(1.26f, -1.26f, 1.24f, 0.0f));
+
+    EXPECT_THAT(lanes(round_in(centi(meters) * mag<10>(), x)),
+                ElementsAre(13.0f, -13.0f, 12.0f, 0.0f));
+    EXPECT_THAT(lanes(floor_as(meters, x).in(meters)), ElementsAre(1.0f, -2.0f, 1.0f, 0.0f));
+    EXPECT_THAT(lanes(ceil_in(meters, x)), ElementsAre(2.0f, -1.0f, 2.0f, 0.0f));
+}
+
+TEST(SimdRep, WorksWithNativeAbi) {
+    using Lanes = stdx::native_simd<float>;
+    const auto x = sqrt(squared(meters)(Lanes{16.0f})).in(centi(meters));
+    for (std::size_t i = 0u; i < Lanes::size(); ++i) {
+        EXPECT_THAT(x[i], Eq(400.0f));
+    }
+}
+
+}  // namespace
+}  // namespace au
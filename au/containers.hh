@@ -0,0 +1,408 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "au/conversion_policy.hh"
+#include "au/conversion_strategy.hh"
+#include "au/quantity.hh"
+#include "au/stdx/type_traits.hh"
+#include "au/unit_of_measure.hh"
+#include "au/view.hh"
+
+// Contiguous containers of quantities, which store raw values, and keep the unit in the type.
+//
+// A `std::vector<Quantity<U, R>>` is a fine container, but the only way to hand its storage to
+// code that wants an `R*` (BLAS, compression, I/O, ...) is a `reinterpret_cast` that the language
+// doesn't bless.  `QuantityArray<U, R, N>` and `QuantityVector<U, R, Alloc>` instead hold their
+// values as raw `R` in the first place.  `data_in(unit)` returns a genuine `R*` to that storage, so
+// long as you name a unit that is quantity-equivalent to `U` --- just like `Quantity::data_in()`.
+//
+// Element access is unit safe: a const container gives out `Quantity<U, R>` by value, and a mutable
+// one gives out `Quantity<U, View<R>>`, which writes through to the stored value.
+//
+// `QuantitySpan<U, R>` is the read-only, non-owning counterpart: a pointer to raw `R` values that
+// someone else owns (say, a memory-mapped file), and a size.
+
+namespace au {
+
+template <typename U, typename R, std::size_t N>
+class QuantityArray;
+
+template <typename U, typename R, typename Alloc = std::allocator<R>>
+class QuantityVector;
+
+template <typename U, typename R, std::size_t N>
+constexpr QuantityArray<U, R, N> make_quantity_array(std::array<R, N> values);
+
+template <typename U, typename R, typename Alloc>
+QuantityVector<U, R, Alloc> make_quantity_vector(std::vector<R, Alloc> values);
+
+template <typename U, typename R>
+class QuantitySpan;
+
+template <typename U, typename R>
+constexpr QuantitySpan<U, R> make_quantity_span(const R *data, std::size_t size);
+
+namespace detail {
+
+// Whether `Quantity<U, R>` has the same size, alignment, and (standard) layout as a bare `R`.
+//
+// The containers rely on this to keep their promise that they cost exactly as much memory as the
+// equivalent array of `Quantity<U, R>`, and that they can be filled from one elementwise.
+template <typename U, typename R>
+struct IsQuantityLayoutCompatibleWithRep
+    : stdx::bool_constant<sizeof(Quantity<U, R>) == sizeof(R) &&
+                          alignof(Quantity<U, R>) == alignof(R) &&
+                          std::is_standard_layout<Quantity<U, R>>::value> {};
+
+// The operation for converting the raw values of a container with unit `U` and rep `R`, to the unit
+// `TargetU`.  `TargetR` may be `void`, in which case we use the same rep that `.in()` would.
+template <typename U, typename R, typename TargetU, typename TargetR>
+using ContainerConversionOp =
+    ConversionForRepsAndFactor<UseStaticCast, R, TargetR, UnitRatio<U, TargetU>>;
+
+// Check the risks of converting the values of a container (at compile time).
+template <typename U, typename R, typename TargetU, typename TargetR, typename RiskPolicyT>
+constexpr void assert_container_conversion_ok() {
+    static_assert(IsUnit<TargetU>::value, "Invalid type passed to unit slot");
+    static_assert(HasSameDimension<U, TargetU>::value, "Can only convert same-dimension units");
+    assert_conversion_risk_acceptable<UseStaticCast,
+                                      R,
+                                      TargetR,
+                                      UnitRatio<U, TargetU>,
+                                      CompileTimeRiskPolicy<RiskPolicyT>>();
+}
+
+template <typename Op, typename RiskPolicyT>
+void convert_raw_values(const OpInput<Op> *first,
+                        const OpInput<Op> *last,
+                        OpOutput<Op> *d_first,
+                        RiskPolicyT policy) {
+    for (; first != last; ++first, ++d_first) {
+        *d_first = apply_with_risk_policy<Op>(*first, policy);
+    }
+}
+
+}  // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `QuantityArray<U, R, N>`: a fixed-size array of `N` quantities of unit `U` and rep `R`.
+
+template <typename U, typename R, std::size_t N>
+class QuantityArray {
+    static_assert(detail::IsQuantityLayoutCompatibleWithRep<U, R>::value,
+                  "Quantity<U, R> must have the same layout as R");
+
+ public:
+    using Unit = U;
+    using Rep = R;
+    using value_type = Quantity<U, R>;
+    using size_type = std::size_t;
+    static constexpr auto unit = Unit{};
+
+    // Value-initializes every element (i.e., to zero, for arithmetic reps).
+    constexpr QuantityArray() = default;
+
+    // Construct from exactly `N` quantities, each of which must be implicitly convertible to
+    // `Quantity<U, R>`.
+    template <typename... Qs,
+              std::enable_if_t<sizeof...(Qs) == N &&
+                                   stdx::conjunction<
+                                       std::is_convertible<Qs, Quantity<U, R>>...>::value,
+                               int> = 0>
+    constexpr QuantityArray(Qs... qs)  // NOLINT(runtime/explicit)
+        : values_{{Quantity<U, R>{qs}.data_in(U{})...}} {}
+
+    constexpr size_type size() const { return N; }
+    constexpr bool empty() const { return N == 0u; }
+
+    // Const element access, by value.  (Rvalue arrays also use this, so a view can't dangle.)
+    constexpr Quantity<U, R> operator[](size_type i) const & {
+        return make_quantity<U>(values_[i]);
+    }
+
+    // Mutable element access, through a view.
+    Quantity<U, View<R>> operator[](size_type i) & {
+        return make_quantity<U>(make_view(values_[i]));
+    }
+
+    // Raw access to the stored values, with any Quantity-equivalent unit.
+    template <typename UnitSlot>
+    R *data_in(UnitSlot) {
+        static_assert(AreUnitsQuantityEquivalent<AssociatedUnit<UnitSlot>, Unit>::value,
+                      "Can only access values via Quantity-equivalent unit");
+        return values_.data();
+    }
+    template <typename UnitSlot>
+    constexpr const R *data_in(UnitSlot) const {
+        static_assert(AreUnitsQuantityEquivalent<AssociatedUnit<UnitSlot>, Unit>::value,
+                      "Can only access values via Quantity-equivalent unit");
+        return values_.data();
+    }
+
+    // `a.in<Rep>(new_unit)`, or `a.in<Rep>(new_unit, risk_policy)`: the raw converted values.
+    template <typename NewRep,
+              typename NewUnitSlot,
+              typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+    auto in(NewUnitSlot u, RiskPolicyT policy = RiskPolicyT{}) const {
+        return in_impl<detail::ResolveSameRep<R, NewRep>>(u, policy);
+    }
+
+    // `a.in(new_unit)`, or `a.in(new_unit, risk_policy)`: the raw converted values.
+    template <typename NewUnitSlot, typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+    auto in(NewUnitSlot u, RiskPolicyT policy = RiskPolicyT{}) const {
+        return in_impl<void>(u, policy);
+    }
+
+    // `a.as<Rep>(new_unit)`, or `a.as<Rep>(new_unit, risk_policy)`: a new `QuantityArray`.
+    template <typename NewRep,
+              typename NewUnitSlot,
+              typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+    auto as(NewUnitSlot u, RiskPolicyT policy = RiskPolicyT{}) const {
+        return make_quantity_array<AssociatedUnit<NewUnitSlot>>(in<NewRep>(u, policy));
+    }
+
+    // `a.as(new_unit)`, or `a.as(new_unit, risk_policy)`: a new `QuantityArray`.
+    template <typename NewUnitSlot, typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+    auto as(NewUnitSlot u, RiskPolicyT policy = RiskPolicyT{}) const {
+        return make_quantity_array<AssociatedUnit<NewUnitSlot>>(in(u, policy));
+    }
+
+    // Permit the factory, which names the unit explicitly, to use our private constructor.
+    template <typename UU, typename RR, std::size_t NN>
+    friend constexpr QuantityArray<UU, RR, NN> make_quantity_array(std::array<RR, NN> values);
+
+ private:
+    constexpr explicit QuantityArray(std::array<R, N> values) : values_{values} {}
+
+    template <typename TargetR, typename NewUnitSlot, typename RiskPolicyT>
+    auto in_impl(NewUnitSlot, RiskPolicyT policy) const {
+        using NewUnit = AssociatedUnit<NewUnitSlot>;
+        detail::assert_container_conversion_ok<U, R, NewUnit, TargetR, RiskPolicyT>();
+
+        using Op = detail::ContainerConversionOp<U, R, NewUnit, TargetR>;
+        std::array<detail::OpOutput<Op>, N> result;
+        detail::convert_raw_values<Op>(values_.data(), values_.data() + N, result.data(), policy);
+        return result;
+    }
+
+    std::array<R, N> values_{};
+};
+
+// Make a `QuantityArray` of unit `U` from an array of raw values.
+//
+// Usage: `make_quantity_array<Meters>(std::array<double, 3>{{1.0, 2.0, 3.0}})`.
+template <typename U, typename R, std::size_t N>
+constexpr QuantityArray<U, R, N> make_quantity_array(std::array<R, N> values) {
+    return QuantityArray<U, R, N>{values};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `QuantityVector<U, R, Alloc>`: a resizable, allocator-aware vector of quantities of unit `U` and
+// rep `R`.  `Alloc` allocates the raw `R` values.
+
+template <typename U, typename R, typename Alloc>
+class QuantityVector {
+    static_assert(detail::IsQuantityLayoutCompatibleWithRep<U, R>::value,
+                  "Quantity<U, R> must have the same layout as R");
+    static_assert(std::is_same<typename std::allocator_traits<Alloc>::value_type, R>::value,
+                  "Allocator must allocate values of type R");
+
+    template <typename T>
+    using ReboundAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+
+ public:
+    using Unit = U;
+    using Rep = R;
+    using value_type = Quantity<U, R>;
+    using allocator_type = Alloc;
+    using size_type = std::size_t;
+    static constexpr auto unit = Unit{};
+
+    QuantityVector() = default;
+    explicit QuantityVector(const Alloc &alloc) : values_(alloc) {}
+
+    // `n` value-initialized elements (i.e., zero, for arithmetic reps).
+    explicit QuantityVector(size_type n, const Alloc &alloc = Alloc{}) : values_(n, alloc) {}
+
+    // `n` copies of `q`.
+    QuantityVector(size_type n, Quantity<U, R> q, const Alloc &alloc = Alloc{})
+        : values_(n, q.data_in(U{}), alloc) {}
+
+    QuantityVector(std::initializer_list<Quantity<U, R>> qs, const Alloc &alloc = Alloc{})
+        : values_(alloc) {
+        values_.reserve(qs.size());
+        for (const auto &q : qs) {
+            values_.push_back(q.data_in(U{}));
+        }
+    }
+
+    allocator_type get_allocator() const { return values_.get_allocator(); }
+
+    size_type size() const { return values_.size(); }
+    bool empty() const { return values_.empty(); }
+    size_type capacity() const { return values_.capacity(); }
+    void reserve(size_type n) { values_.reserve(n); }
+    void resize(size_type n) { values_.resize(n); }
+    void resize(size_type n, Quantity<U, R> q) { values_.resize(n, q.data_in(U{})); }
+    void clear() { values_.clear(); }
+    void push_back(Quantity<U, R> q) { values_.push_back(q.data_in(U{})); }
+
+    // Const element access, by value.  (Rvalue vectors also use this, so a view can't dangle.)
+    Quantity<U, R> operator[](size_type i) const & { return make_quantity<U>(values_[i]); }
+
+    // Mutable element access, through a view.
+    Quantity<U, View<R>> operator[](size_type i) & {
+        return make_quantity<U>(make_view(values_[i]));
+    }
+
+    // Raw access to the stored values, with any Quantity-equivalent unit.
+    template <typename UnitSlot>
+    R *data_in(UnitSlot) {
+        static_assert(AreUnitsQuantityEquivalent<AssociatedUnit<UnitSlot>, Unit>::value,
+                      "Can only access values via Quantity-equivalent unit");
+        return values_.data();
+    }
+    template <typename UnitSlot>
+    const R *data_in(UnitSlot) const {
+        static_assert(AreUnitsQuantityEquivalent<AssociatedUnit<UnitSlot>, Unit>::value,
+                      "Can only access values via Quantity-equivalent unit");
+        return values_.data();
+    }
+
+    // `v.in<Rep>(new_unit)`, or `v.in<Rep>(new_unit, risk_policy)`: the raw converted values.
+    template <typename NewRep,
+              typename NewUnitSlot,
+              typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+    auto in(NewUnitSlot u, RiskPolicyT policy = RiskPolicyT{}) const {
+        return in_impl<detail::ResolveSameRep<R, NewRep>>(u, policy);
+    }
+
+    // `v.in(new_unit)`, or `v.in(new_unit, risk_policy)`: the raw converted values.
+    template <typename NewUnitSlot, typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+    auto in(NewUnitSlot u, RiskPolicyT policy = RiskPolicyT{}) const {
+        return in_impl<void>(u, policy);
+    }
+
+    // `v.as<Rep>(new_unit)`, or `v.as<Rep>(new_unit, risk_policy)`: a new `QuantityVector`.
+    template <typename NewRep,
+              typename NewUnitSlot,
+              typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+    auto as(NewUnitSlot u, RiskPolicyT policy = RiskPolicyT{}) const {
+        return make_quantity_vector<AssociatedUnit<NewUnitSlot>>(in<NewRep>(u, policy));
+    }
+
+    // `v.as(new_unit)`, or `v.as(new_unit, risk_policy)`: a new `QuantityVector`.
+    template <typename NewUnitSlot, typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+    auto as(NewUnitSlot u, RiskPolicyT policy = RiskPolicyT{}) const {
+        return make_quantity_vector<AssociatedUnit<NewUnitSlot>>(in(u, policy));
+    }
+
+    // Permit the factory, which names the unit explicitly, to use our private constructor.
+    template <typename UU, typename RR, typename AA>
+    friend QuantityVector<UU, RR, AA> make_quantity_vector(std::vector<RR, AA> values);
+
+ private:
+    explicit QuantityVector(std::vector<R, Alloc> values) : values_{std::move(values)} {}
+
+    // The converted values use this vector's allocator, rebound to the new rep.
+    template <typename TargetR, typename NewUnitSlot, typename RiskPolicyT>
+    auto in_impl(NewUnitSlot, RiskPolicyT policy) const {
+        using NewUnit = AssociatedUnit<NewUnitSlot>;
+        detail::assert_container_conversion_ok<U, R, NewUnit, TargetR, RiskPolicyT>();
+
+        using Op = detail::ContainerConversionOp<U, R, NewUnit, TargetR>;
+        using NewRep = detail::OpOutput<Op>;
+        std::vector<NewRep, ReboundAlloc<NewRep>> result(values_.size(),
+                                                         ReboundAlloc<NewRep>{get_allocator()});
+        detail::convert_raw_values<Op>(values_.data(),
+                                       values_.data() + values_.size(),
+                                       result.data(),
+                                       policy);
+        return result;
+    }
+
+    std::vector<R, Alloc> values_;
+};
+
+// Make a `QuantityVector` of unit `U` from a vector of raw values, taking ownership of its storage.
+//
+// Usage: `make_quantity_vector<Meters>(std::move(raw_values))`.
+template <typename U, typename R, typename Alloc>
+QuantityVector<U, R, Alloc> make_quantity_vector(std::vector<R, Alloc> values) {
+    return QuantityVector<U, R, Alloc>{std::move(values)};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `QuantitySpan<U, R>`: a read-only view of contiguous raw values, in unit `U` and rep `R`, owned
+// by someone else.
+
+template <typename U, typename R>
+class QuantitySpan {
+    static_assert(detail::IsQuantityLayoutCompatibleWithRep<U, R>::value,
+                  "Quantity<U, R> must have the same layout as R");
+
+ public:
+    using Unit = U;
+    using Rep = R;
+    using value_type = Quantity<U, R>;
+    using size_type = std::size_t;
+    static constexpr auto unit = Unit{};
+
+    // An empty span.
+    constexpr QuantitySpan() = default;
+
+    constexpr size_type size() const { return size_; }
+    constexpr bool empty() const { return size_ == 0u; }
+
+    // Element access, by value.
+    constexpr Quantity<U, R> operator[](size_type i) const { return make_quantity<U>(data_[i]); }
+
+    // Raw access to the viewed values, with any Quantity-equivalent unit.
+    template <typename UnitSlot>
+    constexpr const R *data_in(UnitSlot) const {
+        static_assert(AreUnitsQuantityEquivalent<AssociatedUnit<UnitSlot>, Unit>::value,
+                      "Can only access values via Quantity-equivalent unit");
+        return data_;
+    }
+
+    // Permit the factory, which names the unit explicitly, to use our private constructor.
+    template <typename UU, typename RR>
+    friend constexpr QuantitySpan<UU, RR> make_quantity_span(const RR *data, std::size_t size);
+
+ private:
+    constexpr QuantitySpan(const R *data, size_type size) : data_{data}, size_{size} {}
+
+    const R *data_{nullptr};
+    size_type size_{0u};
+};
+
+// View `size` raw values, starting at `data`, as quantities of unit `U`.
+//
+// Usage: `make_quantity_span<Meters>(raw_values.data(), raw_values.size())`.
+template <typename U, typename R>
+constexpr QuantitySpan<U, R> make_quantity_span(const R *data, std::size_t size) {
+    return QuantitySpan<U, R>{data, size};
+}
+
+}  // namespace au
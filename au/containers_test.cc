@@ -0,0 +1,295 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/containers.hh"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace au {
+
+using ::testing::ElementsAre;
+using ::testing::Eq;
+using ::testing::IsFalse;
+using ::testing::IsTrue;
+using ::testing::StaticAssertTypeEq;
+
+struct Inches : UnitImpl<Length> {};
+constexpr auto inches = QuantityMaker<Inches>{};
+
+struct Feet : decltype(Inches{} * mag<12>()) {};
+constexpr auto feet = QuantityMaker<Feet>{};
+
+struct Meters : decltype(Inches{} * mag<10'000>() / mag<254>()) {};
+constexpr auto meters = QuantityMaker<Meters>{};
+
+// An allocator which counts how many times it has allocated, to check that containers use it.
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    explicit CountingAllocator(std::size_t *count) : num_allocations{count} {}
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U> &other) : num_allocations{other.num_allocations} {}
+
+    T *allocate(std::size_t n) {
+        if (num_allocations) {
+            ++(*num_allocations);
+        }
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) { std::allocator<T>{}.deallocate(p, n); }
+
+    std::size_t *num_allocations = nullptr;
+};
+template <typename T, typename U>
+bool operator==(const CountingAllocator<T> &a, const CountingAllocator<U> &b) {
+    return a.num_allocations == b.num_allocations;
+}
+template <typename T, typename U>
+bool operator!=(const CountingAllocator<T> &a, const CountingAllocator<U> &b) {
+    return !(a == b);
+}
+
+TEST(IsQuantityLayoutCompatibleWithRep, TrueForArithmeticReps) {
+    EXPECT_THAT((detail::IsQuantityLayoutCompatibleWithRep<Meters, float>::value), IsTrue());
+    EXPECT_THAT((detail::IsQuantityLayoutCompatibleWithRep<Feet, int8_t>::value), IsTrue());
+    EXPECT_THAT((detail::IsQuantityLayoutCompatibleWithRep<Inches, double>::value), IsTrue());
+}
+
+TEST(QuantityArray, HasSameSizeAsArrayOfQuantities) {
+    EXPECT_THAT(sizeof(QuantityArray<Meters, float, 5>),
+                Eq(sizeof(std::array<Quantity<Meters, float>, 5>)));
+}
+
+TEST(QuantityArray, DefaultConstructsToZero) {
+    const QuantityArray<Meters, float, 3> a;
+    EXPECT_THAT(a[0], SameTypeAndValue(meters(0.0f)));
+    EXPECT_THAT(a[2], SameTypeAndValue(meters(0.0f)));
+}
+
+TEST(QuantityArray, ConstructsFromQuantitiesWithImplicitConversion) {
+    const QuantityArray<Inches, int, 3> a{inches(1), feet(2), inches(3)};
+
+    EXPECT_THAT(a.size(), Eq(3u));
+    EXPECT_THAT(a[0], SameTypeAndValue(inches(1)));
+    EXPECT_THAT(a[1], SameTypeAndValue(inches(24)));
+    EXPECT_THAT(a[2], SameTypeAndValue(inches(3)));
+}
+
+TEST(QuantityArray, CannotConstructFromQuantitiesNeedingExplicitConversion) {
+    EXPECT_THAT((std::is_constructible<QuantityArray<Feet, int, 1>, Quantity<Inches, int>>::value),
+                IsFalse());
+    EXPECT_THAT((std::is_constructible<QuantityArray<Feet, int, 2>, Quantity<Feet, int>>::value),
+                IsFalse());
+}
+
+TEST(QuantityArray, DataInGivesRawPointerToStoredValues) {
+    auto a = make_quantity_array<Meters>(std::array<float, 3>{{1.0f, 2.0f, 3.0f}});
+
+    float *data = a.data_in(meters);
+    data[1] = 20.0f;
+
+    const auto &const_a = a;
+    EXPECT_THAT(const_a[1], SameTypeAndValue(meters(20.0f)));
+}
+
+TEST(QuantityArray, MutableElementAccessWritesThrough) {
+    QuantityArray<Inches, int, 2> a{inches(1), inches(2)};
+
+    StaticAssertTypeEq<decltype(a[0]), Quantity<Inches, View<int>>>();
+    a[0] = feet(1);
+    a[1] *= 3;
+
+    EXPECT_THAT(a.data_in(inches)[0], Eq(12));
+    EXPECT_THAT(a.data_in(inches)[1], Eq(6));
+}
+
+TEST(QuantityArray, ElementAccessOnRvalueArrayReturnsValue) {
+    StaticAssertTypeEq<decltype(QuantityArray<Inches, int, 2>{}[0]), Quantity<Inches, int>>();
+}
+
+TEST(QuantityArray, InReturnsRawArrayInNewUnit) {
+    const QuantityArray<Feet, int, 2> a{feet(1), feet(-2)};
+
+    const auto in_inches = a.in(inches);
+
+    StaticAssertTypeEq<decltype(in_inches), const std::array<int, 2>>();
+    EXPECT_THAT(in_inches, ElementsAre(12, -24));
+}
+
+TEST(QuantityArray, AsReturnsNewArrayMatchingElementwiseAs) {
+    const QuantityArray<Meters, double, 3> a{meters(0.0), meters(1.0), meters(-2.5)};
+
+    const auto in_inches = a.as(inches);
+
+    StaticAssertTypeEq<decltype(in_inches), const QuantityArray<Inches, double, 3>>();
+    for (auto i = 0u; i < a.size(); ++i) {
+        EXPECT_THAT(in_inches[i], SameTypeAndValue(a[i].as(inches)));
+    }
+}
+
+TEST(QuantityArray, SupportsExplicitRepAndRiskPolicy) {
+    const QuantityArray<Inches, int, 2> a{inches(18), inches(-30)};
+
+    EXPECT_THAT(a.as<int16_t>(feet, ignore(TRUNCATION_RISK))[1],
+                SameTypeAndValue(feet(int16_t{-2})));
+    EXPECT_THAT(a.in<double>(feet), ElementsAre(1.5, -2.5));
+}
+
+TEST(QuantityArray, SupportsSaturatePolicy) {
+    const QuantityArray<Feet, int, 3> a{feet(-11), feet(1), feet(11)};
+
+    EXPECT_THAT(a.in<int8_t>(inches, saturate),
+                ElementsAre(int8_t{-128}, int8_t{12}, int8_t{127}));
+}
+
+TEST(QuantityArray, ConstAccessIsConstexprCompatible) {
+    constexpr QuantityArray<Feet, int, 2> a{feet(3), feet(4)};
+    constexpr auto second = a[1];
+    constexpr auto size = a.size();
+
+    EXPECT_THAT(second, SameTypeAndValue(feet(4)));
+    EXPECT_THAT(size, Eq(2u));
+}
+
+TEST(QuantityVector, DefaultConstructsEmpty) {
+    const QuantityVector<Meters, float> v;
+    EXPECT_THAT(v.empty(), IsTrue());
+    EXPECT_THAT(v.size(), Eq(0u));
+}
+
+TEST(QuantityVector, ConstructsFromInitializerListOfQuantities) {
+    const QuantityVector<Inches, int> v{inches(1), feet(1)};
+
+    EXPECT_THAT(v.size(), Eq(2u));
+    EXPECT_THAT(v[0], SameTypeAndValue(inches(1)));
+    EXPECT_THAT(v[1], SameTypeAndValue(inches(12)));
+}
+
+TEST(QuantityVector, ConstructsCopiesOfValue) {
+    const QuantityVector<Meters, double> v(3u, meters(1.5));
+    EXPECT_THAT(v.in(meters), ElementsAre(1.5, 1.5, 1.5));
+}
+
+TEST(QuantityVector, PushBackAndResizeGrowTheVector) {
+    QuantityVector<Inches, int> v;
+    v.push_back(inches(4));
+    v.push_back(feet(1));
+    v.resize(3u);
+
+    EXPECT_THAT(v.in(inches), ElementsAre(4, 12, 0));
+
+    v.clear();
+    EXPECT_THAT(v.empty(), IsTrue());
+}
+
+TEST(QuantityVector, MakeQuantityVectorTakesOwnershipOfRawStorage) {
+    std::vector<float> raw = {1.0f, 2.0f};
+    const float *storage = raw.data();
+
+    const auto v = make_quantity_vector<Meters>(std::move(raw));
+
+    StaticAssertTypeEq<decltype(v), const QuantityVector<Meters, float>>();
+    EXPECT_THAT(v.data_in(meters), Eq(storage));
+}
+
+TEST(QuantityVector, DataInGivesRawPointerToStoredValues) {
+    QuantityVector<Meters, float> v(2u);
+
+    float *data = v.data_in(meters);
+    data[0] = 5.0f;
+
+    const auto &const_v = v;
+    EXPECT_THAT(const_v[0], SameTypeAndValue(meters(5.0f)));
+}
+
+TEST(QuantityVector, MutableElementAccessWritesThrough) {
+    QuantityVector<Meters, double> v(2u);
+
+    v[1] = meters(3.0);
+    v[1] *= 2.0;
+
+    EXPECT_THAT(v.in(meters), ElementsAre(0.0, 6.0));
+}
+
+TEST(QuantityVector, AsReturnsNewVectorMatchingElementwiseAs) {
+    const QuantityVector<Meters, double> v{meters(1.0), meters(-2.5), meters(123.456)};
+
+    const auto in_inches = v.as(inches);
+
+    StaticAssertTypeEq<decltype(in_inches), const QuantityVector<Inches, double>>();
+    ASSERT_THAT(in_inches.size(), Eq(v.size()));
+    for (auto i = 0u; i < v.size(); ++i) {
+        EXPECT_THAT(in_inches[i], SameTypeAndValue(v[i].as(inches)));
+    }
+}
+
+TEST(QuantityVector, InUsesSamePromotedRepAsQuantityIn) {
+    const QuantityVector<Feet, int8_t> v{feet(int8_t{100})};
+
+    const auto in_inches = v.in(inches);
+
+    StaticAssertTypeEq<decltype(in_inches)::value_type, decltype(feet(int8_t{1}).in(inches))>();
+    EXPECT_THAT(in_inches[0], Eq(1200));
+}
+
+TEST(QuantityVector, ConversionsUseReboundAllocator) {
+    std::size_t num_allocations = 0u;
+    using Alloc = CountingAllocator<int>;
+    const QuantityVector<Feet, int, Alloc> v(4u, feet(1), Alloc{&num_allocations});
+    ASSERT_THAT(num_allocations, Eq(1u));
+
+    const auto in_inches = v.as<double>(inches);
+
+    StaticAssertTypeEq<decltype(in_inches),
+                       const QuantityVector<Inches, double, CountingAllocator<double>>>();
+    EXPECT_THAT(num_allocations, Eq(2u));
+    EXPECT_THAT(in_inches[3], SameTypeAndValue(inches(12.0)));
+}
+
+TEST(QuantitySpan, DefaultConstructsEmpty) {
+    constexpr QuantitySpan<Meters, double> span{};
+    EXPECT_THAT(span.empty(), IsTrue());
+    EXPECT_THAT(span.size(), Eq(0u));
+}
+
+TEST(QuantitySpan, ViewsRawValuesWithoutCopying) {
+    const std::vector<float> raw{1.0f, 2.5f, -3.0f};
+    const auto span = make_quantity_span<Meters>(raw.data(), raw.size());
+
+    StaticAssertTypeEq<decltype(span), const QuantitySpan<Meters, float>>();
+    EXPECT_THAT(span.size(), Eq(3u));
+    EXPECT_THAT(span.empty(), IsFalse());
+    EXPECT_THAT(span[1], SameTypeAndValue(meters(2.5f)));
+    EXPECT_THAT(span.data_in(meters), Eq(raw.data()));
+}
+
+TEST(QuantitySpan, ConstAccessIsConstexprCompatible) {
+    static constexpr int raw[] = {3, 4};
+    constexpr auto span = make_quantity_span<Feet>(raw, 2u);
+    constexpr auto second = span[1];
+    EXPECT_THAT(second, SameTypeAndValue(feet(4)));
+}
+
+}  // namespace au
@@ -14,8 +14,10 @@
 
 #pragma once
 
+#include <cassert>
 #include <limits>
 
+#include "au/bounded.hh"
 #include "au/config.hh"
 #include "au/conversion_strategy.hh"
 #include "au/magnitude.hh"
@@ -110,6 +112,244 @@ template <uint8_t RiskFlags>
 struct IsConversionRiskPolicy<detail::CheckTheseRisks<detail::RiskSet<RiskFlags>>>
     : std::true_type {};
 
+//
+// Runtime-checked conversion risk section.
+//
+// `check_at_runtime(risks)` produces a policy that permits a conversion no matter how risky it is.
+// Instead of rejecting it at compile time, we test each converted value for the risks in `risks`.
+// If any of them is realized, we pass a `ConversionFailure` describing it to a handler.  A value
+// which doesn't overflow converts just as it would with `ignore(ALL_RISKS)`.  A value which does
+// overflow saturates instead (for scalar reps), because the raw conversion could be UB.
+//
+// The default handler asserts.  `check_at_runtime(risks, handler)` calls any callable `handler`
+// instead, and `check_at_runtime(risks, record_failure_in(failure))` accumulates the failures in
+// the `ConversionFailure` variable `failure`, to support an "error code" style.
+//
+// The tests use the same precomputed bounds as `will_conversion_overflow()`, and the same model as
+// `will_conversion_truncate()`.  A risk that can't happen for any input costs nothing at all.
+//
+
+// The risks that were realized when converting some particular value.
+//
+// We pack the risks into a single byte of flags, rather than one `bool` each: some compilers keep
+// a small struct of several `bool` members in a register, and merge the bytes in and out of it
+// one at a time.  That can make a fused check-and-convert noticeably slower than it needs to be.
+class ConversionFailure {
+ public:
+    AU_DEVICE_FUNC constexpr ConversionFailure() = default;
+    AU_DEVICE_FUNC constexpr ConversionFailure(bool overflow, bool truncation)
+        : flags_{static_cast<uint8_t>(
+              (overflow ? static_cast<uint8_t>(detail::ConversionRisk::Overflow) : 0u) |
+              (truncation ? static_cast<uint8_t>(detail::ConversionRisk::Truncation) : 0u))} {}
+
+    AU_DEVICE_FUNC constexpr bool overflow() const {
+        return (flags_ & static_cast<uint8_t>(detail::ConversionRisk::Overflow)) != 0u;
+    }
+    AU_DEVICE_FUNC constexpr bool truncation() const {
+        return (flags_ & static_cast<uint8_t>(detail::ConversionRisk::Truncation)) != 0u;
+    }
+
+    // Whether any risk was realized.
+    AU_DEVICE_FUNC constexpr explicit operator bool() const { return flags_ != 0u; }
+
+    // Every risk which was realized in either of two failures.
+    AU_DEVICE_FUNC constexpr ConversionFailure operator|(ConversionFailure other) const {
+        return ConversionFailure{overflow() || other.overflow(),
+                                 truncation() || other.truncation()};
+    }
+
+ private:
+    uint8_t flags_ = 0u;
+};
+
+namespace detail {
+struct AssertNoConversionFailure {
+    AU_DEVICE_FUNC void operator()(ConversionFailure) const {
+        assert(false && "Conversion was lossy; see `check_at_runtime()`");
+    }
+};
+
+struct RecordFailureIn {
+    AU_DEVICE_FUNC constexpr void operator()(ConversionFailure failure) const {
+        *sink = *sink | failure;
+    }
+
+    ConversionFailure *sink;
+};
+
+template <typename RiskSetT, typename Handler>
+struct CheckTheseRisksAtRuntime;
+
+template <uint8_t RiskFlags, typename Handler>
+struct CheckTheseRisksAtRuntime<RiskSet<RiskFlags>, Handler> {
+    AU_DEVICE_FUNC constexpr bool should_check(ConversionRisk risk) const {
+        return CheckTheseRisks<RiskSet<RiskFlags>>{}.should_check(risk);
+    }
+
+    Handler on_failure;
+};
+}  // namespace detail
+
+template <uint8_t RiskFlags>
+AU_DEVICE_FUNC constexpr auto check_at_runtime(detail::RiskSet<RiskFlags>) {
+    return detail::CheckTheseRisksAtRuntime<detail::RiskSet<RiskFlags>,
+                                            detail::AssertNoConversionFailure>{};
+}
+
+template <uint8_t RiskFlags, typename Handler>
+AU_DEVICE_FUNC constexpr auto check_at_runtime(detail::RiskSet<RiskFlags>, Handler handler) {
+    return detail::CheckTheseRisksAtRuntime<detail::RiskSet<RiskFlags>, Handler>{handler};
+}
+
+AU_DEVICE_FUNC constexpr detail::RecordFailureIn record_failure_in(ConversionFailure &failure) {
+    return {&failure};
+}
+
+// `IsRuntimeConversionRiskPolicy<T>` checks whether `T` is a policy made by `check_at_runtime()`.
+//
+// These are deliberately _not_ `IsConversionRiskPolicy`, because only the functions that actually
+// convert values (`.in()` and `.as()` on `Quantity`, `QuantityPoint`, and the containers, the
+// widened conversions, and the batch `convert()`) can perform the runtime checks.  Everything else
+// which takes a risk policy (such as the batch lossiness checkers) will reject them.
+template <typename T>
+struct IsRuntimeConversionRiskPolicy : std::false_type {};
+template <uint8_t RiskFlags, typename Handler>
+struct IsRuntimeConversionRiskPolicy<
+    detail::CheckTheseRisksAtRuntime<detail::RiskSet<RiskFlags>, Handler>> : std::true_type {};
+
+//
+// Saturating conversion section.
+//
+// Passing `saturate` as the policy makes a conversion clamp on overflow: any value that would
+// overflow produces the nearest limit of the destination rep instead (or of its bounds, if it is
+// `Bounded`).  Since overflow can no longer happen, `saturate` doesn't check for it.  It does still
+// check truncation risk at compile time; use `saturate.but_ignoring(TRUNCATION_RISK)` to opt out.
+//
+// Saturation works wherever runtime-checked policies do (see above).
+//
+
+namespace detail {
+template <typename RiskSetT>
+struct SaturateOnOverflow;
+
+template <uint8_t RiskFlags>
+struct SaturateOnOverflow<RiskSet<RiskFlags>> {
+    static_assert((RiskFlags & static_cast<uint8_t>(ConversionRisk::Overflow)) == 0u,
+                  "Saturating conversions can't overflow, so there's no overflow risk to check");
+
+    // The risks that we check at compile time.
+    AU_DEVICE_FUNC constexpr bool should_check(ConversionRisk risk) const {
+        return CheckTheseRisks<RiskSet<RiskFlags>>{}.should_check(risk);
+    }
+
+    // Remove risks from the set that we check at compile time.
+    template <uint8_t OtherFlags>
+    AU_DEVICE_FUNC constexpr SaturateOnOverflow<RiskSet<RiskFlags & ~OtherFlags>> but_ignoring(
+        RiskSet<OtherFlags>) const {
+        return {};
+    }
+};
+}  // namespace detail
+
+AU_DEVICE_VAR constexpr auto saturate =
+    detail::SaturateOnOverflow<detail::RiskSet<static_cast<uint8_t>(
+        detail::ConversionRisk::Truncation)>>{};
+
+namespace detail {
+template <typename T>
+struct IsSaturatingPolicy : std::false_type {};
+template <uint8_t RiskFlags>
+struct IsSaturatingPolicy<SaturateOnOverflow<RiskSet<RiskFlags>>> : std::true_type {};
+
+// Any policy that the value-converting functions accept.
+template <typename T>
+struct IsAnyConversionRiskPolicy : stdx::disjunction<IsConversionRiskPolicy<T>,
+                                                     IsRuntimeConversionRiskPolicy<T>,
+                                                     IsSaturatingPolicy<T>> {};
+
+// The policy to enforce at compile time.  Runtime-checked policies defer every risk to runtime, and
+// saturating policies check everything except overflow (which can't happen).
+template <typename RiskPolicyT>
+struct CompileTimeRiskPolicyImpl : stdx::type_identity<RiskPolicyT> {};
+template <uint8_t RiskFlags, typename Handler>
+struct CompileTimeRiskPolicyImpl<CheckTheseRisksAtRuntime<RiskSet<RiskFlags>, Handler>>
+    : stdx::type_identity<CheckTheseRisks<RiskSet<0u>>> {};
+template <uint8_t RiskFlags>
+struct CompileTimeRiskPolicyImpl<SaturateOnOverflow<RiskSet<RiskFlags>>>
+    : stdx::type_identity<CheckTheseRisks<RiskSet<RiskFlags>>> {};
+template <typename RiskPolicyT>
+using CompileTimeRiskPolicy = typename CompileTimeRiskPolicyImpl<RiskPolicyT>::type;
+
+// The risks in `RiskSet<RiskFlags>` which converting `x` with the conversion `Op` would realize.
+template <typename Op, uint8_t RiskFlags>
+AU_DEVICE_FUNC constexpr ConversionFailure realized_risks(const OpInput<Op> &x,
+                                                          RiskSet<RiskFlags> risks) {
+    const auto policy = check_for(risks);
+    return {policy.should_check(ConversionRisk::Overflow) && would_value_overflow<Op>(x),
+            policy.should_check(ConversionRisk::Truncation) &&
+                TruncationRiskFor<Op>::would_value_truncate(x)};
+}
+
+// Whether a runtime checked conversion `Op` can saturate when it overflows: that is, whether its
+// output is a real scalar (or a `Bounded` one).
+template <typename Op>
+struct CanSaturateAfterOverflow : std::is_arithmetic<Unbounded<OpOutput<Op>>> {};
+
+// The result of a runtime checked conversion `Op`, for an input `x` which we know would overflow.
+//
+// Applying `Op` to `x` could be undefined behavior (for example, signed integer overflow), so when
+// we can, we saturate instead.  Otherwise, we can only hand back the raw conversion, which the
+// caller must not evaluate.
+template <typename Op>
+AU_DEVICE_FUNC constexpr auto apply_after_overflow(const OpInput<Op> &x, std::true_type) {
+    return static_cast<decltype(Op::apply_to(x))>(saturating_apply<Op>(x));
+}
+template <typename Op>
+AU_DEVICE_FUNC constexpr auto apply_after_overflow(const OpInput<Op> &x, std::false_type) {
+    return Op::apply_to(x);
+}
+
+// How a runtime checked policy applies the conversion `Op`: `apply_to(x)` when `x` passed the
+// checks, and `apply_after_overflow(x)` when it would overflow.  The two must return the same type.
+//
+// A rep with many lanes can't saturate as a whole, but it can saturate each lane separately, if it
+// returns something other than the plain conversion.  Such reps can specialize this: for example,
+// `"au/compatibility/eigen.hh"` does so for Eigen's types.
+template <typename Op, typename Enable = void>
+struct RuntimeCheckedApply {
+    static AU_DEVICE_FUNC constexpr auto apply_to(const OpInput<Op> &x) { return Op::apply_to(x); }
+
+    static AU_DEVICE_FUNC constexpr auto apply_after_overflow(const OpInput<Op> &x) {
+        return detail::apply_after_overflow<Op>(x, CanSaturateAfterOverflow<Op>{});
+    }
+};
+
+// Apply the conversion `Op` to `x`, performing whatever runtime checks (or saturation) the policy
+// calls for.
+template <typename Op, uint8_t RiskFlags>
+AU_DEVICE_FUNC constexpr auto apply_with_risk_policy(const OpInput<Op> &x,
+                                                     CheckTheseRisks<RiskSet<RiskFlags>>) {
+    return Op::apply_to(x);
+}
+template <typename Op, uint8_t RiskFlags, typename Handler>
+AU_DEVICE_FUNC constexpr auto apply_with_risk_policy(
+    const OpInput<Op> &x, const CheckTheseRisksAtRuntime<RiskSet<RiskFlags>, Handler> &policy) {
+    const auto failure = realized_risks<Op>(x, RiskSet<RiskFlags>{});
+    if (failure) {
+        policy.on_failure(failure);
+        if (failure.overflow()) {
+            return RuntimeCheckedApply<Op>::apply_after_overflow(x);
+        }
+    }
+    return RuntimeCheckedApply<Op>::apply_to(x);
+}
+template <typename Op, uint8_t RiskFlags>
+AU_DEVICE_FUNC constexpr auto apply_with_risk_policy(const OpInput<Op> &x,
+                                                     SaturateOnOverflow<RiskSet<RiskFlags>>) {
+    return saturating_apply<Op>(x);
+}
+}  // namespace detail
+
 //
 // "Main" conversion policy section.
 //
@@ -122,11 +362,13 @@ constexpr auto OVERFLOW_THRESHOLD = mag<2'147>();
 // that has a real _part_, but is not purely real (call it a "mixed-real" type).
 //
 // The point is to guard against situations where we're _implicitly_ converting a "mixed-real" type
-// (i.e., typically a complex number) to a pure real type.
+// (i.e., typically a complex number) to a pure real type.  A `Bounded` rep is as purely real as the
+// raw type it holds.
 template <typename Rep, typename SourceRep>
 struct SettingPureRealFromMixedReal
-    : stdx::conjunction<stdx::negation<std::is_same<SourceRep, RealPart<SourceRep>>>,
-                        std::is_same<Rep, RealPart<Rep>>> {};
+    : stdx::conjunction<
+          stdx::negation<std::is_same<Unbounded<SourceRep>, RealPart<SourceRep>>>,
+          std::is_same<Unbounded<Rep>, RealPart<Rep>>> {};
 
 template <typename T>
 AU_DEVICE_FUNC constexpr bool meets_threshold(T x) {
@@ -144,6 +386,9 @@ AU_DEVICE_FUNC constexpr bool meets_threshold(T x) {
 }
 
 // Check overflow risk from above.
+//
+// If no possible input can overflow, the risk is zero.  This is how a `Bounded` rep whose bounds
+// prove a conversion safe gets through, even when its raw type would not.
 template <bool CanOverflowAbove, typename Op>
 struct OverflowAboveRiskAcceptablyLowImpl
     : stdx::bool_constant<meets_threshold(MaxGood<Op>::value())> {};
@@ -206,6 +451,78 @@ template <typename CastStrategy, typename Rep, typename ScaleFactor, typename So
 struct PassesConversionRiskCheck<CastStrategy, Rep, ScaleFactor, SourceRep, false>
     : std::false_type {};
 
+// Produce a readable compile time error if converting `SourceRep` to `Rep` by `ScaleFactor`, using
+// the operation `Op`, carries any risk which `RiskPolicyT` asks us to check, and which is too high.
+//
+// Most callers should use `assert_conversion_risk_acceptable()` (below), which supplies the usual
+// operation.  That one is shared by every explicit conversion entry point (`.in()`, `.as()`, batch
+// conversions, ...), so that they all produce the same errors, with the same troubleshooting links.
+template <typename Op,
+          typename SourceRep,
+          typename Rep,
+          typename ScaleFactor,
+          typename RiskPolicyT>
+AU_DEVICE_FUNC constexpr void assert_op_risk_acceptable() {
+    constexpr bool should_check_overflow = RiskPolicyT{}.should_check(ConversionRisk::Overflow);
+    constexpr bool is_overflow_risk_ok =
+        stdx::disjunction<OverflowRiskAcceptablyLow<Op>,
+                          PermitAsCarveOutForIntegerPromotion<Rep, ScaleFactor, SourceRep>>::value;
+
+    constexpr bool should_check_truncation =
+        RiskPolicyT{}.should_check(ConversionRisk::Truncation);
+    constexpr bool is_truncation_risk_ok = TruncationRiskAcceptablyLow<Op>::value;
+
+    constexpr bool is_overflow_only_unacceptable_risk =
+        (should_check_overflow && !is_overflow_risk_ok && is_truncation_risk_ok);
+    static_assert(!is_overflow_only_unacceptable_risk,
+                  "Overflow risk too high.  See "
+                  "<https://aurora-opensource.github.io/au/main/troubleshooting/#risk-too-high>"
+                  ".  Your \"risk set\" is `OVERFLOW_RISK`.");
+
+    constexpr bool is_truncation_only_unacceptable_risk =
+        (should_check_truncation && !is_truncation_risk_ok && is_overflow_risk_ok);
+    static_assert(!is_truncation_only_unacceptable_risk,
+                  "Truncation risk too high.  See "
+                  "<https://aurora-opensource.github.io/au/main/troubleshooting/#risk-too-high>"
+                  ".  Your \"risk set\" is `TRUNCATION_RISK`.");
+
+    constexpr bool are_both_overflow_and_truncation_unacceptably_risky =
+        (should_check_overflow || should_check_truncation) && !is_overflow_risk_ok &&
+        !is_truncation_risk_ok;
+    static_assert(!are_both_overflow_and_truncation_unacceptably_risky,
+                  "Both truncation and overflow risk too high.  See "
+                  "<https://aurora-opensource.github.io/au/main/troubleshooting/#risk-too-high>"
+                  ".  Your \"risk set\" is `OVERFLOW_RISK | TRUNCATION_RISK`.");
+}
+
+template <typename CastStrategy,
+          typename SourceRep,
+          typename Rep,
+          typename ScaleFactor,
+          typename RiskPolicyT>
+AU_DEVICE_FUNC constexpr void assert_conversion_risk_acceptable() {
+    assert_op_risk_acceptable<ConversionForRepsAndFactor<CastStrategy, SourceRep, Rep, ScaleFactor>,
+                              SourceRep,
+                              Rep,
+                              ScaleFactor,
+                              RiskPolicyT>();
+}
+
+// `ImplicitConversionCastStrategy<SourceRep, Rep>` is the cast strategy for carrying out an
+// implicit conversion (which `ImplicitConversionPolicy` has already permitted) from `SourceRep` to
+// `Rep`.
+//
+// Usually, this is `UseImplicitConversion`, so that we only use conversions which the reps
+// themselves permit implicitly.  But if `SourceRep` is a `Bounded`, the conversion to an arithmetic
+// `Rep` may narrow (say, from `int` to `int16_t`), because the bounds prove that no value can
+// change.  The compiler can't see that, so we spell the narrowing out with `static_cast`, which
+// keeps it from tripping `-Wconversion`.
+template <typename SourceRep, typename Rep>
+using ImplicitConversionCastStrategy =
+    std::conditional_t<stdx::conjunction<IsBounded<SourceRep>, std::is_arithmetic<Rep>>::value,
+                       UseStaticCast,
+                       UseImplicitConversion>;
+
 template <typename CastStrategy, typename Rep, typename ScaleFactor, typename SourceRep>
 using ImplicitConversionPolicy =
     stdx::conjunction<PassesConversionRiskCheck<CastStrategy, Rep, ScaleFactor, SourceRep>,
@@ -63,6 +63,38 @@ TEST(IsConversionRiskPolicy, FalseForNonConversionPolicy) {
     EXPECT_THAT(is_conversion_risk_policy(Grams{}), IsFalse());
 }
 
+TEST(IsConversionRiskPolicy, FalseForRuntimeCheckedPolicy) {
+    EXPECT_THAT(is_conversion_risk_policy(check_at_runtime(ALL_RISKS)), IsFalse());
+}
+
+TEST(IsRuntimeConversionRiskPolicy, TrueOnlyForRuntimeCheckedPolicy) {
+    ConversionFailure failure;
+    EXPECT_THAT(IsRuntimeConversionRiskPolicy<decltype(check_at_runtime(ALL_RISKS))>::value,
+                IsTrue());
+    EXPECT_THAT(IsRuntimeConversionRiskPolicy<decltype(check_at_runtime(
+                    OVERFLOW_RISK, record_failure_in(failure)))>::value,
+                IsTrue());
+    EXPECT_THAT(IsRuntimeConversionRiskPolicy<decltype(check_for(ALL_RISKS))>::value, IsFalse());
+}
+
+TEST(CheckAtRuntime, ChecksOnlyNamedRisks) {
+    constexpr auto policy = check_at_runtime(OVERFLOW_RISK);
+    EXPECT_THAT(policy.should_check(detail::ConversionRisk::Overflow), IsTrue());
+    EXPECT_THAT(policy.should_check(detail::ConversionRisk::Truncation), IsFalse());
+}
+
+TEST(CheckAtRuntime, RecordFailureInAccumulatesFailures) {
+    ConversionFailure failure;
+    EXPECT_THAT(static_cast<bool>(failure), IsFalse());
+
+    const auto record = record_failure_in(failure);
+    record(ConversionFailure{true, false});
+    record(ConversionFailure{false, false});
+    EXPECT_THAT(failure.overflow(), IsTrue());
+    EXPECT_THAT(failure.truncation(), IsFalse());
+    EXPECT_THAT(static_cast<bool>(failure), IsTrue());
+}
+
 TEST(ConversionRisk, IgnoreOverflowRiskChecksTruncationRiskButNotOverflowRisk) {
     constexpr auto policy = ignore(OVERFLOW_RISK);
     EXPECT_THAT(policy.should_check(detail::ConversionRisk::Overflow), IsFalse());
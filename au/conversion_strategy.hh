@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "au/abstract_operations.hh"
 #include "au/magnitude.hh"
 #include "au/stdx/type_traits.hh"
@@ -37,6 +39,20 @@ template <typename CastType, typename OldRep, typename NewRep, typename Factor>
 using ConversionForRepsAndFactor =
     typename ConversionForRepsAndFactorImpl<CastType, OldRep, NewRep, Factor>::type;
 
+#if defined(__SIZEOF_INT128__)
+//
+// `WidenedConversionForRepsAndFactor<CastType, OldRep, NewRep, Factor>` is just like
+// `ConversionForRepsAndFactor`, except that when the conversion would multiply an integral type by
+// the numerator of `Factor` and then divide by its denominator, it computes the intermediate
+// product in a 128-bit integer (see `WideMultiplyDivide`).  All other conversions are unchanged.
+//
+template <typename CastType, typename OldRep, typename NewRep, typename Factor>
+struct WidenedConversionForRepsAndFactorImpl;
+template <typename CastType, typename OldRep, typename NewRep, typename Factor>
+using WidenedConversionForRepsAndFactor =
+    typename WidenedConversionForRepsAndFactorImpl<CastType, OldRep, NewRep, Factor>::type;
+#endif
+
 // Provide `UseStaticCast` as the first parameter to `ConversionForRepsAndFactor` to use
 // `static_cast` to convert between representations.
 struct UseStaticCast {};
@@ -232,5 +248,64 @@ template <typename CastType, typename OldRep>
 struct ConversionForRepsAndFactorImpl<CastType, OldRep, void, Magnitude<>>
     : FullConversionImpl<CastType, OldRep, OldRep, OldRep, Magnitude<>> {};
 
+#if defined(__SIZEOF_INT128__)
+//
+// `WidenedConversionForRepsAndFactor` implementation.
+//
+
+// Whether `WideMultiplyDivide` can (and should) apply `Mag` to a value of type `T`.
+template <typename T, typename Mag>
+struct ShouldWidenApplicationOfMag
+    : stdx::conjunction<
+          std::is_same<MagKindFor<Mag>, MagKindHolder<MagKind::NONTRIVIAL_RATIONAL>>,
+          std::is_integral<T>,
+          stdx::bool_constant<(sizeof(T) <= sizeof(std::uint64_t))>,
+          stdx::disjunction<std::is_signed<T>, IsPositive<Mag>>,
+          stdx::bool_constant<(IsMagnitudeU64RationalCompatible<Mag>::numerator_fits() &&
+                               IsMagnitudeU64RationalCompatible<Mag>::denominator_fits())>> {};
+
+// Omit the cast when the types already match.
+template <typename CastType, typename T, typename U>
+struct CastSequenceUnlessSameImpl : CastSequenceImpl<CastType, T, U> {};
+template <typename CastType, typename T>
+struct CastSequenceUnlessSameImpl<CastType, T, T> : stdx::type_identity<OpSequence<>> {};
+template <typename CastType, typename T, typename U>
+using CastSequenceUnlessSame = typename CastSequenceUnlessSameImpl<CastType, T, U>::type;
+
+// Use `WideMultiplyDivide` if we can; otherwise, fall back to `UsualConversion`.
+template <typename CastType,
+          typename OldRep,
+          typename ConversionRepT,
+          typename NewRep,
+          typename Factor,
+          typename UsualConversion>
+struct WidenedConversionImpl
+    : std::conditional<ShouldWidenApplicationOfMag<ConversionRepT, Factor>::value,
+                       OpSequence<CastSequenceUnlessSame<CastType, OldRep, ConversionRepT>,
+                                  WideMultiplyDivide<ConversionRepT, Factor>,
+                                  CastSequenceUnlessSame<CastType, ConversionRepT, NewRep>>,
+                       UsualConversion> {};
+
+template <typename CastType, typename OldRep, typename NewRep, typename Factor>
+struct WidenedConversionForRepsAndFactorImpl
+    : WidenedConversionImpl<CastType,
+                            OldRep,
+                            ConversionRep<OldRep, NewRep>,
+                            NewRep,
+                            Factor,
+                            ConversionForRepsAndFactor<CastType, OldRep, NewRep, Factor>> {};
+
+// As for `ConversionForRepsAndFactor`, `void` means "no explicit rep": the result has the promoted
+// type of `OldRep`.
+template <typename CastType, typename OldRep, typename Factor>
+struct WidenedConversionForRepsAndFactorImpl<CastType, OldRep, void, Factor>
+    : WidenedConversionImpl<CastType,
+                            OldRep,
+                            PromotedType<OldRep>,
+                            PromotedType<OldRep>,
+                            Factor,
+                            ConversionForRepsAndFactor<CastType, OldRep, void, Factor>> {};
+#endif
+
 }  // namespace detail
 }  // namespace au
@@ -187,5 +187,38 @@ TEST(ConversionForRepsAndFactor,
                                   ImplicitConversion<std::complex<double>, std::complex<float>>>>();
 }
 
+#if defined(__SIZEOF_INT128__)
+TEST(WidenedConversionForRepsAndFactor, ApplyingNontrivialRationalToIntegralTypeIsWideOp) {
+    using M = decltype(mag<9>() / mag<100'000>());
+    StaticAssertTypeEq<WidenedConversionForRepsAndFactor<UseStaticCast, int64_t, int64_t, M>,
+                       OpSequence<WideMultiplyDivide<int64_t, M>>>();
+    StaticAssertTypeEq<WidenedConversionForRepsAndFactor<UseStaticCast, int64_t, void, M>,
+                       OpSequence<WideMultiplyDivide<int64_t, M>>>();
+}
+
+TEST(WidenedConversionForRepsAndFactor, CastsToAndFromConversionRepAsNeeded) {
+    using M = decltype(mag<3>() / mag<4>());
+    StaticAssertTypeEq<WidenedConversionForRepsAndFactor<UseStaticCast, int16_t, uint8_t, M>,
+                       OpSequence<StaticCast<int16_t, int>,
+                                  WideMultiplyDivide<int, M>,
+                                  StaticCast<int, uint8_t>>>();
+}
+
+TEST(WidenedConversionForRepsAndFactor, OtherConversionsAreSameAsConversionForRepsAndFactor) {
+    using M = decltype(mag<3>() / mag<4>());
+    StaticAssertTypeEq<WidenedConversionForRepsAndFactor<UseStaticCast, double, double, M>,
+                       ConversionForRepsAndFactor<UseStaticCast, double, double, M>>();
+
+    using N = decltype(mag<1>() / mag<4>());
+    StaticAssertTypeEq<WidenedConversionForRepsAndFactor<UseStaticCast, int64_t, int64_t, N>,
+                       ConversionForRepsAndFactor<UseStaticCast, int64_t, int64_t, N>>();
+
+    using Negative = decltype(-mag<3>() / mag<4>());
+    StaticAssertTypeEq<
+        WidenedConversionForRepsAndFactor<UseStaticCast, uint64_t, uint64_t, Negative>,
+        ConversionForRepsAndFactor<UseStaticCast, uint64_t, uint64_t, Negative>>();
+}
+#endif
+
 }  // namespace detail
 }  // namespace au
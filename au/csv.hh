@@ -0,0 +1,401 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "au/also_accept.hh"
+#include "au/containers.hh"
+#include "au/from_chars.hh"
+#include "au/quantity.hh"
+#include "au/unit_of_measure.hh"
+
+// A streaming, column-oriented reader for CSV files whose headers carry unit labels.
+//
+// A header field looks like `speed [km/h]`: a column name, then a unit label in square brackets.
+// The caller asks for columns by name, each with a destination unit (and, optionally, alternative
+// units it should accept).  When the reader opens the file, it matches each column's label against
+// the `unit_label()` of these units, and computes a single conversion factor for the column.  After
+// that, reading a value costs a `std::from_chars` call and one multiplication.
+//
+// Rows are read in chunks, into one `QuantityVector` per column, whose storage the reader reuses
+// from chunk to chunk.  Memory use is bounded by the chunk size and the longest line, no matter how
+// large the file is.
+//
+// This requires full `std::from_chars` support (including floating point types), which means C++17
+// and a sufficiently recent standard library.  Don't include this file in other configurations.
+
+namespace au {
+
+// A column to read: its name in the header, the destination unit and rep, and any alternative units
+// it may be stored in.
+template <typename U, typename R, typename... Alternatives>
+struct CsvColumn {
+    const char *name;
+};
+
+// Request the column called `name`, to be read in `unit` with rep `R`, accepting any of the units
+// in `alternatives` too (e.g., `csv_column<double>("speed", meters / second, also_accept(...))`).
+template <typename R, typename UnitSlot, typename... Alternatives>
+constexpr CsvColumn<AssociatedUnit<UnitSlot>, R, Alternatives...> csv_column(
+    const char *name, UnitSlot, AlsoAccept<Alternatives...> = {}) {
+    return {name};
+}
+
+template <typename... Columns>
+class CsvReader;
+
+enum class CsvOutcome {
+    OK,
+    ERR_MISSING_HEADER,
+    ERR_NO_SUCH_COLUMN,
+    ERR_UNSUPPORTED_UNIT,
+    ERR_MISSING_FIELD,
+    ERR_INVALID_NUMBER,
+};
+
+template <typename T>
+struct CsvResult {
+    CsvOutcome outcome;
+
+    // Only valid/meaningful if `outcome` is `OK`.
+    T value = {};
+};
+
+// Read the header line of the CSV file in `in`, and make a reader for the requested columns.
+//
+// The reader keeps a pointer to `in`, which must outlive it.
+template <typename... Columns>
+CsvResult<CsvReader<Columns...>> open_csv(std::istream &in, Columns... columns);
+
+namespace detail {
+
+inline const char *trim_trailing_spaces(const char *first, const char *last) {
+    while (last != first && *(last - 1) == ' ') {
+        --last;
+    }
+    return last;
+}
+
+// Whether all of `[first, last)` is `label` (where spaces in `label` are optional, as for parsing).
+inline bool is_whole_label(const char *first, const char *last, const char *label) {
+    return match_label(first, last, label) == last;
+}
+
+// If `[first, last)` is the label of one of the `AlsoAccept` units, store the factor which converts
+// a value in that unit to a value in `U`.
+template <typename U, typename R>
+bool match_alternative_unit(const char *, const char *, R &, AlsoAccept<>) {
+    return false;
+}
+template <typename U, typename R, typename A, typename... As>
+bool match_alternative_unit(const char *first,
+                            const char *last,
+                            R &factor,
+                            AlsoAccept<A, As...>) {
+    if (is_whole_label(first, last, unit_label(A{}))) {
+        factor = make_quantity<A>(R{1}).in(U{});
+        return true;
+    }
+    return match_alternative_unit<U>(first, last, factor, AlsoAccept<As...>{});
+}
+
+// Match the label in `[first, last)` against each unit that the column accepts.  On success, store
+// the conversion factor to the destination unit in `factor`.
+template <typename U, typename R, typename... Alternatives>
+bool match_column_unit(const char *first,
+                       const char *last,
+                       CsvColumn<U, R, Alternatives...>,
+                       R &factor) {
+    static_assert((HasSameDimension<U, Alternatives>::value && ...),
+                  "Can only accept units with the same dimension as the destination");
+
+    if (is_whole_label(first, last, unit_label(U{}))) {
+        factor = R{1};
+        return true;
+    }
+    return match_alternative_unit<U>(first, last, factor, AlsoAccept<Alternatives...>{});
+}
+
+template <typename Column>
+struct CsvColumnTraits;
+template <typename U, typename R, typename... Alternatives>
+struct CsvColumnTraits<CsvColumn<U, R, Alternatives...>> {
+    using Unit = U;
+    using Rep = R;
+    using Storage = QuantityVector<U, R>;
+};
+
+}  // namespace detail
+
+template <typename... Columns>
+class CsvReader {
+    template <std::size_t I>
+    using ColumnTraits = detail::CsvColumnTraits<std::tuple_element_t<I, std::tuple<Columns...>>>;
+
+ public:
+    static_assert(sizeof...(Columns) > 0u, "Must request at least one column");
+    static_assert((std::is_floating_point<typename detail::CsvColumnTraits<Columns>::Rep>::value &&
+                   ...),
+                  "CSV columns require a floating point rep");
+
+    // The size of the first buffer the reader uses to read the input.  The buffer grows if a single
+    // line doesn't fit.
+    static constexpr std::size_t INITIAL_BUFFER_SIZE = 64u * 1024u;
+
+    // A reader with no input.
+    CsvReader() = default;
+
+    // Read up to `max_rows` rows, replacing the contents of every column.
+    //
+    // The result holds the number of rows read, which is `0` at the end of the input.  Blank lines
+    // are skipped.  On failure, the columns hold every row before the one that failed, and
+    // `line_number()` tells which line that was.
+    CsvResult<std::size_t> read_chunk(std::size_t max_rows) {
+        for_each_column([&](auto &column) {
+            column.clear();
+            column.reserve(max_rows);
+        });
+
+        std::size_t rows = 0u;
+        const char *first;
+        const char *last;
+        while (rows < max_rows && next_line(first, last)) {
+            if (first == last) {
+                continue;
+            }
+            const CsvOutcome outcome = read_row(first, last);
+            if (outcome != CsvOutcome::OK) {
+                return {outcome, rows};
+            }
+            ++rows;
+        }
+        return {CsvOutcome::OK, rows};
+    }
+
+    // The values of the `I`th requested column (in the order passed to `open_csv()`), as of the
+    // last chunk.
+    template <std::size_t I>
+    const typename ColumnTraits<I>::Storage &column() const {
+        return std::get<I>(columns_);
+    }
+
+    // The (one-based) number of the last line read, counting the header as line 1.
+    std::size_t line_number() const { return line_number_; }
+
+ private:
+    template <typename... Cs>
+    friend CsvResult<CsvReader<Cs...>> open_csv(std::istream &in, Cs... columns);
+
+    using Reps = std::tuple<typename detail::CsvColumnTraits<Columns>::Rep...>;
+
+    explicit CsvReader(std::istream &in)
+        : in_{&in}, buffer_(INITIAL_BUFFER_SIZE), at_end_{false} {}
+
+    template <typename F>
+    void for_each_column(F &&f) {
+        std::apply([&](auto &...columns) { (f(columns), ...); }, columns_);
+    }
+
+    // Match the header line against the requested columns, and compute each column's factor.
+    CsvOutcome read_header(Columns... columns) {
+        const char *first;
+        const char *last;
+        if (!next_line(first, last)) {
+            return CsvOutcome::ERR_MISSING_HEADER;
+        }
+        return match_columns(first, last, std::index_sequence_for<Columns...>{}, columns...);
+    }
+
+    template <std::size_t... Is>
+    CsvOutcome match_columns(const char *first,
+                             const char *last,
+                             std::index_sequence<Is...>,
+                             Columns... columns) {
+        CsvOutcome outcome = CsvOutcome::OK;
+        const auto match = [&](auto column, std::size_t &field, auto &factor) {
+            if (outcome == CsvOutcome::OK) {
+                outcome = match_column(first, last, column, field, factor);
+            }
+        };
+        (match(columns, fields_[Is], std::get<Is>(factors_)), ...);
+        if (outcome != CsvOutcome::OK) {
+            return outcome;
+        }
+
+        num_fields_ = 0u;
+        for (const std::size_t field : fields_) {
+            num_fields_ = std::max(num_fields_, field + 1u);
+        }
+        field_bounds_.resize(num_fields_);
+        return CsvOutcome::OK;
+    }
+
+    // Find the header field named `column.name`, and match its unit label.
+    template <typename Column, typename R>
+    static CsvOutcome match_column(
+        const char *first, const char *last, Column column, std::size_t &field, R &factor) {
+        const std::size_t name_length = std::strlen(column.name);
+        for (std::size_t i = 0u;; ++i) {
+            const char *end = next_comma(first, last);
+            const char *name_first = detail::skip_spaces(first, end);
+            const char *open = static_cast<const char *>(
+                std::memchr(name_first, '[', static_cast<std::size_t>(end - name_first)));
+            const char *name_last = detail::trim_trailing_spaces(name_first, open ? open : end);
+
+            if (static_cast<std::size_t>(name_last - name_first) == name_length &&
+                std::memcmp(name_first, column.name, name_length) == 0) {
+                const char *label_last = detail::trim_trailing_spaces(name_first, end);
+                if (open == nullptr || *(label_last - 1) != ']') {
+                    return CsvOutcome::ERR_UNSUPPORTED_UNIT;
+                }
+                const char *label_first = detail::skip_spaces(open + 1, label_last - 1);
+                label_last = detail::trim_trailing_spaces(label_first, label_last - 1);
+                if (!detail::match_column_unit(label_first, label_last, column, factor)) {
+                    return CsvOutcome::ERR_UNSUPPORTED_UNIT;
+                }
+                field = i;
+                return CsvOutcome::OK;
+            }
+            if (end == last) {
+                return CsvOutcome::ERR_NO_SUCH_COLUMN;
+            }
+            first = end + 1;
+        }
+    }
+
+    static const char *next_comma(const char *first, const char *last) {
+        const char *comma = static_cast<const char *>(
+            std::memchr(first, ',', static_cast<std::size_t>(last - first)));
+        return comma ? comma : last;
+    }
+
+    // Parse one row, and append its values to the columns (only if every value parses).
+    CsvOutcome read_row(const char *first, const char *last) {
+        for (std::size_t i = 0u; i < num_fields_; ++i) {
+            const char *end = next_comma(first, last);
+            field_bounds_[i] = {first, end};
+            if (end == last && i + 1u < num_fields_) {
+                return CsvOutcome::ERR_MISSING_FIELD;
+            }
+            first = end + (end == last ? 0 : 1);
+        }
+
+        Reps values;
+        if (!parse_fields(values, std::index_sequence_for<Columns...>{})) {
+            return CsvOutcome::ERR_INVALID_NUMBER;
+        }
+        append(values, std::index_sequence_for<Columns...>{});
+        return CsvOutcome::OK;
+    }
+
+    template <std::size_t... Is>
+    bool parse_fields(Reps &values, std::index_sequence<Is...>) const {
+        return (parse_field(field_bounds_[fields_[Is]], std::get<Is>(values)) && ...);
+    }
+
+    template <typename R>
+    static bool parse_field(std::pair<const char *, const char *> bounds, R &value) {
+        const char *first = detail::skip_spaces(bounds.first, bounds.second);
+        const char *last = detail::trim_trailing_spaces(first, bounds.second);
+        const auto result = std::from_chars(first, last, value);
+        return result.ec == std::errc{} && result.ptr == last;
+    }
+
+    template <std::size_t... Is>
+    void append(const Reps &values, std::index_sequence<Is...>) {
+        (std::get<Is>(columns_).push_back(make_quantity<typename ColumnTraits<Is>::Unit>(
+             std::get<Is>(values) * std::get<Is>(factors_))),
+         ...);
+    }
+
+    // Point `[first, last)` at the next line (without its line ending), reading more input as
+    // needed.  Return `false` at the end of the input.
+    bool next_line(const char *&first, const char *&last) {
+        while (true) {
+            if (at_end_ && begin_ == end_) {
+                return false;
+            }
+            const char *begin = buffer_.data() + begin_;
+            const char *end = buffer_.data() + end_;
+            const char *newline = static_cast<const char *>(
+                std::memchr(begin, '\n', static_cast<std::size_t>(end - begin)));
+            if (newline != nullptr || at_end_) {
+                first = begin;
+                last = newline ? newline : end;
+                begin_ = static_cast<std::size_t>((newline ? newline + 1 : end) - buffer_.data());
+                if (last != first && *(last - 1) == '\r') {
+                    --last;
+                }
+                ++line_number_;
+                return true;
+            }
+            refill();
+        }
+    }
+
+    // Move the unread (partial) line to the start of the buffer, growing the buffer if the line
+    // fills it, and read as much input as fits after it.
+    void refill() {
+        std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+        end_ -= begin_;
+        begin_ = 0u;
+        if (end_ == buffer_.size()) {
+            buffer_.resize(2u * buffer_.size());
+        }
+        in_->read(buffer_.data() + end_, static_cast<std::streamsize>(buffer_.size() - end_));
+        end_ += static_cast<std::size_t>(in_->gcount());
+        at_end_ = !*in_;
+    }
+
+    std::istream *in_ = nullptr;
+    std::vector<char> buffer_;
+    std::size_t begin_ = 0u;
+    std::size_t end_ = 0u;
+    bool at_end_ = true;
+    std::size_t line_number_ = 0u;
+
+    // For each requested column: its index among the fields of a row, and its conversion factor.
+    std::array<std::size_t, sizeof...(Columns)> fields_{};
+    Reps factors_{};
+
+    // The number of leading fields of each row we need to look at, and their bounds in the row.
+    std::size_t num_fields_ = 0u;
+    std::vector<std::pair<const char *, const char *>> field_bounds_;
+
+    std::tuple<typename detail::CsvColumnTraits<Columns>::Storage...> columns_;
+};
+
+template <typename... Columns>
+CsvResult<CsvReader<Columns...>> open_csv(std::istream &in, Columns... columns) {
+    CsvReader<Columns...> reader{in};
+    const CsvOutcome outcome = reader.read_header(columns...);
+    if (outcome != CsvOutcome::OK) {
+        return {outcome};
+    }
+    return {CsvOutcome::OK, std::move(reader)};
+}
+
+}  // namespace au
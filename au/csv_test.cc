@@ -0,0 +1,154 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/csv.hh"
+
+#include <sstream>
+#include <string>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/feet.hh"
+#include "au/units/hours.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace au {
+namespace {
+
+using ::testing::Eq;
+
+TEST(OpenCsv, ReadsRequestedColumnsInRequestedOrder) {
+    std::istringstream in{
+        "time [s],label,distance [m]\n"
+        "0.5,a,10\n"
+        "1.5,b,20.25\n"};
+
+    auto file =
+        open_csv(in, csv_column<double>("distance", meters), csv_column<double>("time", seconds));
+    ASSERT_THAT(file.outcome, Eq(CsvOutcome::OK));
+
+    const auto chunk = file.value.read_chunk(10u);
+    EXPECT_THAT(chunk.outcome, Eq(CsvOutcome::OK));
+    ASSERT_THAT(chunk.value, Eq(2u));
+
+    const auto &distance = file.value.column<0>();
+    const auto &time = file.value.column<1>();
+    EXPECT_THAT(distance[0], SameTypeAndValue(meters(10.0)));
+    EXPECT_THAT(distance[1], SameTypeAndValue(meters(20.25)));
+    EXPECT_THAT(time[0], SameTypeAndValue(seconds(0.5)));
+    EXPECT_THAT(time[1], SameTypeAndValue(seconds(1.5)));
+
+    EXPECT_THAT(file.value.read_chunk(10u).value, Eq(0u));
+}
+
+TEST(OpenCsv, ConvertsFromAlternativeUnits) {
+    std::istringstream in{"speed [km / h]\n36\n72\n"};
+
+    auto file = open_csv(
+        in, csv_column<double>("speed", meters / second, also_accept(kilo(meters) / hour)));
+    ASSERT_THAT(file.outcome, Eq(CsvOutcome::OK));
+    ASSERT_THAT(file.value.read_chunk(10u).value, Eq(2u));
+
+    const auto tolerance = (meters / second)(1e-12);
+    EXPECT_THAT(file.value.column<0>()[0], IsNear((meters / second)(10.0), tolerance));
+    EXPECT_THAT(file.value.column<0>()[1], IsNear((meters / second)(20.0), tolerance));
+}
+
+TEST(OpenCsv, MatchesLabelsWithOrWithoutSpaces) {
+    std::istringstream in{" speed  [ km/h ] \n36\n"};
+
+    auto file = open_csv(
+        in, csv_column<double>("speed", meters / second, also_accept(kilo(meters) / hour)));
+    EXPECT_THAT(file.outcome, Eq(CsvOutcome::OK));
+}
+
+TEST(OpenCsv, ReportsHeaderErrors) {
+    std::istringstream empty{""};
+    EXPECT_THAT(open_csv(empty, csv_column<double>("x", meters)).outcome,
+                Eq(CsvOutcome::ERR_MISSING_HEADER));
+
+    std::istringstream missing{"y [m]\n1\n"};
+    EXPECT_THAT(open_csv(missing, csv_column<double>("x", meters)).outcome,
+                Eq(CsvOutcome::ERR_NO_SUCH_COLUMN));
+
+    std::istringstream wrong_unit{"x [ft]\n1\n"};
+    EXPECT_THAT(open_csv(wrong_unit, csv_column<double>("x", meters)).outcome,
+                Eq(CsvOutcome::ERR_UNSUPPORTED_UNIT));
+
+    std::istringstream no_unit{"x\n1\n"};
+    EXPECT_THAT(open_csv(no_unit, csv_column<double>("x", meters)).outcome,
+                Eq(CsvOutcome::ERR_UNSUPPORTED_UNIT));
+}
+
+TEST(ReadChunk, ReadsInChunksOfAtMostMaxRows) {
+    std::istringstream in{"x [m]\n1\n2\n3\n4\n5\n"};
+    auto file = open_csv(in, csv_column<double>("x", meters));
+    ASSERT_THAT(file.outcome, Eq(CsvOutcome::OK));
+    auto &reader = file.value;
+
+    EXPECT_THAT(reader.read_chunk(2u).value, Eq(2u));
+    EXPECT_THAT(reader.column<0>()[0], SameTypeAndValue(meters(1.0)));
+    EXPECT_THAT(reader.read_chunk(2u).value, Eq(2u));
+    EXPECT_THAT(reader.column<0>()[0], SameTypeAndValue(meters(3.0)));
+    EXPECT_THAT(reader.read_chunk(2u).value, Eq(1u));
+    EXPECT_THAT(reader.column<0>()[0], SameTypeAndValue(meters(5.0)));
+    EXPECT_THAT(reader.read_chunk(2u).value, Eq(0u));
+    EXPECT_THAT(reader.column<0>().empty(), Eq(true));
+}
+
+TEST(ReadChunk, HandlesCrlfBlankLinesAndMissingFinalNewline) {
+    std::istringstream in{"x [m],y [s]\r\n1, 2\r\n\r\n 3 ,4"};
+    auto file = open_csv(in, csv_column<double>("y", seconds), csv_column<double>("x", meters));
+    ASSERT_THAT(file.outcome, Eq(CsvOutcome::OK));
+
+    const auto chunk = file.value.read_chunk(10u);
+    EXPECT_THAT(chunk.outcome, Eq(CsvOutcome::OK));
+    ASSERT_THAT(chunk.value, Eq(2u));
+    EXPECT_THAT(file.value.column<0>()[1], SameTypeAndValue(seconds(4.0)));
+    EXPECT_THAT(file.value.column<1>()[1], SameTypeAndValue(meters(3.0)));
+}
+
+TEST(ReadChunk, ReadsLinesLongerThanTheBuffer) {
+    const std::string padding(2u * CsvReader<CsvColumn<Meters, double>>::INITIAL_BUFFER_SIZE, ' ');
+    std::istringstream in{"pad,x [m]\n" + padding + ",1\n2,3\n"};
+    auto file = open_csv(in, csv_column<double>("x", meters));
+    ASSERT_THAT(file.outcome, Eq(CsvOutcome::OK));
+
+    ASSERT_THAT(file.value.read_chunk(10u).value, Eq(2u));
+    EXPECT_THAT(file.value.column<0>()[0], SameTypeAndValue(meters(1.0)));
+    EXPECT_THAT(file.value.column<0>()[1], SameTypeAndValue(meters(3.0)));
+}
+
+TEST(ReadChunk, ReportsRowErrorsWithLineNumber) {
+    std::istringstream bad_number{"x [m],y [m]\n1,2\n3,oops\n"};
+    auto file = open_csv(bad_number, csv_column<double>("y", meters));
+    ASSERT_THAT(file.outcome, Eq(CsvOutcome::OK));
+
+    const auto chunk = file.value.read_chunk(10u);
+    EXPECT_THAT(chunk.outcome, Eq(CsvOutcome::ERR_INVALID_NUMBER));
+    EXPECT_THAT(chunk.value, Eq(1u));
+    EXPECT_THAT(file.value.line_number(), Eq(3u));
+    EXPECT_THAT(file.value.column<0>().size(), Eq(1u));
+
+    std::istringstream short_row{"x [m],y [m]\n1\n"};
+    auto short_file = open_csv(short_row, csv_column<double>("y", meters));
+    ASSERT_THAT(short_file.outcome, Eq(CsvOutcome::OK));
+    EXPECT_THAT(short_file.value.read_chunk(10u).outcome, Eq(CsvOutcome::ERR_MISSING_FIELD));
+}
+
+}  // namespace
+}  // namespace au
@@ -0,0 +1,272 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "au/dimension.hh"
+#include "au/magnitude.hh"
+#include "au/packs.hh"
+#include "au/quantity.hh"
+#include "au/unit_id.hh"
+#include "au/unit_of_measure.hh"
+
+// Quantities whose unit is only known at runtime, and a bridge back to the static `Quantity` world.
+//
+// Sometimes the unit really is a runtime choice: a plugin config, or a column in a file, says which
+// unit its values are in.  `DynUnit` is a runtime description of a unit, derived from the unit's
+// compile time `Dimension` and `Magnitude`: a vector of base dimension exponents, and a magnitude.
+// `DynQuantity<R>` pairs a value with a `DynUnit`.
+//
+// To get back to a static `Quantity<U, R>`, use a `DynConverter<U, R>`.  It checks the dimension
+// once, when it's bound to a source unit, and caches the conversion factor; after that, converting
+// each value costs a single multiplication.
+//
+// Only floating point reps are supported, because the conversion factor is computed at runtime.
+
+namespace au {
+
+class DynDimension;
+class DynUnit;
+
+template <typename R>
+class DynQuantity;
+
+template <typename U, typename R>
+class DynConverter;
+
+// The runtime description of any unit (e.g., `dyn_unit(meters / second)`).
+template <typename UnitSlot>
+DynUnit dyn_unit(UnitSlot);
+
+// The runtime form of a static quantity.
+template <typename U, typename R>
+DynQuantity<R> make_dyn_quantity(Quantity<U, R> q);
+
+// A converter from the runtime unit `source` to `target_unit`, with rep `R`.
+template <typename R, typename TargetUnitSlot>
+DynConverter<AssociatedUnit<TargetUnitSlot>, R> make_dyn_converter(TargetUnitSlot target_unit,
+                                                                  const DynUnit &source);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `DynDimension`: the exponents of each base dimension, known at runtime.
+
+// A single base dimension, raised to a rational power.
+struct DynBasePower {
+    int64_t base_dim_index;
+    std::intmax_t exp_num;
+    std::intmax_t exp_den;
+
+    friend constexpr bool operator==(const DynBasePower &a, const DynBasePower &b) {
+        return a.base_dim_index == b.base_dim_index && a.exp_num == b.exp_num &&
+               a.exp_den == b.exp_den;
+    }
+    friend constexpr bool operator!=(const DynBasePower &a, const DynBasePower &b) {
+        return !(a == b);
+    }
+};
+
+class DynDimension {
+ public:
+    // The most distinct base dimensions that a single unit can involve.
+    static constexpr std::size_t MAX_BASE_DIMENSIONS = 9u;
+
+    // Dimensionless.
+    constexpr DynDimension() = default;
+
+    // The runtime form of the compile time dimension `D`.
+    template <typename... BPs>
+    explicit constexpr DynDimension(Dimension<BPs...>)
+        : powers_{{make_base_power<BPs>()...}}, size_{sizeof...(BPs)} {
+        static_assert(sizeof...(BPs) <= MAX_BASE_DIMENSIONS, "Too many base dimensions");
+    }
+
+    // The base powers, in the same (canonical) order as in the `Dimension` pack.
+    constexpr std::size_t size() const { return size_; }
+    constexpr const DynBasePower &operator[](std::size_t i) const { return powers_[i]; }
+
+    friend constexpr bool operator==(const DynDimension &a, const DynDimension &b) {
+        if (a.size_ != b.size_) {
+            return false;
+        }
+        for (std::size_t i = 0u; i < a.size_; ++i) {
+            if (a.powers_[i] != b.powers_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    friend constexpr bool operator!=(const DynDimension &a, const DynDimension &b) {
+        return !(a == b);
+    }
+
+ private:
+    template <typename BP>
+    static constexpr DynBasePower make_base_power() {
+        return {Base<BP>::base_dim_index, Exp<BP>::num, Exp<BP>::den};
+    }
+
+    std::array<DynBasePower, MAX_BASE_DIMENSIONS> powers_{};
+    std::size_t size_ = 0u;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `DynUnit`: a unit known at runtime.
+
+class DynUnit {
+ public:
+    // The dimension of this unit.
+    const DynDimension &dimension() const { return dimension_; }
+
+    // The magnitude of this unit, relative to the coherent unit of its dimension.
+    long double magnitude() const { return magnitude_; }
+
+    // The `unit_id()` of the static unit this came from.
+    uint64_t id() const { return id_; }
+
+    // The `unit_label()` of the static unit this came from.
+    const char *label() const { return label_; }
+
+    // Two units are equal if they are quantity-equivalent.
+    friend bool operator==(const DynUnit &a, const DynUnit &b) {
+        return a.id_ == b.id_ && a.dimension_ == b.dimension_ && a.magnitude_ == b.magnitude_;
+    }
+    friend bool operator!=(const DynUnit &a, const DynUnit &b) { return !(a == b); }
+
+ private:
+    template <typename UnitSlot>
+    friend DynUnit dyn_unit(UnitSlot);
+
+    DynUnit(DynDimension dimension, long double magnitude, uint64_t id, const char *label)
+        : dimension_{dimension}, magnitude_{magnitude}, id_{id}, label_{label} {}
+
+    DynDimension dimension_;
+    long double magnitude_;
+    uint64_t id_;
+    const char *label_;
+};
+
+template <typename UnitSlot>
+DynUnit dyn_unit(UnitSlot) {
+    using U = AssociatedUnit<UnitSlot>;
+    static_assert(IsUnit<U>::value, "Invalid type passed to unit slot");
+    return DynUnit{DynDimension{detail::DimT<U>{}},
+                   get_value<long double>(detail::MagT<U>{}),
+                   unit_id(U{}),
+                   unit_label(U{})};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `DynQuantity<R>`: a value, and a unit known at runtime.
+
+template <typename R>
+class DynQuantity {
+    static_assert(std::is_floating_point<R>::value, "DynQuantity requires a floating point rep");
+
+ public:
+    using Rep = R;
+
+    DynQuantity(R value, DynUnit unit) : value_{value}, unit_{unit} {}
+
+    R value() const { return value_; }
+    const DynUnit &unit() const { return unit_; }
+
+ private:
+    R value_;
+    DynUnit unit_;
+};
+
+template <typename U, typename R>
+DynQuantity<R> make_dyn_quantity(Quantity<U, R> q) {
+    return DynQuantity<R>{q.in(U{}), dyn_unit(U{})};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `DynConverter<U, R>`: converts values in a runtime unit to `Quantity<U, R>`.
+
+enum class DynConversionOutcome {
+    OK,
+    ERR_DIMENSION_MISMATCH,
+};
+
+template <typename T>
+struct DynConversionResult {
+    DynConversionOutcome outcome;
+
+    // Only valid/meaningful if `outcome` is `OK`.
+    T value = {};
+};
+
+template <typename U, typename R>
+class DynConverter {
+    static_assert(std::is_floating_point<R>::value, "DynConverter requires a floating point rep");
+
+ public:
+    // Bind to the runtime unit `source`, checking its dimension and computing the factor.
+    explicit DynConverter(const DynUnit &source) : source_{source} { bind(source); }
+
+    // Whether the bound source unit has the same dimension as `U`.
+    DynConversionOutcome outcome() const { return outcome_; }
+
+    // The unit this converter is currently bound to.
+    const DynUnit &source() const { return source_; }
+
+    // Convert a raw value in the bound source unit: a single multiplication.
+    //
+    // Precondition: `outcome()` is `DynConversionOutcome::OK`.
+    Quantity<U, R> apply(R value) const { return make_quantity<U>(value * factor_); }
+
+    // Convert a `DynQuantity`, in any unit.
+    //
+    // If its unit differs from the bound one, the converter re-binds to it first, so that repeated
+    // conversions from the same unit reuse the cached factor.  (We tell units apart by their
+    // `unit_id()`, which is what keeps the repeated case down to one comparison and one multiply.)
+    DynConversionResult<Quantity<U, R>> convert(const DynQuantity<R> &q) {
+        if (q.unit().id() != source_.id()) {
+            bind(q.unit());
+        }
+        if (outcome_ != DynConversionOutcome::OK) {
+            return {outcome_};
+        }
+        return {DynConversionOutcome::OK, apply(q.value())};
+    }
+
+ private:
+    void bind(const DynUnit &source) {
+        source_ = source;
+        if (source.dimension() != DynDimension{detail::DimT<U>{}}) {
+            outcome_ = DynConversionOutcome::ERR_DIMENSION_MISMATCH;
+            factor_ = R{0};
+            return;
+        }
+        outcome_ = DynConversionOutcome::OK;
+        factor_ = static_cast<R>(source.magnitude() / get_value<long double>(detail::MagT<U>{}));
+    }
+
+    DynUnit source_;
+    DynConversionOutcome outcome_ = DynConversionOutcome::ERR_DIMENSION_MISMATCH;
+    R factor_ = R{0};
+};
+
+template <typename R, typename TargetUnitSlot>
+DynConverter<AssociatedUnit<TargetUnitSlot>, R> make_dyn_converter(TargetUnitSlot,
+                                                                  const DynUnit &source) {
+    return DynConverter<AssociatedUnit<TargetUnitSlot>, R>{source};
+}
+
+}  // namespace au
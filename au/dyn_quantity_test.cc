@@ -0,0 +1,140 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/dyn_quantity.hh"
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/degrees.hh"
+#include "au/units/feet.hh"
+#include "au/units/hertz.hh"
+#include "au/units/hours.hh"
+#include "au/units/inches.hh"
+#include "au/units/meters.hh"
+#include "au/units/radians.hh"
+#include "au/units/seconds.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace au {
+
+using ::testing::Eq;
+using ::testing::Ne;
+using ::testing::StrEq;
+
+TEST(DynDimension, DefaultIsDimensionless) {
+    EXPECT_THAT(DynDimension{}.size(), Eq(0u));
+    EXPECT_THAT(DynDimension{}, Eq(DynDimension{Dimension<>{}}));
+}
+
+TEST(DynDimension, HoldsBasePowersOfStaticDimension) {
+    const DynDimension speed{DimQuotient<Length, Time>{}};
+
+    ASSERT_THAT(speed.size(), Eq(2u));
+    EXPECT_THAT(speed[0], Eq(DynBasePower{base_dim::Length::base_dim_index, 1, 1}));
+    EXPECT_THAT(speed[1], Eq(DynBasePower{base_dim::Time::base_dim_index, -1, 1}));
+}
+
+TEST(DynDimension, HoldsRationalExponents) {
+    const DynDimension root_length{DimPower<Length, 1, 2>{}};
+
+    ASSERT_THAT(root_length.size(), Eq(1u));
+    EXPECT_THAT(root_length[0], Eq(DynBasePower{base_dim::Length::base_dim_index, 1, 2}));
+}
+
+TEST(DynDimension, EqualIffSameDimension) {
+    EXPECT_THAT(DynDimension{Length{}}, Eq(DynDimension{Length{}}));
+    EXPECT_THAT(DynDimension{Length{}}, Ne(DynDimension{Time{}}));
+    EXPECT_THAT(DynDimension{Length{}}, Ne(DynDimension{DimPower<Length, 2>{}}));
+    EXPECT_THAT(DynDimension{Length{}}, Ne(DynDimension{DimQuotient<Length, Time>{}}));
+}
+
+TEST(DynUnit, CarriesMagnitudeIdAndLabel) {
+    const auto km = dyn_unit(kilo(meters));
+
+    EXPECT_THAT(km.dimension(), Eq(DynDimension{Length{}}));
+    EXPECT_THAT(km.magnitude(), Eq(1000.0L));
+    EXPECT_THAT(km.id(), Eq(unit_id(kilo(meters))));
+    EXPECT_THAT(km.label(), StrEq("km"));
+}
+
+TEST(DynUnit, EqualIffQuantityEquivalent) {
+    EXPECT_THAT(dyn_unit(meters / second), Eq(dyn_unit(meters * hertz)));
+    EXPECT_THAT(dyn_unit(meters), Ne(dyn_unit(kilo(meters))));
+    EXPECT_THAT(dyn_unit(meters), Ne(dyn_unit(seconds)));
+}
+
+TEST(MakeDynQuantity, KeepsValueAndUnit) {
+    const auto q = make_dyn_quantity(feet(3.0));
+
+    EXPECT_THAT(q.value(), Eq(3.0));
+    EXPECT_THAT(q.unit(), Eq(dyn_unit(feet)));
+}
+
+TEST(DynConverter, ConvertsFromBoundUnit) {
+    const auto c = make_dyn_converter<double>(meters, dyn_unit(kilo(meters)));
+
+    ASSERT_THAT(c.outcome(), Eq(DynConversionOutcome::OK));
+    EXPECT_THAT(c.apply(1.5), SameTypeAndValue(meters(1'500.0)));
+}
+
+TEST(DynConverter, ConvertsCompoundUnits) {
+    const auto c = make_dyn_converter<double>(meters / second, dyn_unit(kilo(meters) / hour));
+
+    ASSERT_THAT(c.outcome(), Eq(DynConversionOutcome::OK));
+    EXPECT_THAT(c.apply(36.0), IsNear((meters / second)(10.0), (meters / second)(1e-12)));
+}
+
+TEST(DynConverter, ConversionFactorIsAccurate) {
+    const auto c = make_dyn_converter<double>(inches, dyn_unit(feet));
+    EXPECT_THAT(c.apply(1.0), SameTypeAndValue(inches(12.0)));
+
+    const auto d = make_dyn_converter<double>(degrees, dyn_unit(radians));
+    EXPECT_THAT(d.apply(3.0), IsNear(radians(3.0).as(degrees), degrees(1e-12)));
+}
+
+TEST(DynConverter, ReportsDimensionMismatch) {
+    const auto c = make_dyn_converter<double>(meters, dyn_unit(seconds));
+    EXPECT_THAT(c.outcome(), Eq(DynConversionOutcome::ERR_DIMENSION_MISMATCH));
+}
+
+TEST(DynConverter, ConvertRebindsWhenUnitChanges) {
+    auto c = make_dyn_converter<float>(meters, dyn_unit(meters));
+
+    const auto r1 = c.convert(make_dyn_quantity(kilo(meters)(2.0f)));
+    ASSERT_THAT(r1.outcome, Eq(DynConversionOutcome::OK));
+    EXPECT_THAT(r1.value, SameTypeAndValue(meters(2'000.0f)));
+    EXPECT_THAT(c.source(), Eq(dyn_unit(kilo(meters))));
+
+    const auto r2 = c.convert(make_dyn_quantity(kilo(meters)(3.0f)));
+    ASSERT_THAT(r2.outcome, Eq(DynConversionOutcome::OK));
+    EXPECT_THAT(r2.value, SameTypeAndValue(meters(3'000.0f)));
+
+    const auto r3 = c.convert(make_dyn_quantity(centi(meters)(50.0f)));
+    ASSERT_THAT(r3.outcome, Eq(DynConversionOutcome::OK));
+    EXPECT_THAT(r3.value, SameTypeAndValue(meters(0.5f)));
+}
+
+TEST(DynConverter, ConvertReportsDimensionMismatchAndRecovers) {
+    auto c = make_dyn_converter<double>(meters, dyn_unit(meters));
+
+    EXPECT_THAT(c.convert(make_dyn_quantity(seconds(1.0))).outcome,
+                Eq(DynConversionOutcome::ERR_DIMENSION_MISMATCH));
+
+    const auto r = c.convert(make_dyn_quantity(meters(4.0)));
+    EXPECT_THAT(r.outcome, Eq(DynConversionOutcome::OK));
+    EXPECT_THAT(r.value, SameTypeAndValue(meters(4.0)));
+}
+
+}  // namespace au
@@ -0,0 +1,183 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <system_error>
+
+#include "au/also_accept.hh"
+#include "au/conversion_policy.hh"
+#include "au/quantity.hh"
+#include "au/unit_of_measure.hh"
+
+// `std::from_chars`-style parsing of `"value unit"` strings into a `Quantity`.
+//
+// The number is parsed by `std::from_chars`, and the unit is matched against the compile time unit
+// labels of the destination unit, and any alternative units the caller lists.  Values in an
+// alternative unit are converted to the destination unit.  Nothing allocates, and nothing depends
+// on the locale.
+//
+// This requires full `std::from_chars` support (including floating point types), which means C++17
+// and a sufficiently recent standard library.  Don't include this file in other configurations.
+
+namespace au {
+
+namespace detail {
+
+inline const char *skip_spaces(const char *first, const char *last) {
+    while (first != last && *first == ' ') {
+        ++first;
+    }
+    return first;
+}
+
+// Whether `c` could be part of a longer unit label: a letter, a digit, one of the symbols which
+// join the parts of a compound label, or any byte of a non-ASCII (UTF-8) character, such as `"°"`.
+inline bool can_continue_label(char c) {
+    const auto u = static_cast<unsigned char>(c);
+    const bool is_letter = (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z');
+    const bool is_digit = (u >= '0' && u <= '9');
+    return is_letter || is_digit || u == '_' || u == '^' || u == '/' || u == '*' || u >= 0x80u;
+}
+
+// If `[first, last)` starts with `label`, return a pointer just past the match; else, `nullptr`.
+//
+// Each space in `label` matches any number of spaces (including none) in the input, so that, say,
+// `"m/s"` matches the label `"m / s"`.  The match must end at the end of the input, or at
+// a character which can't continue a label, so that the label `"m"` doesn't match `"mm"`, `"min"`,
+// or `"m/s"`.
+inline const char *match_label(const char *first, const char *last, const char *label) {
+    for (; *label != '\0'; ++label) {
+        if (*label == ' ') {
+            first = skip_spaces(first, last);
+        } else if (first != last && *first == *label) {
+            ++first;
+        } else {
+            return nullptr;
+        }
+    }
+    return (first == last || !can_continue_label(*first)) ? first : nullptr;
+}
+
+// Store `value` (in `SourceUnit`) in `q`, unless the conversion would lose information.
+template <typename SourceUnit, typename U, typename R>
+bool store_if_lossless(R value, Quantity<U, R> &q) {
+    const auto source = make_quantity<SourceUnit>(value);
+    if (is_conversion_lossy<R>(source, U{})) {
+        return false;
+    }
+    q = source.template as<R>(U{}, ignore(ALL_RISKS));
+    return true;
+}
+
+// Call `store_if_lossless()` for the `i`th (zero-based) unit in the `AlsoAccept` list.
+template <typename U, typename R>
+bool store_alternative_if_lossless(std::size_t, R, Quantity<U, R> &, AlsoAccept<>) {
+    return false;
+}
+template <typename U, typename R, typename A, typename... As>
+bool store_alternative_if_lossless(std::size_t i,
+                                   R value,
+                                   Quantity<U, R> &q,
+                                   AlsoAccept<A, As...>) {
+    return (i == 0u) ? store_if_lossless<A>(value, q)
+                     : store_alternative_if_lossless(i - 1u, value, q, AlsoAccept<As...>{});
+}
+
+}  // namespace detail
+
+//
+// Parse a quantity from `[first, last)`, accepting the label of the destination unit, or of any of
+// the `AlsoAccept` units.
+//
+// The input is a number (in any format `std::from_chars` accepts for `R`), then optional spaces,
+// then a unit label.  The label must end at the end of the input, or at a character which can't
+// continue a label (such as a space or a comma): `"5 min"` does not parse as 5 meters.  If several
+// labels match, the longest one wins.  Any additional arguments are
+// forwarded to `std::from_chars` for the number: for example, a base (for integral reps), or a
+// `std::chars_format` (for floating point reps).
+//
+// Just like `std::from_chars`, the result holds a pointer one past the last character parsed, and
+// an empty error code.  Trailing characters are not an error: check `result.ptr == last` if the
+// whole input must match.  On failure, `q` is left unmodified, and the error code is:
+//
+// - `std::errc::invalid_argument` (with `ptr == first`), if there's no number, or no matching unit
+//   label.
+// - `std::errc::result_out_of_range` (with `ptr` past the unit label), if the number can't be
+//   represented in `R`, or if converting it from an alternative unit would overflow or truncate.
+//
+template <typename U, typename R, typename... Alternatives, typename... NumberArgs>
+std::from_chars_result from_chars(const char *first,
+                                  const char *last,
+                                  Quantity<U, R> &q,
+                                  AlsoAccept<Alternatives...>,
+                                  const NumberArgs &...number_args) {
+    static_assert((HasSameDimension<U, Alternatives>::value && ...),
+                  "Can only accept units with the same dimension as the destination");
+
+    R value{};
+    const auto number = std::from_chars(first, last, value, number_args...);
+    if (number.ec == std::errc::invalid_argument) {
+        return number;
+    }
+
+    // Find the longest matching label.  Index 0 is `U`; index `i > 0` is the `i`th alternative.
+    const char *label_start = detail::skip_spaces(number.ptr, last);
+    const char *label_end = nullptr;
+    std::size_t match = 0u;
+    std::size_t index = 0u;
+    const auto consider = [&](auto unit) {
+        const char *end = detail::match_label(label_start, last, unit_label(unit));
+        if (end != nullptr && (label_end == nullptr || end > label_end)) {
+            label_end = end;
+            match = index;
+        }
+        ++index;
+    };
+    consider(U{});
+    (consider(Alternatives{}), ...);
+
+    if (label_end == nullptr) {
+        return {first, std::errc::invalid_argument};
+    }
+    if (number.ec != std::errc{}) {
+        return {label_end, number.ec};
+    }
+
+    if (match == 0u) {
+        q = make_quantity<U>(value);
+        return {label_end, std::errc{}};
+    }
+
+    const bool stored = detail::store_alternative_if_lossless(
+        match - 1u, value, q, AlsoAccept<Alternatives...>{});
+    return {label_end, stored ? std::errc{} : std::errc::result_out_of_range};
+}
+
+//
+// Parse a quantity from `[first, last)`, accepting only the label of the destination unit.
+//
+// See above for the input format, and the meaning of the result and of any additional arguments.
+//
+template <typename U, typename R, typename... NumberArgs>
+std::from_chars_result from_chars(const char *first,
+                                  const char *last,
+                                  Quantity<U, R> &q,
+                                  const NumberArgs &...number_args) {
+    return from_chars(first, last, q, AlsoAccept<>{}, number_args...);
+}
+
+}  // namespace au
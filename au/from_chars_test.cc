@@ -0,0 +1,211 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/from_chars.hh"
+
+#include <cstdint>
+#include <cstring>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/feet.hh"
+#include "au/units/hours.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace au {
+namespace {
+
+using ::testing::Eq;
+
+using symbols::m;
+using symbols::s;
+
+// Parse all of `str` into `q`, with the remaining arguments passed to `from_chars()`.
+template <typename U, typename R, typename... Args>
+std::from_chars_result parse(const char *str, Quantity<U, R> &q, const Args &...args) {
+    return from_chars(str, str + std::strlen(str), q, args...);
+}
+
+// The offset of `result.ptr` from the start of `str`.
+std::ptrdiff_t offset(const char *str, std::from_chars_result result) { return result.ptr - str; }
+
+TEST(FromChars, ParsesValueAndUnitLabel) {
+    auto q = meters(0.0);
+    const char *str = "12.5 m";
+
+    const auto result = parse(str, q);
+
+    EXPECT_THAT(result.ec, Eq(std::errc{}));
+    EXPECT_THAT(offset(str, result), Eq(6));
+    EXPECT_THAT(q, SameTypeAndValue(meters(12.5)));
+}
+
+TEST(FromChars, ParsesIntegralReps) {
+    auto q = seconds(int8_t{0});
+    EXPECT_THAT(parse("-42 s", q).ec, Eq(std::errc{}));
+    EXPECT_THAT(q, SameTypeAndValue(seconds(int8_t{-42})));
+}
+
+TEST(FromChars, AcceptsCompoundLabelsWithOrWithoutSpaces) {
+    auto v = (meters / second)(0.0);
+
+    EXPECT_THAT(parse("12.5 m / s", v).ec, Eq(std::errc{}));
+    EXPECT_THAT(v, SameTypeAndValue(12.5 * m / s));
+
+    EXPECT_THAT(parse("7 m/s", v).ec, Eq(std::errc{}));
+    EXPECT_THAT(v, SameTypeAndValue(7.0 * m / s));
+}
+
+TEST(FromChars, SpaceBetweenNumberAndLabelIsOptional) {
+    auto q = meters(0);
+    EXPECT_THAT(parse("3m", q).ec, Eq(std::errc{}));
+    EXPECT_THAT(q, SameTypeAndValue(meters(3)));
+
+    EXPECT_THAT(parse("4   m", q).ec, Eq(std::errc{}));
+    EXPECT_THAT(q, SameTypeAndValue(meters(4)));
+}
+
+TEST(FromChars, ConvertsFromAlternativeUnits) {
+    auto q = meters(0.0);
+
+    EXPECT_THAT(parse("1.5 km", q, also_accept(kilo(meters), feet)).ec, Eq(std::errc{}));
+    EXPECT_THAT(q, SameTypeAndValue(meters(1'500.0)));
+
+    EXPECT_THAT(parse("10 ft", q, also_accept(kilo(meters), feet)).ec, Eq(std::errc{}));
+    EXPECT_THAT(q, IsNear(meters(3.048), nano(meters)(1)));
+
+    EXPECT_THAT(parse("2 m", q, also_accept(kilo(meters), feet)).ec, Eq(std::errc{}));
+    EXPECT_THAT(q, SameTypeAndValue(meters(2.0)));
+}
+
+TEST(FromChars, ConvertsCompoundAlternativeUnits) {
+    auto v = (meters / second)(0.0);
+    EXPECT_THAT(parse("36 km/h", v, also_accept(kilo(meters) / hour)).ec, Eq(std::errc{}));
+    EXPECT_THAT(v, IsNear(10.0 * m / s, 1e-12 * m / s));
+}
+
+TEST(FromChars, PrefersLongestMatchingLabel) {
+    auto q = meters(0);
+    const char *str = "5 mm";
+
+    const auto result = parse(str, q, also_accept(milli(meters)));
+
+    EXPECT_THAT(result.ec, Eq(std::errc::result_out_of_range));
+    EXPECT_THAT(offset(str, result), Eq(4));
+
+    auto q_mm = milli(meters)(0);
+    EXPECT_THAT(parse(str, q_mm, also_accept(meters)).ec, Eq(std::errc{}));
+    EXPECT_THAT(q_mm, SameTypeAndValue(milli(meters)(5)));
+}
+
+TEST(FromChars, LeavesTrailingCharactersUnparsed) {
+    auto q = meters(0);
+    const char *str = "5 m, 6 m";
+
+    const auto result = parse(str, q);
+
+    EXPECT_THAT(result.ec, Eq(std::errc{}));
+    EXPECT_THAT(offset(str, result), Eq(3));
+    EXPECT_THAT(q, SameTypeAndValue(meters(5)));
+}
+
+TEST(FromChars, ForwardsExtraArgumentsToNumberParsing) {
+    auto q = meters(0);
+    EXPECT_THAT(parse("ff m", q, 16).ec, Eq(std::errc{}));
+    EXPECT_THAT(q, SameTypeAndValue(meters(255)));
+
+    EXPECT_THAT(parse("10 km", q, also_accept(kilo(meters)), 2).ec, Eq(std::errc{}));
+    EXPECT_THAT(q, SameTypeAndValue(meters(2'000)));
+
+    auto d = meters(0.0);
+    EXPECT_THAT(parse("1.5 m", d, std::chars_format::scientific).ec,
+                Eq(std::errc::invalid_argument));
+}
+
+TEST(FromChars, InvalidArgumentIfNoNumber) {
+    auto q = meters(7);
+    const char *str = "m";
+
+    const auto result = parse(str, q);
+
+    EXPECT_THAT(result.ec, Eq(std::errc::invalid_argument));
+    EXPECT_THAT(result.ptr, Eq(str));
+    EXPECT_THAT(q, SameTypeAndValue(meters(7)));
+}
+
+TEST(FromChars, InvalidArgumentIfNoLabelMatches) {
+    auto q = meters(7);
+    for (const char *str : {"5", "5 ", "5 s", "5 km", "1.5 m"}) {
+        const auto result = parse(str, q);
+        EXPECT_THAT(result.ec, Eq(std::errc::invalid_argument)) << str;
+        EXPECT_THAT(result.ptr, Eq(str)) << str;
+    }
+    EXPECT_THAT(q, SameTypeAndValue(meters(7)));
+}
+
+TEST(FromChars, InvalidArgumentIfLabelIsOnlyPrefixOfInput) {
+    auto q = meters(7);
+    for (const char *str : {"5 mm", "5 min", "5 miles", "5 m2", "5 m/s", "5m_x"}) {
+        const auto result = parse(str, q);
+        EXPECT_THAT(result.ec, Eq(std::errc::invalid_argument)) << str;
+        EXPECT_THAT(result.ptr, Eq(str)) << str;
+    }
+    EXPECT_THAT(q, SameTypeAndValue(meters(7)));
+}
+
+TEST(FromChars, LabelMayEndAtPunctuationOrSpace) {
+    auto q = meters(0);
+    for (const char *str : {"5 m", "5 m ", "5 m,", "5 m;", "5 m)"}) {
+        const auto result = parse(str, q);
+        EXPECT_THAT(result.ec, Eq(std::errc{})) << str;
+        EXPECT_THAT(offset(str, result), Eq(3)) << str;
+    }
+    EXPECT_THAT(q, SameTypeAndValue(meters(5)));
+}
+
+TEST(FromChars, OutOfRangeIfNumberDoesNotFitInRep) {
+    auto q = meters(int8_t{7});
+    const char *str = "300 m";
+
+    const auto result = parse(str, q);
+
+    EXPECT_THAT(result.ec, Eq(std::errc::result_out_of_range));
+    EXPECT_THAT(offset(str, result), Eq(5));
+    EXPECT_THAT(q, SameTypeAndValue(meters(int8_t{7})));
+}
+
+TEST(FromChars, OutOfRangeIfConversionFromAlternativeWouldOverflow) {
+    auto q = meters(int16_t{7});
+    EXPECT_THAT(parse("32 km", q, also_accept(kilo(meters))).ec, Eq(std::errc{}));
+    EXPECT_THAT(q, SameTypeAndValue(meters(int16_t{32'000})));
+
+    EXPECT_THAT(parse("33 km", q, also_accept(kilo(meters))).ec,
+                Eq(std::errc::result_out_of_range));
+    EXPECT_THAT(q, SameTypeAndValue(meters(int16_t{32'000})));
+}
+
+TEST(FromChars, OutOfRangeIfConversionFromAlternativeWouldTruncate) {
+    auto q = kilo(meters)(7);
+    EXPECT_THAT(parse("3000 m", q, also_accept(meters)).ec, Eq(std::errc{}));
+    EXPECT_THAT(q, SameTypeAndValue(kilo(meters)(3)));
+
+    EXPECT_THAT(parse("3001 m", q, also_accept(meters)).ec, Eq(std::errc::result_out_of_range));
+    EXPECT_THAT(q, SameTypeAndValue(kilo(meters)(3)));
+}
+
+}  // namespace
+}  // namespace au
@@ -0,0 +1,133 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "au/config.hh"
+#include "au/conversion_policy.hh"
+#include "au/conversion_strategy.hh"
+#include "au/quantity.hh"
+#include "au/rep.hh"
+#include "au/unit_of_measure.hh"
+
+// Lazy chains of unit conversions.
+//
+// Each call to `.as()` on a `Quantity` applies its conversion factor right away, and (for integral
+// reps) rounds the result.  So, a chain such as `q.as(feet).as(inches).in<float>(meters)` performs
+// three conversions, and can lose precision at each step.  `lazy(q)` starts a chain which only
+// records the target unit and rep at each step.  When the chain is finally used, it converts the
+// original value straight to the final unit and rep: one conversion factor (computed at compile
+// time), and at most one rounding.
+
+namespace au {
+
+template <typename SourceUnit, typename SourceRep, typename TargetUnit, typename TargetRep>
+class LazyConversion;
+
+// Start a lazy conversion chain from `q`.
+template <typename U, typename R>
+AU_DEVICE_FUNC constexpr LazyConversion<U, R, U, R> lazy(Quantity<U, R> q);
+
+namespace detail {
+// The rep that `.as(NewUnit{})` produces for a `Quantity<U, R>`.
+template <typename U, typename R, typename NewUnit>
+using RepAfterConversion =
+    OpOutput<ConversionForRepsAndFactor<UseStaticCast, R, void, UnitRatio<U, NewUnit>>>;
+}  // namespace detail
+
+//
+// `LazyConversion<SourceUnit, SourceRep, TargetUnit, TargetRep>` holds a value of
+// `Quantity<SourceUnit, SourceRep>`, which it will convert to `Quantity<TargetUnit, TargetRep>`.
+//
+// Changing the target (with `.as()`) costs nothing at runtime.  Materializing the result (with
+// `.eval()`, `.in()`, or the implicit conversion to `Quantity`) performs the single fused
+// conversion.  Its risks are checked at that point, according to the (optional) policy: only the
+// fused conversion matters, not the intermediate steps.
+//
+template <typename SourceUnit, typename SourceRep, typename TargetUnit, typename TargetRep>
+class LazyConversion {
+ public:
+    using Unit = TargetUnit;
+    using Rep = TargetRep;
+
+    // `c.as(new_unit)`: change the target unit, with the rep that `.as(new_unit)` would give.
+    template <typename NewUnitSlot>
+    AU_DEVICE_FUNC constexpr auto as(NewUnitSlot) const {
+        using NewUnit = AssociatedUnit<NewUnitSlot>;
+        return with_target<NewUnit, detail::RepAfterConversion<TargetUnit, TargetRep, NewUnit>>();
+    }
+
+    // `c.as<NewRep>(new_unit)`: change the target unit and rep.
+    template <typename NewRep, typename NewUnitSlot>
+    AU_DEVICE_FUNC constexpr auto as(NewUnitSlot) const {
+        using NewUnit = AssociatedUnit<NewUnitSlot>;
+        return with_target<NewUnit, detail::ResolveSameRep<TargetRep, NewRep>>();
+    }
+
+    // `c.in(new_unit)`, or `c.in(new_unit, risk_policy)`: the value in `new_unit`, as a raw number.
+    template <typename NewUnitSlot, typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+    AU_DEVICE_FUNC constexpr auto in(NewUnitSlot u, RiskPolicyT policy = RiskPolicyT{}) const {
+        return as(u).eval(policy).in(u);
+    }
+
+    // `c.in<NewRep>(new_unit)`, or `c.in<NewRep>(new_unit, risk_policy)`: the value in `new_unit`,
+    // as a raw number of type `NewRep`.
+    template <typename NewRep,
+              typename NewUnitSlot,
+              typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+    AU_DEVICE_FUNC constexpr auto in(NewUnitSlot u, RiskPolicyT policy = RiskPolicyT{}) const {
+        return as<NewRep>(u).eval(policy).in(u);
+    }
+
+    // `c.eval()`, or `c.eval(risk_policy)`: materialize the result as a `Quantity`.
+    template <typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+    AU_DEVICE_FUNC constexpr Quantity<TargetUnit, TargetRep> eval(
+        RiskPolicyT policy = RiskPolicyT{}) const {
+        return source_.template as<TargetRep>(TargetUnit{}, policy);
+    }
+
+    // Materialize the result, with the default risk checks.
+    AU_DEVICE_FUNC constexpr operator Quantity<TargetUnit, TargetRep>() const { return eval(); }
+
+    // The original quantity, before any conversion.
+    AU_DEVICE_FUNC constexpr Quantity<SourceUnit, SourceRep> source() const { return source_; }
+
+ private:
+    template <typename U, typename R, typename TU, typename TR>
+    friend class LazyConversion;
+
+    template <typename UU, typename RR>
+    friend AU_DEVICE_FUNC constexpr LazyConversion<UU, RR, UU, RR> lazy(Quantity<UU, RR> q);
+
+    AU_DEVICE_FUNC constexpr explicit LazyConversion(Quantity<SourceUnit, SourceRep> source)
+        : source_{source} {}
+
+    template <typename NewUnit, typename NewRep>
+    AU_DEVICE_FUNC constexpr LazyConversion<SourceUnit, SourceRep, NewUnit, NewRep> with_target()
+        const {
+        static_assert(IsUnit<NewUnit>::value, "Invalid type passed to unit slot");
+        static_assert(HasSameDimension<NewUnit, SourceUnit>::value,
+                      "Can only convert same-dimension units");
+        return LazyConversion<SourceUnit, SourceRep, NewUnit, NewRep>{source_};
+    }
+
+    Quantity<SourceUnit, SourceRep> source_;
+};
+
+template <typename U, typename R>
+AU_DEVICE_FUNC constexpr LazyConversion<U, R, U, R> lazy(Quantity<U, R> q) {
+    return LazyConversion<U, R, U, R>{q};
+}
+
+}  // namespace au
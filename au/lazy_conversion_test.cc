@@ -0,0 +1,97 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/lazy_conversion.hh"
+
+#include <cstdint>
+#include <type_traits>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace au {
+
+using ::testing::Eq;
+using ::testing::StaticAssertTypeEq;
+
+struct Inches : UnitImpl<Length> {};
+constexpr auto inches = QuantityMaker<Inches>{};
+
+struct Feet : decltype(Inches{} * mag<12>()) {};
+constexpr auto feet = QuantityMaker<Feet>{};
+
+struct Meters : decltype(Inches{} * mag<10'000>() / mag<254>()) {};
+constexpr auto meters = QuantityMaker<Meters>{};
+
+TEST(Lazy, ChangingTargetOnlyChangesType) {
+    const auto c = lazy(inches(7)).as(feet).as(meters);
+    StaticAssertTypeEq<decltype(c), const LazyConversion<Inches, int, Meters, int>>();
+    EXPECT_THAT(c.source(), SameTypeAndValue(inches(7)));
+}
+
+TEST(Lazy, TargetRepFollowsSameRulesAsEagerAs) {
+    StaticAssertTypeEq<decltype(lazy(feet(int16_t{1})).as(inches))::Rep,
+                       decltype(feet(int16_t{1}).as(inches))::Rep>();
+    StaticAssertTypeEq<decltype(lazy(feet(1)).as<float>(inches))::Rep, float>();
+    StaticAssertTypeEq<decltype(lazy(feet(1)).as<float>(inches).as(feet))::Rep, float>();
+}
+
+TEST(Lazy, ConvertsOnceFromSourceToFinalTarget) {
+    // Eagerly, `inches(7).as(feet)` would truncate to 0 feet, and this would come back as 0 inches.
+    EXPECT_THAT(lazy(inches(7)).as(feet).as(inches).eval(), SameTypeAndValue(inches(7)));
+    EXPECT_THAT(lazy(inches(7)).as(feet).in(inches), SameTypeAndValue(7));
+}
+
+TEST(Lazy, RoundsOnlyOnceWithFusedFactor) {
+    const auto policy = ignore(TRUNCATION_RISK);
+
+    // Converting eagerly truncates twice: 35 inches become 2 feet, which become 60 cm (not 60.96).
+    const auto eager = inches(35).as(feet, policy).in(centi(meters), policy);
+    ASSERT_THAT(eager, SameTypeAndValue(60));
+
+    // The fused conversion truncates once, from 88.9 cm, just as the direct conversion does.
+    const auto fused = lazy(inches(35)).as(feet).in(centi(meters), policy);
+    EXPECT_THAT(fused, SameTypeAndValue(inches(35).in(centi(meters), policy)));
+    EXPECT_THAT(fused, SameTypeAndValue(88));
+}
+
+TEST(Lazy, InWithExplicitRepUsesThatRep) {
+    EXPECT_THAT(lazy(feet(3)).as(inches).in<double>(feet), SameTypeAndValue(3.0));
+}
+
+TEST(Lazy, ChecksRisksOfFusedConversionOnly) {
+    // The final conversion, inches to feet, truncates: we need to opt out of that risk.
+    EXPECT_THAT(lazy(inches(35)).as(meters).in(feet, ignore(TRUNCATION_RISK)),
+                SameTypeAndValue(2));
+    EXPECT_THAT(lazy(inches(35)).as(feet).eval(ignore(TRUNCATION_RISK)),
+                SameTypeAndValue(feet(2)));
+}
+
+TEST(Lazy, ImplicitlyConvertsToTargetQuantity) {
+    const Quantity<Inches, int> x = lazy(feet(2)).as(meters).as(inches);
+    EXPECT_THAT(x, SameTypeAndValue(inches(24)));
+
+    EXPECT_THAT((std::is_convertible<LazyConversion<Feet, int, Inches, int>,
+                                     Quantity<Inches, int>>::value),
+                Eq(true));
+}
+
+TEST(Lazy, IsConstexprCompatible) {
+    constexpr auto x = lazy(feet(2)).as(meters).as(centi(inches)).eval();
+    EXPECT_THAT(x, SameTypeAndValue(centi(inches)(2'400)));
+}
+
+}  // namespace au
@@ -30,6 +30,9 @@ namespace au {
 // If we don't provide these, then unqualified uses of `sin()`, etc. from <cmath> will break.  Name
 // Lookup will stop once it hits `::au::sin()`, hiding the `::sin()` overload in the global
 // namespace.  To learn more about Name Lookup, see this article (https://abseil.io/tips/49).
+//
+// These also let the functions below call the <cmath> functions _unqualified_, so that argument
+// dependent lookup can find lane-wise overloads for reps such as `std::experimental::simd`.
 using std::abs;
 using std::cbrt;
 using std::copysign;
@@ -45,6 +48,25 @@ using std::tan;
 
 namespace detail {
 
+// The <cmath> rounding functions, callable (via argument dependent lookup) on any rep which
+// provides them.  We can't simply call `round()` unqualified, because there's no `au::round()` to
+// stop name lookup from reaching the C library's `::round(double)`.
+template <typename T>
+auto round_rep(const T &x) {
+    using std::round;
+    return round(x);
+}
+template <typename T>
+auto floor_rep(const T &x) {
+    using std::floor;
+    return floor(x);
+}
+template <typename T>
+auto ceil_rep(const T &x) {
+    using std::ceil;
+    return ceil(x);
+}
+
 // This utility handles converting Quantity to Radians in a uniform way, while also giving a more
 // direct error message via the static_assert if users make a coding error and pass the wrong type.
 template <typename U, typename R>
@@ -102,15 +124,15 @@ template <typename Q, typename RoundingUnits>
 using RoundingRep = typename RoundingRepImpl<Q, RoundingUnits>::type;
 template <typename U, typename R, typename RoundingUnits>
 struct RoundingRepImpl<Quantity<U, R>, RoundingUnits> {
-    using type = decltype(std::round(R{}));
+    using type = decltype(round_rep(R{}));
 
     // Test our floating point assumption.
-    static_assert(std::is_floating_point<type>::value, "");
+    static_assert(std::is_floating_point<RealPart<type>>::value, "");
 
     // Test our type identity assumption, for every function which is a client of this utility.
-    static_assert(std::is_same<decltype(std::round(type{})), decltype(std::round(R{}))>::value, "");
-    static_assert(std::is_same<decltype(std::floor(type{})), decltype(std::floor(R{}))>::value, "");
-    static_assert(std::is_same<decltype(std::ceil(type{})), decltype(std::ceil(R{}))>::value, "");
+    static_assert(std::is_same<decltype(round_rep(type{})), decltype(round_rep(R{}))>::value, "");
+    static_assert(std::is_same<decltype(floor_rep(type{})), decltype(floor_rep(R{}))>::value, "");
+    static_assert(std::is_same<decltype(ceil_rep(type{})), decltype(ceil_rep(R{}))>::value, "");
 };
 template <typename U, typename R, typename RoundingUnits>
 struct RoundingRepImpl<QuantityPoint<U, R>, RoundingUnits>
@@ -120,7 +142,7 @@ struct RoundingRepImpl<QuantityPoint<U, R>, RoundingUnits>
 // The absolute value of a Quantity.
 template <typename U, typename R>
 auto abs(Quantity<U, R> q) {
-    return make_quantity<U>(std::abs(q.in(U{})));
+    return make_quantity<U>(abs(q.in(U{})));
 }
 
 // Wrapper for std::acos() which returns strongly typed angle quantity.
@@ -157,7 +179,7 @@ auto arctan2(Quantity<U1, R1> y, Quantity<U2, R2> x) {
 // Wrapper for std::cbrt() which handles Quantity types.
 template <typename U, typename R>
 auto cbrt(Quantity<U, R> q) {
-    return make_quantity<UnitPower<U, 1, 3>>(std::cbrt(q.in(U{})));
+    return make_quantity<UnitPower<U, 1, 3>>(cbrt(q.in(U{})));
 }
 
 // Clamp the first quantity to within the range of the second two.
@@ -185,7 +207,7 @@ AU_DEVICE_FUNC constexpr auto clamp(QuantityPoint<UV, RV> v,
 template <typename U1, typename R1, typename U2, typename R2>
 auto hypot(Quantity<U1, R1> x, Quantity<U2, R2> y) {
     using U = CommonUnit<U1, U2>;
-    return make_quantity<U>(std::hypot(x.in(U{}), y.in(U{})));
+    return make_quantity<U>(hypot(x.in(U{}), y.in(U{})));
 }
 
 // Copysign where the magnitude has units.
@@ -216,8 +238,8 @@ auto cos(Quantity<U, R> q) {
 template <typename U1, typename R1, typename U2, typename R2>
 auto fmod(Quantity<U1, R1> q1, Quantity<U2, R2> q2) {
     using U = CommonUnit<U1, U2>;
-    using R = decltype(std::fmod(R1{}, R2{}));
-    return make_quantity<U>(std::fmod(q1.template in<R>(U{}), q2.template in<R>(U{})));
+    using R = decltype(fmod(R1{}, R2{}));
+    return make_quantity<U>(fmod(q1.template in<R>(U{}), q2.template in<R>(U{})));
 }
 
 // Raise a Quantity to an integer power.
@@ -461,8 +483,8 @@ AU_DEVICE_FUNC constexpr auto mean(QuantityPoint<U0, R0> p0, QuantityPoint<Us, R
 template <typename U1, typename R1, typename U2, typename R2>
 auto remainder(Quantity<U1, R1> q1, Quantity<U2, R2> q2) {
     using U = CommonUnit<U1, U2>;
-    using R = decltype(std::remainder(R1{}, R2{}));
-    return make_quantity<U>(std::remainder(q1.template in<R>(U{}), q2.template in<R>(U{})));
+    using R = decltype(remainder(R1{}, R2{}));
+    return make_quantity<U>(remainder(q1.template in<R>(U{}), q2.template in<R>(U{})));
 }
 
 //
@@ -474,13 +496,13 @@ auto remainder(Quantity<U1, R1> q1, Quantity<U2, R2> q2) {
 template <typename RoundingUnits, typename U, typename R>
 auto round_in(RoundingUnits rounding_units, Quantity<U, R> q) {
     using OurRoundingRep = detail::RoundingRep<Quantity<U, R>, RoundingUnits>;
-    return std::round(q.template in<OurRoundingRep>(rounding_units));
+    return detail::round_rep(q.template in<OurRoundingRep>(rounding_units));
 }
 // b) Version for QuantityPoint.
 template <typename RoundingUnits, typename U, typename R>
 auto round_in(RoundingUnits rounding_units, QuantityPoint<U, R> p) {
     using OurRoundingRep = detail::RoundingRep<QuantityPoint<U, R>, RoundingUnits>;
-    return std::round(p.template in<OurRoundingRep>(rounding_units));
+    return detail::round_rep(p.template in<OurRoundingRep>(rounding_units));
 }
 
 //
@@ -553,13 +575,13 @@ auto round_as(RoundingUnits rounding_units, QuantityPoint<U, R> p) {
 template <typename RoundingUnits, typename U, typename R>
 auto floor_in(RoundingUnits rounding_units, Quantity<U, R> q) {
     using OurRoundingRep = detail::RoundingRep<Quantity<U, R>, RoundingUnits>;
-    return std::floor(q.template in<OurRoundingRep>(rounding_units));
+    return detail::floor_rep(q.template in<OurRoundingRep>(rounding_units));
 }
 // b) Version for QuantityPoint.
 template <typename RoundingUnits, typename U, typename R>
 auto floor_in(RoundingUnits rounding_units, QuantityPoint<U, R> p) {
     using OurRoundingRep = detail::RoundingRep<QuantityPoint<U, R>, RoundingUnits>;
-    return std::floor(p.template in<OurRoundingRep>(rounding_units));
+    return detail::floor_rep(p.template in<OurRoundingRep>(rounding_units));
 }
 
 //
@@ -631,13 +653,13 @@ auto floor_as(RoundingUnits rounding_units, QuantityPoint<U, R> p) {
 template <typename RoundingUnits, typename U, typename R>
 auto ceil_in(RoundingUnits rounding_units, Quantity<U, R> q) {
     using OurRoundingRep = detail::RoundingRep<Quantity<U, R>, RoundingUnits>;
-    return std::ceil(q.template in<OurRoundingRep>(rounding_units));
+    return detail::ceil_rep(q.template in<OurRoundingRep>(rounding_units));
 }
 // b) Version for QuantityPoint.
 template <typename RoundingUnits, typename U, typename R>
 auto ceil_in(RoundingUnits rounding_units, QuantityPoint<U, R> p) {
     using OurRoundingRep = detail::RoundingRep<QuantityPoint<U, R>, RoundingUnits>;
-    return std::ceil(p.template in<OurRoundingRep>(rounding_units));
+    return detail::ceil_rep(p.template in<OurRoundingRep>(rounding_units));
 }
 
 //
@@ -1014,7 +1036,7 @@ auto sin(Quantity<U, R> q) {
 // Wrapper for std::sqrt() which handles Quantity types.
 template <typename U, typename R>
 auto sqrt(Quantity<U, R> q) {
-    return make_quantity<UnitPower<U, 1, 2>>(std::sqrt(q.in(U{})));
+    return make_quantity<UnitPower<U, 1, 2>>(sqrt(q.in(U{})));
 }
 
 // Wrapper for std::tan() which accepts a strongly typed angle quantity.
@@ -18,6 +18,7 @@
 #include <type_traits>
 
 #include "au/abstract_operations.hh"
+#include "au/bounded.hh"
 #include "au/config.hh"
 #include "au/magnitude.hh"
 #include "au/operators.hh"
@@ -28,6 +29,9 @@
 //
 // The "scalar type" of `T` is usually just `T`, but if `T` is something like `std::complex<U>`, or
 // `Eigen::Vector<U, N>`, then it would be `U`.
+//
+// A `Bounded<U, Min, Max>` rep (see `"au/bounded.hh"`) narrows these ranges: as an input, it can
+// only take values in `[Min, Max]`, and as the destination of a cast, it can only accept them.
 
 namespace au {
 namespace detail {
@@ -100,11 +104,44 @@ struct MinValueChecker;
 template <typename Op>
 struct MaxValueChecker;
 
+// `ValueOverflowChecker<Op>::would_overflow(x)` checks whether the value `x` is either too small or
+// too large.  When both can happen, it checks both bounds at once: for a rep where each check is
+// a pass over many values (such as an Eigen type), that makes one pass instead of two.
+template <typename Op>
+struct ValueOverflowChecker;
+
 // `would_value_overflow<Op>(x)` checks whether the value `x` would exceed the bounds of the
 // operation at any stage.
 template <typename Op>
 AU_DEVICE_FUNC constexpr bool would_value_overflow(const OpInput<Op> &x) {
-    return MinValueChecker<Op>::is_too_small(x) || MaxValueChecker<Op>::is_too_large(x);
+    return ValueOverflowChecker<Op>::would_overflow(x);
+}
+
+//
+// `ReversesOrder<Op>::value` is `true` if `Op` maps larger inputs to smaller outputs: that is, if
+// it multiplies or divides by a negative number an odd number of times.
+//
+template <typename Op>
+struct ReversesOrder;
+
+// `saturating_apply<Op>(x)` applies `Op` to `x`, except that if `x` would overflow, it produces the
+// limit of the output type (or of its bounds, for a `Bounded` output) that lies in the direction of
+// the overflow.
+//
+// Note that overflow can happen at an intermediate stage of the operation.  In that case, we
+// saturate from the point where the intermediate stage overflows, even though the final result
+// might have fit.  This is the same set of inputs that `would_value_overflow<Op>()` flags.
+//
+// A NaN input never overflows.  If the output is floating point, it converts to NaN as usual.
+// Otherwise, converting NaN would be undefined behavior, so we convert zero instead.
+//
+// Only supports real scalar outputs.  The computation has no branches: we apply `Op` to the input
+// clamped to the range that can't overflow, and then select the result.
+template <typename Op>
+struct SaturatingApply;
+template <typename Op>
+AU_DEVICE_FUNC constexpr OpOutput<Op> saturating_apply(const OpInput<Op> &x) {
+    return SaturatingApply<Op>::apply_to(x);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -445,20 +482,69 @@ struct IsCompatibleApartFromMaybeOverflow
 // Why this lazy implementation, instead of using `std::numeric_limits` directly?  Simply because we
 // need a _type_ whose _`value()` method_ returns the given value.  We already built that for more
 // complicated use cases (it's called `LowestOfLimitsDividedByValue`), so we can just reuse it here.
+template <typename T>
+struct MinPossibleForInput
+    : stdx::type_identity<LowestOfLimitsDividedByValue<RealPart<T>, Magnitude<>, void>> {};
+
+// A `Bounded` input can't be smaller than its lower bound.
+template <typename T, T Min, T Max>
+struct MinPossibleForInput<Bounded<T, Min, Max>>
+    : stdx::type_identity<ValueOfLowestInDestination<T, T, Bounded<T, Min, Max>>> {};
+
 template <typename Op>
-struct MinPossibleImpl
-    : stdx::type_identity<LowestOfLimitsDividedByValue<RealPart<OpInput<Op>>, Magnitude<>, void>> {
-};
+struct MinPossibleImpl : MinPossibleForInput<OpInput<Op>> {};
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // `MaxPossible<Op>` implementation.
 
-// See `MinPossibleImpl` comments above for explanation of this lazy approach.
+// See `MinPossibleForInput` comments above for explanation of this lazy approach.
+template <typename T>
+struct MaxPossibleForInput
+    : stdx::type_identity<HighestOfLimitsDividedByValue<RealPart<T>, Magnitude<>, void>> {};
+
+// A `Bounded` input can't be larger than its upper bound.
+template <typename T, T Min, T Max>
+struct MaxPossibleForInput<Bounded<T, Min, Max>>
+    : stdx::type_identity<ValueOfHighestInDestination<T, T, Bounded<T, Min, Max>>> {};
+
 template <typename Op>
-struct MaxPossibleImpl
-    : stdx::type_identity<HighestOfLimitsDividedByValue<RealPart<OpInput<Op>>, Magnitude<>, void>> {
+struct MaxPossibleImpl : MaxPossibleForInput<OpInput<Op>> {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Destination limits for casts.
+
+// A type whose `lower()` and `upper()` are the tighter of those from `L1` and `L2` (each assumed to
+// be a valid `Limits` type for `T`, and not `void`).
+template <typename T, typename L1, typename L2>
+struct TighterLimits {
+    static constexpr T lower() {
+        return (LowerLimit<T, L1>::value() < LowerLimit<T, L2>::value())
+                   ? LowerLimit<T, L2>::value()
+                   : LowerLimit<T, L1>::value();
+    }
+    static constexpr T upper() {
+        return (UpperLimit<T, L1>::value() < UpperLimit<T, L2>::value())
+                   ? UpperLimit<T, L1>::value()
+                   : UpperLimit<T, L2>::value();
+    }
 };
 
+// `DestinationLimits<U, ULimit>` is the `Limits` type for a cast to `U`, when the values that
+// subsequent operations can accept are limited by `ULimit`.  If `U` is `Bounded`, its bounds also
+// limit the values that it can accept.
+template <typename U, typename ULimit>
+struct DestinationLimitsImpl : stdx::type_identity<ULimit> {};
+template <typename U, typename ULimit>
+using DestinationLimits = typename DestinationLimitsImpl<U, ULimit>::type;
+
+template <typename T, T Min, T Max>
+struct DestinationLimitsImpl<Bounded<T, Min, Max>, void>
+    : stdx::type_identity<Bounded<T, Min, Max>> {};
+
+template <typename T, T Min, T Max, typename ULimit>
+struct DestinationLimitsImpl<Bounded<T, Min, Max>, ULimit>
+    : stdx::type_identity<TighterLimits<T, Bounded<T, Min, Max>, ULimit>> {};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // `StaticCast<T, U>` implementation.
 
@@ -545,8 +631,8 @@ struct MinGoodImplForStaticCastUsingRealPart
           MinGoodImplForStaticCastFromNonArithmetic<RealPart<T>, RealPart<U>, ULimit>> {};
 
 template <typename T, typename U, typename ULimit>
-struct MinGoodImpl<StaticCast<T, U>, ULimit> : MinGoodImplForStaticCastUsingRealPart<T, U, ULimit> {
-};
+struct MinGoodImpl<StaticCast<T, U>, ULimit>
+    : MinGoodImplForStaticCastUsingRealPart<T, U, DestinationLimits<U, ULimit>> {};
 
 //
 // `MaxGood<StaticCast<T, U>>` implementation cluster.
@@ -617,8 +703,8 @@ struct MaxGoodImplForStaticCastUsingRealPart
           MaxGoodImplForStaticCastFromNonArithmetic<RealPart<T>, RealPart<U>, ULimit>> {};
 
 template <typename T, typename U, typename ULimit>
-struct MaxGoodImpl<StaticCast<T, U>, ULimit> : MaxGoodImplForStaticCastUsingRealPart<T, U, ULimit> {
-};
+struct MaxGoodImpl<StaticCast<T, U>, ULimit>
+    : MaxGoodImplForStaticCastUsingRealPart<T, U, DestinationLimits<U, ULimit>> {};
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // `ImplicitConversion<T, U>` implementation.
@@ -735,6 +821,87 @@ template <typename T, typename M, typename Limits>
 struct MaxGoodImpl<DivideTypeByInteger<T, M>, Limits>
     : MaxGoodImplForDivideTypeByIntegerUsingRealPart<RealPart<T>, M, Limits> {};
 
+#if defined(__SIZEOF_INT128__)
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `WideMultiplyDivide<T, M>` implementation.
+//
+// The intermediate product can't overflow, so only the limits on the final result matter.  For a
+// non-negative input `x`, and a non-negative limit `L` on the magnitude of the result, the
+// truncated value of `x * N / D` stays within `L` exactly when `x * N < (L + 1) * D`.  Every term
+// fits in an unsigned 128-bit integer, because `N`, `D`, `x`, and `L` all fit in 64 bits.
+
+// The largest magnitude of input whose result has a magnitude no bigger than `limit_magnitude`,
+// capped at `max_input_magnitude`.
+template <typename T, typename M>
+constexpr __uint128_t wide_multiply_divide_max_input_magnitude(__uint128_t limit_magnitude,
+                                                               __uint128_t max_input_magnitude) {
+    const __uint128_t n = WideMultiplyDivide<T, M>::numerator();
+    const __uint128_t d = WideMultiplyDivide<T, M>::denominator();
+    const __uint128_t result = ((limit_magnitude + 1u) * d - 1u) / n;
+    return (result < max_input_magnitude) ? result : max_input_magnitude;
+}
+
+// The magnitude of the lower limit, which is assumed to be non-positive.
+template <typename T, typename Limits>
+constexpr __uint128_t lower_limit_magnitude() {
+    return static_cast<__uint128_t>(-static_cast<__int128_t>(LowerLimit<T, Limits>::value()));
+}
+
+// The magnitude of the upper limit, which is assumed to be non-negative.
+template <typename T, typename Limits>
+constexpr __uint128_t upper_limit_magnitude() {
+    return static_cast<__uint128_t>(UpperLimit<T, Limits>::value());
+}
+
+//
+// `MinGood<WideMultiplyDivide<T, M>>` implementation cluster.
+//
+
+template <typename T, typename M, typename Limits>
+struct MinGoodForWideMultiplyDivideOnSigned {
+    static constexpr T value() {
+        // A positive factor sends negative inputs toward the lower limit; a negative factor sends
+        // them toward the upper limit.
+        constexpr __uint128_t LIMIT_MAGNITUDE = IsPositive<M>::value
+                                                    ? lower_limit_magnitude<T, Limits>()
+                                                    : upper_limit_magnitude<T, Limits>();
+        constexpr __uint128_t LOWEST_MAGNITUDE =
+            static_cast<__uint128_t>(-static_cast<__int128_t>(std::numeric_limits<T>::lowest()));
+        return static_cast<T>(-static_cast<__int128_t>(
+            wide_multiply_divide_max_input_magnitude<T, M>(LIMIT_MAGNITUDE, LOWEST_MAGNITUDE)));
+    }
+};
+
+template <typename T, typename M, typename Limits>
+struct MinGoodImpl<WideMultiplyDivide<T, M>, Limits>
+    : std::conditional<IsDefinitelyUnsigned<T>::value,
+                       ValueOfZero<T>,
+                       MinGoodForWideMultiplyDivideOnSigned<T, M, Limits>> {};
+
+//
+// `MaxGood<WideMultiplyDivide<T, M>>` implementation cluster.
+//
+
+template <typename T, typename M, typename Limits>
+struct MaxGoodForWideMultiplyDivide {
+    static constexpr T value() {
+        // A positive factor sends positive inputs toward the upper limit; a negative factor sends
+        // them toward the lower limit.
+        constexpr __uint128_t LIMIT_MAGNITUDE = IsPositive<M>::value
+                                                    ? upper_limit_magnitude<T, Limits>()
+                                                    : lower_limit_magnitude<T, Limits>();
+        constexpr __uint128_t HIGHEST_MAGNITUDE =
+            static_cast<__uint128_t>(std::numeric_limits<T>::max());
+        return static_cast<T>(
+            wide_multiply_divide_max_input_magnitude<T, M>(LIMIT_MAGNITUDE, HIGHEST_MAGNITUDE));
+    }
+};
+
+template <typename T, typename M, typename Limits>
+struct MaxGoodImpl<WideMultiplyDivide<T, M>, Limits>
+    : stdx::type_identity<MaxGoodForWideMultiplyDivide<T, M, Limits>> {};
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // `OpSequence<Ops...>` implementation.
 
@@ -784,7 +951,7 @@ struct CanOverflowAbove : stdx::bool_constant<(MaxGood<Op>::value() < MaxPossibl
 template <typename Op, bool IsOverflowPossible>
 struct MinValueCheckerImpl {
     static AU_DEVICE_FUNC constexpr bool is_too_small(const OpInput<Op> &x) {
-        return x < MinGood<Op>::value();
+        return any_lane_below(x, MinGood<Op>::value());
     }
 };
 template <typename Op>
@@ -797,7 +964,7 @@ struct MinValueChecker : MinValueCheckerImpl<Op, CanOverflowBelow<Op>::value> {}
 template <typename Op, bool IsOverflowPossible>
 struct MaxValueCheckerImpl {
     static AU_DEVICE_FUNC constexpr bool is_too_large(const OpInput<Op> &x) {
-        return x > MaxGood<Op>::value();
+        return any_lane_above(x, MaxGood<Op>::value());
     }
 };
 template <typename Op>
@@ -807,5 +974,124 @@ struct MaxValueCheckerImpl<Op, false> {
 template <typename Op>
 struct MaxValueChecker : MaxValueCheckerImpl<Op, CanOverflowAbove<Op>::value> {};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `ValueOverflowChecker<Op>` implementation.
+
+template <typename Op, bool IsOverflowPossibleBothWays>
+struct ValueOverflowCheckerImpl {
+    static AU_DEVICE_FUNC constexpr bool would_overflow(const OpInput<Op> &x) {
+        return MinValueChecker<Op>::is_too_small(x) || MaxValueChecker<Op>::is_too_large(x);
+    }
+};
+template <typename Op>
+struct ValueOverflowCheckerImpl<Op, true> {
+    static AU_DEVICE_FUNC constexpr bool would_overflow(const OpInput<Op> &x) {
+        return any_lane_outside(x, MinGood<Op>::value(), MaxGood<Op>::value());
+    }
+};
+template <typename Op>
+struct ValueOverflowChecker
+    : ValueOverflowCheckerImpl<Op, CanOverflowBelow<Op>::value && CanOverflowAbove<Op>::value> {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `ReversesOrder<Op>` implementation.
+
+template <typename T, typename U>
+struct ReversesOrder<StaticCast<T, U>> : std::false_type {};
+
+template <typename T, typename U>
+struct ReversesOrder<ImplicitConversion<T, U>> : std::false_type {};
+
+template <typename T, typename M>
+struct ReversesOrder<MultiplyTypeBy<T, M>> : stdx::negation<IsPositive<M>> {};
+
+template <typename T, typename M>
+struct ReversesOrder<DivideTypeByInteger<T, M>> : stdx::negation<IsPositive<M>> {};
+
+template <typename T, typename M>
+struct ReversesOrder<WideMultiplyDivide<T, M>> : stdx::negation<IsPositive<M>> {};
+
+template <typename Op>
+struct ReversesOrder<OpSequenceImpl<Op>> : ReversesOrder<Op> {};
+
+template <typename Op, typename... Ops>
+struct ReversesOrder<OpSequenceImpl<Op, Ops...>>
+    : stdx::bool_constant<(ReversesOrder<Op>::value !=
+                           ReversesOrder<OpSequenceImpl<Ops...>>::value)> {};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `SaturatingApply<Op>` implementation.
+
+// `ClampAboveToGood<Op>::apply_to(x)` is the lower of `x` and `MaxGood<Op>`; `ClampBelowToGood` is
+// its counterpart.  Both are the identity when the corresponding overflow is impossible.
+template <typename Op, bool IsOverflowPossible = CanOverflowAbove<Op>::value>
+struct ClampAboveToGood {
+    static AU_DEVICE_FUNC constexpr OpInput<Op> apply_to(const OpInput<Op> &x) {
+        return (x > MaxGood<Op>::value()) ? static_cast<OpInput<Op>>(MaxGood<Op>::value()) : x;
+    }
+};
+template <typename Op>
+struct ClampAboveToGood<Op, false> {
+    static AU_DEVICE_FUNC constexpr OpInput<Op> apply_to(const OpInput<Op> &x) { return x; }
+};
+
+template <typename Op, bool IsOverflowPossible = CanOverflowBelow<Op>::value>
+struct ClampBelowToGood {
+    static AU_DEVICE_FUNC constexpr OpInput<Op> apply_to(const OpInput<Op> &x) {
+        return (x < MinGood<Op>::value()) ? static_cast<OpInput<Op>>(MinGood<Op>::value()) : x;
+    }
+};
+template <typename Op>
+struct ClampBelowToGood<Op, false> {
+    static AU_DEVICE_FUNC constexpr OpInput<Op> apply_to(const OpInput<Op> &x) { return x; }
+};
+
+// `ZeroIfNaN<Op>::apply_to(x)` is zero if `x` is NaN, and `x` otherwise.  It's the identity unless
+// `Op` converts a floating point input to an output which can't hold NaN.
+template <typename Op,
+          bool IsNaNUndefined = (std::is_floating_point<RealPart<OpInput<Op>>>::value &&
+                                 !std::is_floating_point<RealPart<OpOutput<Op>>>::value)>
+struct ZeroIfNaN {
+    // `x != x` only if `x` is NaN.
+    static AU_DEVICE_FUNC constexpr OpInput<Op> apply_to(const OpInput<Op> &x) {
+        return (x != x) ? static_cast<OpInput<Op>>(0) : x;
+    }
+};
+template <typename Op>
+struct ZeroIfNaN<Op, false> {
+    static AU_DEVICE_FUNC constexpr OpInput<Op> apply_to(const OpInput<Op> &x) { return x; }
+};
+
+// The lowest and highest values of `T` (or of its bounds, if it is `Bounded`).
+template <typename T>
+struct SaturationLimits {
+    static constexpr T lowest() {
+        return static_cast<T>(LowerLimit<Unbounded<T>, DestinationLimits<T, void>>::value());
+    }
+    static constexpr T highest() {
+        return static_cast<T>(UpperLimit<Unbounded<T>, DestinationLimits<T, void>>::value());
+    }
+};
+
+template <typename Op>
+struct SaturatingApply {
+    using Output = OpOutput<Op>;
+    static_assert(std::is_arithmetic<Unbounded<Output>>::value,
+                  "Saturating conversions need a real arithmetic (or `Bounded`) output rep");
+
+    static AU_DEVICE_FUNC constexpr Output apply_to(const OpInput<Op> &x) {
+        constexpr bool REVERSES_ORDER = ReversesOrder<Op>::value;
+        constexpr Output SATURATED_ABOVE = REVERSES_ORDER ? SaturationLimits<Output>::lowest()
+                                                          : SaturationLimits<Output>::highest();
+        constexpr Output SATURATED_BELOW = REVERSES_ORDER ? SaturationLimits<Output>::highest()
+                                                          : SaturationLimits<Output>::lowest();
+
+        const Output y = Op::apply_to(ClampBelowToGood<Op>::apply_to(
+            ClampAboveToGood<Op>::apply_to(ZeroIfNaN<Op>::apply_to(x))));
+        const Output y_or_above = MaxValueChecker<Op>::is_too_large(x) ? SATURATED_ABOVE : y;
+        return MinValueChecker<Op>::is_too_small(x) ? SATURATED_BELOW : y_or_above;
+    }
+};
+
 }  // namespace detail
 }  // namespace au
@@ -14,6 +14,7 @@
 
 #include "au/overflow_boundary.hh"
 
+#include <cmath>
 #include <complex>
 #include <limits>
 
@@ -64,6 +65,13 @@ constexpr DivideTypeByInteger<T, M> divide_type_by_integer(M) {
     return DivideTypeByInteger<T, M>{};
 }
 
+#if defined(__SIZEOF_INT128__)
+template <typename T, typename M>
+constexpr WideMultiplyDivide<T, M> wide_multiply_divide(M) {
+    return WideMultiplyDivide<T, M>{};
+}
+#endif
+
 template <typename Op>
 auto min_good_value(Op) {
     return MinGood<Op>::value();
@@ -1517,6 +1525,90 @@ TEST(DivideTypeByInteger, MaxGoodForComplexOfTProvidesAnswerAsT) {
                 SameTypeAndValue(max_good_value(divide_type_by_integer<int32_t>(mag<12>()))));
 }
 
+#if defined(__SIZEOF_INT128__)
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `WideMultiplyDivide` section:
+
+//
+// `MinGood<WideMultiplyDivide>`:
+//
+
+TEST(WideMultiplyDivide, MinGoodForUnsignedIsAlwaysZero) {
+    EXPECT_THAT(min_good_value(wide_multiply_divide<uint64_t>(mag<1000>() / mag<7>())),
+                SameTypeAndValue(uint64_t{0}));
+}
+
+TEST(WideMultiplyDivide, MinGoodForSignedTimesPosRatioIsLastInputNotExceedingLowerLimit) {
+    struct I8LowerLimitMinus100 : NoUpperLimit<int8_t> {
+        static constexpr int8_t lower() { return -100; }
+    };
+
+    // -67 * 3 / 2 truncates to -100, but -68 * 3 / 2 is -102.
+    EXPECT_THAT(min_good_value(wide_multiply_divide<int8_t>(mag<3>() / mag<2>()),
+                               I8LowerLimitMinus100{}),
+                SameTypeAndValue(int8_t{-67}));
+}
+
+TEST(WideMultiplyDivide, MinGoodForSignedTimesNegRatioIsLastInputNotExceedingUpperLimit) {
+    struct I8UpperLimit100 : NoLowerLimit<int8_t> {
+        static constexpr int8_t upper() { return 100; }
+    };
+
+    EXPECT_THAT(
+        min_good_value(wide_multiply_divide<int8_t>(-mag<3>() / mag<2>()), I8UpperLimit100{}),
+        SameTypeAndValue(int8_t{-67}));
+}
+
+TEST(WideMultiplyDivide, MinGoodIsLowestIfRatioIsSmallerThanOne) {
+    EXPECT_THAT(min_good_value(wide_multiply_divide<int64_t>(mag<9>() / mag<100'000>())),
+                SameTypeAndValue(std::numeric_limits<int64_t>::lowest()));
+}
+
+//
+// `MaxGood<WideMultiplyDivide>`:
+//
+
+TEST(WideMultiplyDivide, MaxGoodForSignedTimesPosRatioIsLastInputNotExceedingUpperLimit) {
+    struct I8UpperLimit100 : NoLowerLimit<int8_t> {
+        static constexpr int8_t upper() { return 100; }
+    };
+
+    EXPECT_THAT(
+        max_good_value(wide_multiply_divide<int8_t>(mag<3>() / mag<2>()), I8UpperLimit100{}),
+        SameTypeAndValue(int8_t{67}));
+}
+
+TEST(WideMultiplyDivide, MaxGoodForSignedTimesNegRatioIsLastInputNotExceedingLowerLimit) {
+    struct I8LowerLimitMinus100 : NoUpperLimit<int8_t> {
+        static constexpr int8_t lower() { return -100; }
+    };
+
+    EXPECT_THAT(max_good_value(wide_multiply_divide<int8_t>(-mag<3>() / mag<2>()),
+                               I8LowerLimitMinus100{}),
+                SameTypeAndValue(int8_t{67}));
+}
+
+TEST(WideMultiplyDivide, MaxGoodForUnsignedUsesFullRangeOfType) {
+    EXPECT_THAT(max_good_value(wide_multiply_divide<uint64_t>(mag<1000>() / mag<7>())),
+                SameTypeAndValue(uint64_t{129'127'208'515'966'861u}));
+}
+
+TEST(WideMultiplyDivide, MaxGoodIsHighestIfRatioIsSmallerThanOne) {
+    EXPECT_THAT(max_good_value(wide_multiply_divide<int64_t>(mag<9>() / mag<100'000>())),
+                SameTypeAndValue(std::numeric_limits<int64_t>::max()));
+}
+
+TEST(WideMultiplyDivide, SafeRangeIsWiderThanForNarrowMultiplyThenDivide) {
+    const auto narrow_op = op_sequence(multiply_type_by<int64_t>(mag<100'000>()),
+                                       divide_type_by_integer<int64_t>(mag<9>()));
+    const auto wide_op = wide_multiply_divide<int64_t>(mag<100'000>() / mag<9>());
+
+    EXPECT_THAT(max_good_value(narrow_op), SameTypeAndValue(int64_t{92'233'720'368'547}));
+    EXPECT_THAT(max_good_value(wide_op), SameTypeAndValue(int64_t{830'103'483'316'929}));
+    EXPECT_THAT(min_good_value(wide_op), SameTypeAndValue(int64_t{-830'103'483'316'929}));
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // `OpSequence` section:
 
@@ -1668,6 +1760,81 @@ TEST(CanOverflowAbove, FalseIfValueCannotBeBigEnoughToGoOutsideBounds) {
     EXPECT_THAT(can_overflow_above(multiply_type_by<double>(-mag<1>() / PI)), IsFalse());
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `ReversesOrder` section:
+
+TEST(ReversesOrder, TrueOnlyForOddNumberOfNegativeFactors) {
+    EXPECT_THAT((ReversesOrder<StaticCast<int16_t, int8_t>>::value), IsFalse());
+    EXPECT_THAT(ReversesOrder<decltype(multiply_type_by<int>(mag<3>()))>::value, IsFalse());
+    EXPECT_THAT(ReversesOrder<decltype(multiply_type_by<int>(-mag<3>()))>::value, IsTrue());
+    EXPECT_THAT(ReversesOrder<decltype(divide_type_by_integer<int>(-mag<3>()))>::value, IsTrue());
+
+    using TwoNegatives = decltype(op_sequence(multiply_type_by<int>(-mag<3>()),
+                                              divide_type_by_integer<int>(-mag<2>())));
+    EXPECT_THAT(ReversesOrder<TwoNegatives>::value, IsFalse());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `saturating_apply()` section:
+
+TEST(SaturatingApply, MatchesOpWhenValueDoesNotOverflow) {
+    using Op = decltype(multiply_type_by<int32_t>(mag<2>()));
+    EXPECT_THAT(saturating_apply<Op>(int32_t{1'073'741'823}),
+                SameTypeAndValue(int32_t{2'147'483'646}));
+    EXPECT_THAT(saturating_apply<Op>(int32_t{-1'073'741'824}),
+                SameTypeAndValue(std::numeric_limits<int32_t>::min()));
+}
+
+TEST(SaturatingApply, ClampsToLimitInDirectionOfOverflow) {
+    using Op = decltype(multiply_type_by<int32_t>(mag<2>()));
+    EXPECT_THAT(saturating_apply<Op>(int32_t{1'073'741'824}),
+                SameTypeAndValue(std::numeric_limits<int32_t>::max()));
+    EXPECT_THAT(saturating_apply<Op>(int32_t{-1'073'741'825}),
+                SameTypeAndValue(std::numeric_limits<int32_t>::min()));
+
+    using Narrow =
+        decltype(op_sequence(multiply_type_by<int>(mag<100>()), StaticCast<int, int16_t>{}));
+    EXPECT_THAT(saturating_apply<Narrow>(328), SameTypeAndValue(int16_t{32'767}));
+    EXPECT_THAT(saturating_apply<Narrow>(-328), SameTypeAndValue(int16_t{-32'768}));
+}
+
+TEST(SaturatingApply, SwapsLimitsForNegativeFactors) {
+    using Op =
+        decltype(op_sequence(multiply_type_by<int>(-mag<100>()), StaticCast<int, int16_t>{}));
+    EXPECT_THAT(saturating_apply<Op>(327), SameTypeAndValue(int16_t{-32'700}));
+    EXPECT_THAT(saturating_apply<Op>(328), SameTypeAndValue(int16_t{-32'768}));
+    EXPECT_THAT(saturating_apply<Op>(-328), SameTypeAndValue(int16_t{32'767}));
+}
+
+TEST(SaturatingApply, ClampsUnsignedDestinationAtZero) {
+    using Op = StaticCast<int, uint8_t>;
+    EXPECT_THAT(saturating_apply<Op>(-5), SameTypeAndValue(uint8_t{0}));
+    EXPECT_THAT(saturating_apply<Op>(300), SameTypeAndValue(uint8_t{255}));
+}
+
+TEST(SaturatingApply, ClampsFloatingPointToFiniteLimits) {
+    using Op = StaticCast<double, float>;
+    EXPECT_THAT(saturating_apply<Op>(1e300), SameTypeAndValue(std::numeric_limits<float>::max()));
+    EXPECT_THAT(saturating_apply<Op>(-1e300),
+                SameTypeAndValue(std::numeric_limits<float>::lowest()));
+}
+
+TEST(SaturatingApply, ConvertsNaNToZeroForIntegralOutput) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    using ToInt = StaticCast<double, int32_t>;
+    EXPECT_THAT(saturating_apply<ToInt>(nan), SameTypeAndValue(int32_t{0}));
+
+    using Op = decltype(op_sequence(multiply_type_by<double>(mag<100>()),
+                                    StaticCast<double, int16_t>{}));
+    EXPECT_THAT(saturating_apply<Op>(nan), SameTypeAndValue(int16_t{0}));
+}
+
+TEST(SaturatingApply, KeepsNaNForFloatingPointOutput) {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    using ToFloat = StaticCast<double, float>;
+    EXPECT_THAT(std::isnan(saturating_apply<ToFloat>(nan)), IsTrue());
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // `clamped_negate()` section
 
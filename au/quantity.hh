@@ -128,7 +128,45 @@ AU_DEVICE_FUNC constexpr T as_raw_number(T x) {
     return x;
 }
 
+// The result of a fused check-and-convert operation, such as `q.try_in(unit)`.
+template <typename T>
+struct TryConversionResult {
+    // Which risks, if any, were realized.
+    ConversionFailure failure;
+
+    // Only valid/meaningful if `ok()`.
+    T value = {};
+
+    AU_DEVICE_FUNC constexpr bool ok() const { return !failure; }
+};
+
 namespace detail {
+// Check `x` for every risk of the conversion `Op`, and convert it, unless it would overflow.
+//
+// Applying `Op` to a value which overflows could be undefined behavior (for example, for signed
+// integers), so in that case we leave the result value-initialized.  The exception is an output
+// which can't be value-initialized, such as a lazy Eigen expression.  Building one of those does
+// no arithmetic, so it's safe, as long as nobody evaluates it.
+template <typename Op>
+AU_DEVICE_FUNC constexpr TryConversionResult<OpOutput<Op>> try_apply(const OpInput<Op> &x,
+                                                                     ConversionFailure failure,
+                                                                     std::true_type) {
+    return failure.overflow() ? TryConversionResult<OpOutput<Op>>{failure}
+                              : TryConversionResult<OpOutput<Op>>{failure, Op::apply_to(x)};
+}
+template <typename Op>
+AU_DEVICE_FUNC constexpr TryConversionResult<OpOutput<Op>> try_apply(const OpInput<Op> &x,
+                                                                     ConversionFailure failure,
+                                                                     std::false_type) {
+    return {failure, Op::apply_to(x)};
+}
+template <typename Op>
+AU_DEVICE_FUNC constexpr TryConversionResult<OpOutput<Op>> try_apply(const OpInput<Op> &x) {
+    return try_apply<Op>(x,
+                         realized_risks<Op>(x, ALL_RISKS),
+                         std::is_default_constructible<OpOutput<Op>>{});
+}
+
 // We implement `Quantity` comparisons by converting to a common unit, and comparing the values
 // stored in the underlying Rep types.  This means we need to know the _sign_ of that common unit,
 // so we can know which order to pass those underlying values (it gets reversed for negative units).
@@ -168,8 +206,8 @@ class Quantity {
     AU_DEVICE_FUNC constexpr Quantity(
         const Quantity<OtherUnit, OtherRep> &other)  // NOLINT(runtime/explicit)
         // `ignore(ALL_RISKS)` because we already determined that this implicit conversion is OK.
-        : value_{other.template in_impl<detail::UseImplicitConversion, Rep>(UnitT{},
-                                                                            ignore(ALL_RISKS))} {}
+        : value_{other.template in_impl<detail::ImplicitConversionCastStrategy<OtherRep, Rep>, Rep>(
+              UnitT{}, ignore(ALL_RISKS))} {}
 
     // EXPLICIT constructor for another Quantity of the same Dimension.
     template <typename OtherUnit,
@@ -183,7 +221,7 @@ class Quantity {
     template <typename OtherUnit,
               typename OtherRep,
               typename RiskPolicyT,
-              std::enable_if_t<IsConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
+              std::enable_if_t<detail::IsAnyConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
     AU_DEVICE_FUNC constexpr Quantity(const Quantity<OtherUnit, OtherRep> &other,
                                       RiskPolicyT policy)
         : value_{other.template in<Rep>(UnitT{}, policy)} {}
@@ -205,7 +243,7 @@ class Quantity {
     // `q.as<Rep>()`, or `q.as<Rep>(risk_policy)`
     template <typename NewRep,
               typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
-              std::enable_if_t<IsConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
+              std::enable_if_t<detail::IsAnyConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
     AU_DEVICE_FUNC constexpr auto as(RiskPolicyT policy = RiskPolicyT{}) const {
         using ActualRep = detail::ResolveSameRep<Rep, NewRep>;
         return make_quantity<Unit>(in_impl<detail::UseStaticCast, ActualRep>(Unit{}, policy));
@@ -215,7 +253,7 @@ class Quantity {
     template <typename NewRep,
               typename NewUnitSlot,
               typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
-              std::enable_if_t<!IsConversionRiskPolicy<NewUnitSlot>::value, int> = 0>
+              std::enable_if_t<!detail::IsAnyConversionRiskPolicy<NewUnitSlot>::value, int> = 0>
     AU_DEVICE_FUNC constexpr auto as(NewUnitSlot u, RiskPolicyT policy = RiskPolicyT{}) const {
         using ActualRep = detail::ResolveSameRep<Rep, NewRep>;
         return make_quantity<AssociatedUnit<NewUnitSlot>>(
@@ -244,6 +282,30 @@ class Quantity {
         return in_impl<detail::UseStaticCast, void>(u, policy);
     }
 
+    // Fused check-and-convert: `q.try_in<Rep>(new_unit)`, or `q.try_in(new_unit)`.
+    //
+    // Performs the conversion regardless of risk, along with the runtime checks for every risk, as
+    // a single operation.  The result says whether the value is valid, and if so, holds it.
+    template <typename NewRep, typename NewUnitSlot>
+    AU_DEVICE_FUNC constexpr auto try_in(NewUnitSlot u) const {
+        using ActualRep = detail::ResolveSameRep<Rep, NewRep>;
+        return try_in_impl<ActualRep>(u);
+    }
+    template <typename NewUnitSlot>
+    AU_DEVICE_FUNC constexpr auto try_in(NewUnitSlot u) const {
+        return try_in_impl<void>(u);
+    }
+
+    // Fused check-and-convert: `q.try_as<Rep>(new_unit)`, or `q.try_as(new_unit)`.
+    template <typename NewRep, typename NewUnitSlot>
+    AU_DEVICE_FUNC constexpr auto try_as(NewUnitSlot u) const {
+        return as_quantity_result<AssociatedUnit<NewUnitSlot>>(try_in<NewRep>(u));
+    }
+    template <typename NewUnitSlot>
+    AU_DEVICE_FUNC constexpr auto try_as(NewUnitSlot u) const {
+        return as_quantity_result<AssociatedUnit<NewUnitSlot>>(try_in(u));
+    }
+
     // "Forcing" conversions, which explicitly ignore safety checks for overflow and truncation.
     template <typename NewUnit>
     [[deprecated(
@@ -443,8 +505,9 @@ class Quantity {
               typename OtherRep,
               typename Enable = EnableIfImplicitOkIs<true, OtherUnit, OtherRep>>
     AU_DEVICE_FUNC constexpr Quantity &operator=(Quantity<OtherUnit, OtherRep> other) & {
-        value_ = other.template in_impl<detail::UseImplicitConversion, detail::UnderlyingType<Rep>>(
-            Unit{}, check_for(ALL_RISKS));
+        using NewRep = detail::UnderlyingType<Rep>;
+        value_ = other.template in_impl<detail::ImplicitConversionCastStrategy<OtherRep, NewRep>,
+                                        NewRep>(Unit{}, check_for(ALL_RISKS));
         return *this;
     }
 
@@ -460,8 +523,9 @@ class Quantity {
               typename Enable = EnableIfImplicitOkIs<true, OtherUnit, OtherRep>,
               std::enable_if_t<IsView<R>::value, int> = 0>
     AU_DEVICE_FUNC constexpr Quantity &operator=(Quantity<OtherUnit, OtherRep> other) && {
-        value_ = other.template in_impl<detail::UseImplicitConversion, detail::UnderlyingType<Rep>>(
-            Unit{}, check_for(ALL_RISKS));
+        using NewRep = detail::UnderlyingType<Rep>;
+        value_ = other.template in_impl<detail::ImplicitConversionCastStrategy<OtherRep, NewRep>,
+                                        NewRep>(Unit{}, check_for(ALL_RISKS));
         return *this;
     }
 
@@ -631,48 +695,42 @@ class Quantity {
               typename OtherRep,
               typename OtherUnitSlot,
               typename RiskPolicyT>
-    AU_DEVICE_FUNC constexpr auto in_impl(OtherUnitSlot, RiskPolicyT) const {
+    AU_DEVICE_FUNC constexpr auto in_impl(OtherUnitSlot, RiskPolicyT policy) const {
         using OtherUnit = AssociatedUnit<OtherUnitSlot>;
         static_assert(IsUnit<OtherUnit>::value, "Invalid type passed to unit slot");
 
         using Op = detail::
             ConversionForRepsAndFactor<CastStrategy, Rep, OtherRep, UnitRatio<Unit, OtherUnit>>;
 
-        constexpr bool should_check_overflow =
-            RiskPolicyT{}.should_check(detail::ConversionRisk::Overflow);
-        constexpr bool is_overflow_risk_ok = stdx::disjunction<
-            detail::OverflowRiskAcceptablyLow<Op>,
-            detail::PermitAsCarveOutForIntegerPromotion<OtherRep,
-                                                        UnitRatio<Unit, OtherUnit>,
-                                                        Rep>>::value;
-
-        constexpr bool should_check_truncation =
-            RiskPolicyT{}.should_check(detail::ConversionRisk::Truncation);
-        constexpr bool is_truncation_risk_ok = detail::TruncationRiskAcceptablyLow<Op>::value;
-
-        constexpr bool is_overflow_only_unacceptable_risk =
-            (should_check_overflow && !is_overflow_risk_ok && is_truncation_risk_ok);
-        static_assert(!is_overflow_only_unacceptable_risk,
-                      "Overflow risk too high.  See "
-                      "<https://aurora-opensource.github.io/au/main/troubleshooting/#risk-too-high>"
-                      ".  Your \"risk set\" is `OVERFLOW_RISK`.");
-
-        constexpr bool is_truncation_only_unacceptable_risk =
-            (should_check_truncation && !is_truncation_risk_ok && is_overflow_risk_ok);
-        static_assert(!is_truncation_only_unacceptable_risk,
-                      "Truncation risk too high.  See "
-                      "<https://aurora-opensource.github.io/au/main/troubleshooting/#risk-too-high>"
-                      ".  Your \"risk set\" is `TRUNCATION_RISK`.");
-
-        constexpr bool are_both_overflow_and_truncation_unacceptably_risky =
-            (should_check_overflow || should_check_truncation) && !is_overflow_risk_ok &&
-            !is_truncation_risk_ok;
-        static_assert(!are_both_overflow_and_truncation_unacceptably_risky,
-                      "Both truncation and overflow risk too high.  See "
-                      "<https://aurora-opensource.github.io/au/main/troubleshooting/#risk-too-high>"
-                      ".  Your \"risk set\" is `OVERFLOW_RISK | TRUNCATION_RISK`.");
-
-        return Op::apply_to(value_);
+        detail::assert_conversion_risk_acceptable<CastStrategy,
+                                                  Rep,
+                                                  OtherRep,
+                                                  UnitRatio<Unit, OtherUnit>,
+                                                  detail::CompileTimeRiskPolicy<RiskPolicyT>>();
+
+        return detail::apply_with_risk_policy<Op>(value_, policy);
+    }
+
+    // The checks happen on the input value, against limits which we compute at compile time, so
+    // the conversion itself runs at most once (and not at all, if the value would overflow).  (For
+    // integer division, the compiler can also share the division between the result and the
+    // truncation check.)
+    template <typename OtherRep, typename OtherUnitSlot>
+    AU_DEVICE_FUNC constexpr auto try_in_impl(OtherUnitSlot) const {
+        using OtherUnit = AssociatedUnit<OtherUnitSlot>;
+        static_assert(IsUnit<OtherUnit>::value, "Invalid type passed to unit slot");
+
+        using Op = detail::ConversionForRepsAndFactor<detail::UseStaticCast,
+                                                      Rep,
+                                                      OtherRep,
+                                                      UnitRatio<Unit, OtherUnit>>;
+        return detail::try_apply<Op>(value_);
+    }
+
+    template <typename NewUnit, typename R>
+    static AU_DEVICE_FUNC constexpr TryConversionResult<Quantity<NewUnit, R>> as_quantity_result(
+        const TryConversionResult<R> &result) {
+        return {result.failure, make_quantity<NewUnit>(result.value)};
     }
 
     AU_DEVICE_FUNC constexpr Quantity(Rep value) : value_{std::move(value)} {}
@@ -141,7 +141,7 @@ class QuantityPoint {
     template <typename OtherUnit,
               typename OtherRep,
               typename RiskPolicyT,
-              std::enable_if_t<IsConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
+              std::enable_if_t<detail::IsAnyConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
     AU_DEVICE_FUNC constexpr QuantityPoint(const QuantityPoint<OtherUnit, OtherRep> &other,
                                            RiskPolicyT policy)
         : QuantityPoint{other.template as<Rep>(Unit{}, policy)} {}
@@ -153,7 +153,7 @@ class QuantityPoint {
     // `p.as<Rep>()`, or `p.as<Rep>(risk_policy)`
     template <typename NewRep,
               typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
-              std::enable_if_t<IsConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
+              std::enable_if_t<detail::IsAnyConversionRiskPolicy<RiskPolicyT>::value, int> = 0>
     AU_DEVICE_FUNC constexpr auto as(RiskPolicyT policy = RiskPolicyT{}) const {
         using ActualRep = detail::ResolveSameRep<Rep, NewRep>;
         return make_quantity_point<Unit>(in_impl<ActualRep>(Unit{}, policy));
@@ -163,7 +163,7 @@ class QuantityPoint {
     template <typename NewRep,
               typename NewUnit,
               typename RiskPolicyT = decltype(check_for(ALL_RISKS)),
-              std::enable_if_t<!IsConversionRiskPolicy<NewUnit>::value, int> = 0>
+              std::enable_if_t<!detail::IsAnyConversionRiskPolicy<NewUnit>::value, int> = 0>
     AU_DEVICE_FUNC constexpr auto as(NewUnit u, RiskPolicyT policy = RiskPolicyT{}) const {
         using ActualRep = detail::ResolveSameRep<Rep, NewRep>;
         return make_quantity_point<AssociatedUnitForPoints<NewUnit>>(in_impl<ActualRep>(u, policy));
@@ -289,6 +289,18 @@ TEST(QuantityPoint, AsCanProvideConversionPolicy) {
                 SameTypeAndValue(kelvins_pt(284)));
 }
 
+TEST(QuantityPoint, AsCanCheckRisksAtRuntime) {
+    ConversionFailure failure;
+    const auto policy = check_at_runtime(ALL_RISKS, record_failure_in(failure));
+
+    EXPECT_THAT(celsius_pt(27).as(milli(kelvins_pt), policy),
+                SameTypeAndValue(milli(kelvins_pt)(300'150)));
+    EXPECT_THAT(static_cast<bool>(failure), IsFalse());
+
+    EXPECT_THAT(celsius_pt(10).as(kelvins_pt, policy), SameTypeAndValue(kelvins_pt(283)));
+    EXPECT_THAT(failure.truncation(), IsTrue());
+}
+
 TEST(QuantityPoint, AsWithExplicitRepCanProvideConversionPolicy) {
     EXPECT_THAT(celsius_pt(10.86).as<int>(kelvins_pt, ignore(TRUNCATION_RISK)),
                 SameTypeAndValue(kelvins_pt(284)));
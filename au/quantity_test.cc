@@ -15,6 +15,7 @@
 #include "au/quantity.hh"
 
 #include <complex>
+#include <limits>
 #include <utility>
 
 #include "au/prefix.hh"
@@ -814,6 +815,190 @@ TEST(Quantity, IgnoringTruncationRiskCanProduceTruncation) {
     EXPECT_THAT(inches(35).as(feet, ignore(TRUNCATION_RISK)), SameTypeAndValue(feet(2)));
 }
 
+TEST(Quantity, RuntimeCheckedPolicyPermitsConversionsTooRiskyForCompileTime) {
+    ConversionFailure failure;
+    const auto policy = check_at_runtime(ALL_RISKS, record_failure_in(failure));
+
+    // `int32_t` overflows at about 2.1 seconds in nanoseconds, so this can't pass `check_for()`.
+    EXPECT_THAT(seconds(int32_t{2}).in(nano(seconds), policy),
+                SameTypeAndValue(int32_t{2'000'000'000}));
+    EXPECT_THAT(inches(36).as(feet, policy), SameTypeAndValue(feet(3)));
+    EXPECT_THAT(static_cast<bool>(failure), IsFalse());
+}
+
+TEST(Quantity, RuntimeCheckedPolicyReportsOverflow) {
+    ConversionFailure failure;
+    seconds(int32_t{3}).in(nano(seconds), check_at_runtime(ALL_RISKS, record_failure_in(failure)));
+    EXPECT_THAT(failure.overflow(), IsTrue());
+    EXPECT_THAT(failure.truncation(), IsFalse());
+}
+
+TEST(Quantity, RuntimeCheckedPolicySaturatesValuesWhichOverflow) {
+    ConversionFailure failure;
+    const auto policy = check_at_runtime(OVERFLOW_RISK, record_failure_in(failure));
+
+    EXPECT_THAT(seconds(int32_t{3}).in(nano(seconds), policy),
+                SameTypeAndValue(std::numeric_limits<int32_t>::max()));
+    EXPECT_THAT(seconds(int32_t{-3}).in(nano(seconds), policy),
+                SameTypeAndValue(std::numeric_limits<int32_t>::min()));
+    EXPECT_THAT(meters(int32_t{-1}).in<uint8_t>(centi(meters), policy),
+                SameTypeAndValue(uint8_t{0}));
+    EXPECT_THAT(failure.overflow(), IsTrue());
+}
+
+TEST(Quantity, RuntimeCheckedPolicyReportsTruncation) {
+    ConversionFailure failure;
+    const auto q = inches(35).as(feet, check_at_runtime(ALL_RISKS, record_failure_in(failure)));
+    EXPECT_THAT(q, SameTypeAndValue(feet(2)));
+    EXPECT_THAT(failure.overflow(), IsFalse());
+    EXPECT_THAT(failure.truncation(), IsTrue());
+}
+
+TEST(Quantity, RuntimeCheckedPolicyOnlyChecksNamedRisks) {
+    ConversionFailure failure;
+    inches(35).in(feet, check_at_runtime(OVERFLOW_RISK, record_failure_in(failure)));
+    EXPECT_THAT(static_cast<bool>(failure), IsFalse());
+
+    inches(35).in(feet, check_at_runtime(TRUNCATION_RISK, record_failure_in(failure)));
+    EXPECT_THAT(failure.truncation(), IsTrue());
+}
+
+TEST(Quantity, RuntimeCheckedPolicyCallsHandlerOncePerFailedConversion) {
+    int calls = 0;
+    const auto policy = check_at_runtime(ALL_RISKS, [&calls](ConversionFailure f) {
+        EXPECT_THAT(f.overflow(), IsTrue());
+        EXPECT_THAT(f.truncation(), IsFalse());
+        ++calls;
+    });
+
+    meters(uint8_t{1}).in<uint8_t>(centi(meters), policy);
+    EXPECT_THAT(calls, Eq(0));
+
+    meters(uint8_t{3}).in<uint8_t>(centi(meters), policy);
+    EXPECT_THAT(calls, Eq(1));
+}
+
+TEST(Quantity, RuntimeCheckedPolicyWorksWithExplicitRepAndConstructor) {
+    ConversionFailure failure;
+    const auto policy = check_at_runtime(ALL_RISKS, record_failure_in(failure));
+
+    EXPECT_THAT(meters(2.5).as<int>(centi(meters), policy), SameTypeAndValue(centi(meters)(250)));
+    EXPECT_THAT(static_cast<bool>(failure), IsFalse());
+
+    const QuantityI<Centi<Meters>> x{meters(2.555), policy};
+    EXPECT_THAT(x, SameTypeAndValue(centi(meters)(255)));
+    EXPECT_THAT(failure.truncation(), IsTrue());
+}
+
+TEST(Quantity, RuntimeCheckedPolicyWithDefaultHandlerPassesValidConversions) {
+    EXPECT_THAT(seconds(int32_t{2}).in(nano(seconds), check_at_runtime(ALL_RISKS)),
+                SameTypeAndValue(int32_t{2'000'000'000}));
+}
+
+TEST(Quantity, SaturatePolicyClampsOverflowToLimitsOfDestination) {
+    // `int16_t` centimeters overflow just above 327 meters.
+    EXPECT_THAT(meters(int32_t{327}).in<int16_t>(centi(meters), saturate),
+                SameTypeAndValue(int16_t{32'700}));
+    EXPECT_THAT(meters(int32_t{328}).in<int16_t>(centi(meters), saturate),
+                SameTypeAndValue(int16_t{32'767}));
+    EXPECT_THAT(meters(int32_t{-1'000'000}).as<int16_t>(centi(meters), saturate),
+                SameTypeAndValue(centi(meters)(int16_t{-32'768})));
+    EXPECT_THAT(meters(-1).in<uint8_t>(centi(meters), saturate), SameTypeAndValue(uint8_t{0}));
+}
+
+TEST(Quantity, SaturatePolicyClampsInCorrectDirectionForNegativeUnits) {
+    constexpr auto neginches = inches * (-mag<1>());
+    EXPECT_THAT(inches(int32_t{40'000}).in<int16_t>(neginches, saturate),
+                SameTypeAndValue(int16_t{-32'768}));
+    EXPECT_THAT(inches(int32_t{-40'000}).in<int16_t>(neginches, saturate),
+                SameTypeAndValue(int16_t{32'767}));
+}
+
+TEST(Quantity, SaturatePolicyClampsToBoundsOfBoundedDestination) {
+    using Cm = Bounded<int32_t, 0, 250>;
+    EXPECT_THAT(meters(3).in<Cm>(centi(meters), saturate).value(), Eq(250));
+    EXPECT_THAT(meters(-3).in<Cm>(centi(meters), saturate).value(), Eq(0));
+    EXPECT_THAT(meters(2).in<Cm>(centi(meters), saturate).value(), Eq(200));
+}
+
+TEST(Quantity, SaturatePolicyConvertsNaNToValueClosestToZeroForIntegralDestination) {
+    const auto policy = saturate.but_ignoring(TRUNCATION_RISK);
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_THAT(meters(nan).in<int16_t>(centi(meters), policy), SameTypeAndValue(int16_t{0}));
+
+    using Cm = Bounded<int32_t, 10, 250>;
+    EXPECT_THAT(meters(nan).in<Cm>(centi(meters), policy).value(), Eq(10));
+}
+
+TEST(Quantity, SaturatePolicyCanIgnoreTruncation) {
+    const auto policy = saturate.but_ignoring(TRUNCATION_RISK);
+    EXPECT_THAT(inches(int32_t{-1'000'000}).in<int8_t>(feet, policy),
+                SameTypeAndValue(int8_t{-128}));
+    EXPECT_THAT(inches(35).in<int8_t>(feet, policy),
+                SameTypeAndValue(int8_t{2}));
+}
+
+TEST(Quantity, SaturatePolicyWorksWithConstructor) {
+    const Quantity<Centi<Meters>, int16_t> x{meters(int32_t{500}), saturate};
+    EXPECT_THAT(x, SameTypeAndValue(centi(meters)(int16_t{32'767})));
+}
+
+TEST(Quantity, TryInProducesValueForSafeConversion) {
+    constexpr auto result = seconds(int32_t{2}).try_in(nano(seconds));
+    EXPECT_THAT(result.ok(), IsTrue());
+    EXPECT_THAT(result.value, SameTypeAndValue(int32_t{2'000'000'000}));
+}
+
+TEST(Quantity, TryInReportsRealizedRisks) {
+    const auto overflow = seconds(int32_t{3}).try_in(nano(seconds));
+    EXPECT_THAT(overflow.ok(), IsFalse());
+    EXPECT_THAT(overflow.failure.overflow(), IsTrue());
+    EXPECT_THAT(overflow.failure.truncation(), IsFalse());
+
+    const auto truncation = inches(35).try_in(feet);
+    EXPECT_THAT(truncation.ok(), IsFalse());
+    EXPECT_THAT(truncation.failure.overflow(), IsFalse());
+    EXPECT_THAT(truncation.failure.truncation(), IsTrue());
+}
+
+TEST(Quantity, TryInLeavesValueInitializedOnOverflow) {
+    EXPECT_THAT(seconds(int32_t{3}).try_in(nano(seconds)).value, SameTypeAndValue(int32_t{0}));
+    EXPECT_THAT(seconds(int32_t{-3}).try_in(nano(seconds)).value, SameTypeAndValue(int32_t{0}));
+    EXPECT_THAT(seconds(int32_t{3}).try_as(nano(seconds)).value,
+                SameTypeAndValue(nano(seconds)(int32_t{0})));
+
+    // Truncation alone still produces the (truncated) converted value.
+    EXPECT_THAT(inches(35).try_in(feet).value, SameTypeAndValue(2));
+}
+
+TEST(Quantity, TryInWithExplicitRepChecksDestinationType) {
+    EXPECT_THAT(meters(2.5).try_in<int>(centi(meters)).value, SameTypeAndValue(250));
+    EXPECT_THAT(meters(2.5).try_in<int>(meters).failure.truncation(), IsTrue());
+    EXPECT_THAT(meters(1).try_in<uint8_t>(centi(meters)).ok(), IsTrue());
+    EXPECT_THAT(meters(3).try_in<uint8_t>(centi(meters)).failure.overflow(), IsTrue());
+    EXPECT_THAT(meters(-1).try_in<uint8_t>(centi(meters)).failure.overflow(), IsTrue());
+}
+
+TEST(Quantity, TryAsProducesQuantity) {
+    constexpr auto result = feet(3).try_as(inches);
+    StaticAssertTypeEq<decltype(result), const TryConversionResult<QuantityI<Inches>>>();
+    EXPECT_THAT(result.ok(), IsTrue());
+    EXPECT_THAT(result.value, SameTypeAndValue(inches(36)));
+
+    const auto lossy = inches(35).try_as<int16_t>(feet);
+    StaticAssertTypeEq<decltype(lossy), const TryConversionResult<Quantity<Feet, int16_t>>>();
+    EXPECT_THAT(lossy.ok(), IsFalse());
+}
+
+TEST(Quantity, TryInAgreesWithIsConversionLossy) {
+    for (int i = -300; i <= 300; ++i) {
+        const auto q = inches(i);
+        EXPECT_THAT(q.try_in<int8_t>(feet).ok(), Eq(!is_conversion_lossy<int8_t>(q, feet)));
+        EXPECT_THAT(q.try_in<uint8_t>(milli(inches)).ok(),
+                    Eq(!is_conversion_lossy<uint8_t>(q, milli(inches))));
+    }
+}
+
 TEST(Quantity, ComparisonsAreReversedForNegativeUnits) {
     constexpr auto neginches = inches * (-mag<1>());
     EXPECT_THAT(neginches(10), Gt(neginches(20)));
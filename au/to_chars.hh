@@ -0,0 +1,117 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <system_error>
+
+#include "au/quantity.hh"
+#include "au/quantity_point.hh"
+#include "au/unit_of_measure.hh"
+
+// `std::to_chars`-style output for `Quantity` and `QuantityPoint`.
+//
+// The output layout matches `operator<<` (from `"au/io.hh"`): the number, a space, and the unit
+// label; points are wrapped in `@(...)`.  The number is written by `std::to_chars`, and the unit
+// label is copied from its compile time constant.  Nothing allocates, and nothing depends on the
+// locale.
+//
+// Note that by default, `std::to_chars` writes floating point numbers in their shortest round-trip
+// form, whereas streams default to 6 significant digits.  Pass a `std::chars_format` and precision
+// to control this.
+//
+// This requires full `std::to_chars` support (including floating point types), which means C++17
+// and a sufficiently recent standard library.  Don't include this file in other configurations.
+
+namespace au {
+namespace detail {
+
+// Copy `[src, src + n)` to `[first, last)`, producing the same result as `std::to_chars` would.
+inline std::to_chars_result copy_chars(char *first, char *last, const char *src, std::size_t n) {
+    if (static_cast<std::size_t>(last - first) < n) {
+        return {last, std::errc::value_too_large};
+    }
+    for (std::size_t i = 0u; i < n; ++i) {
+        first[i] = src[i];
+    }
+    return {first + n, std::errc{}};
+}
+
+template <typename U, typename R, typename... NumberArgs>
+std::to_chars_result quantity_to_chars(char *first,
+                                       char *last,
+                                       const R &value,
+                                       const NumberArgs &...number_args) {
+    // Integer promotion makes sure that reps like `int8_t` print as numbers, as in `operator<<`.
+    auto result = std::to_chars(first, last, +value, number_args...);
+    if (result.ec != std::errc{}) {
+        return result;
+    }
+
+    result = copy_chars(result.ptr, last, " ", 1u);
+    if (result.ec != std::errc{}) {
+        return result;
+    }
+
+    const auto &label = unit_label(U{});
+    return copy_chars(result.ptr, last, label, sizeof(label) - 1u);
+}
+
+}  // namespace detail
+
+//
+// Write `q` to `[first, last)`, in the same format as `operator<<`.
+//
+// Just like `std::to_chars`, the result holds a pointer one past the last character written, and an
+// empty error code.  If the output doesn't fit, the error code is `std::errc::value_too_large`, the
+// pointer is `last`, and the contents of `[first, last)` are unspecified.  No null terminator is
+// written.
+//
+// Any additional arguments are forwarded to `std::to_chars` for the number: for example, a base
+// (for integral reps), or a `std::chars_format` and precision (for floating point reps).
+//
+template <typename U, typename R, typename... NumberArgs>
+std::to_chars_result to_chars(char *first,
+                              char *last,
+                              const Quantity<U, R> &q,
+                              const NumberArgs &...number_args) {
+    return detail::quantity_to_chars<U>(first, last, q.data_in(U{}), number_args...);
+}
+
+//
+// Write `p` to `[first, last)`, in the same format as `operator<<`.
+//
+// See above for the meaning of the result, and of any additional arguments.
+//
+template <typename U, typename R, typename... NumberArgs>
+std::to_chars_result to_chars(char *first,
+                              char *last,
+                              const QuantityPoint<U, R> &p,
+                              const NumberArgs &...number_args) {
+    auto result = detail::copy_chars(first, last, "@(", 2u);
+    if (result.ec != std::errc{}) {
+        return result;
+    }
+
+    result = detail::quantity_to_chars<U>(result.ptr, last, p.data_in(U{}), number_args...);
+    if (result.ec != std::errc{}) {
+        return result;
+    }
+
+    return detail::copy_chars(result.ptr, last, ")", 1u);
+}
+
+}  // namespace au
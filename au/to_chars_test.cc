@@ -0,0 +1,133 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/to_chars.hh"
+
+#include <array>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "au/io.hh"
+#include "au/prefix.hh"
+#include "au/units/celsius.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace au {
+namespace {
+
+using ::testing::Eq;
+using ::testing::StrEq;
+
+using symbols::m;
+using symbols::s;
+constexpr auto cm = centi(m);
+
+// Write `x` with `to_chars()` into a buffer of size `N`, and return the result as a string.
+//
+// If the write fails, returns the name of the error instead.
+template <std::size_t N = 64, typename T, typename... NumberArgs>
+std::string to_string_via_to_chars(const T &x, const NumberArgs &...number_args) {
+    std::array<char, N> buf{};
+    const auto result = to_chars(buf.data(), buf.data() + buf.size(), x, number_args...);
+    if (result.ec == std::errc::value_too_large) {
+        return "value_too_large";
+    }
+    return std::string(buf.data(), result.ptr);
+}
+
+template <typename T>
+std::string to_string_via_stream(const T &x) {
+    std::ostringstream oss;
+    oss << x;
+    return oss.str();
+}
+
+TEST(ToChars, PrintsValueAndUnitLabel) {
+    EXPECT_THAT(to_string_via_to_chars(meters(8.5)), StrEq("8.5 m"));
+    EXPECT_THAT(to_string_via_to_chars(seconds(-3)), StrEq("-3 s"));
+}
+
+TEST(ToChars, PrintsCompoundUnitLabels) {
+    EXPECT_THAT(to_string_via_to_chars(987 * cm / s), StrEq("987 cm / s"));
+}
+
+TEST(ToChars, PrintsSmallIntegralRepsAsNumbers) {
+    EXPECT_THAT(to_string_via_to_chars(meters(int8_t{65})), StrEq("65 m"));
+    EXPECT_THAT(to_string_via_to_chars(meters(uint8_t{200})), StrEq("200 m"));
+}
+
+TEST(ToChars, MatchesStreamOutputForDefaultFormat) {
+    EXPECT_THAT(to_string_via_to_chars(meters(123)), StrEq(to_string_via_stream(meters(123))));
+    EXPECT_THAT(to_string_via_to_chars(int8_t{-5} * cm),
+                StrEq(to_string_via_stream(int8_t{-5} * cm)));
+    EXPECT_THAT(to_string_via_to_chars(celsius_pt(20.5)),
+                StrEq(to_string_via_stream(celsius_pt(20.5))));
+}
+
+TEST(ToChars, ForwardsExtraArgumentsToNumberFormatting) {
+    EXPECT_THAT(to_string_via_to_chars(meters(255), 16), StrEq("ff m"));
+    EXPECT_THAT(to_string_via_to_chars(meters(123.456), std::chars_format::fixed, 2),
+                StrEq("123.46 m"));
+    EXPECT_THAT(to_string_via_to_chars(meters(1500.0), std::chars_format::scientific),
+                StrEq("1.5e+03 m"));
+}
+
+TEST(ToChars, PrintsQuantityPointInsideAtParens) {
+    EXPECT_THAT(to_string_via_to_chars(meters_pt(123.456)), StrEq("@(123.456 m)"));
+    EXPECT_THAT(to_string_via_to_chars(celsius_pt(-40), 16), StrEq("@(-28 degC)"));
+}
+
+TEST(ToChars, ReturnsPointerPastLastCharacterWritten) {
+    std::array<char, 16> buf;
+    buf.fill('x');
+
+    const auto result = to_chars(buf.data(), buf.data() + buf.size(), meters(42));
+
+    EXPECT_THAT(result.ec, Eq(std::errc{}));
+    EXPECT_THAT(result.ptr, Eq(buf.data() + 4));
+    EXPECT_THAT(buf[4], Eq('x'));
+}
+
+TEST(ToChars, SucceedsWhenOutputExactlyFillsBuffer) {
+    EXPECT_THAT(to_string_via_to_chars<4>(meters(42)), StrEq("42 m"));
+    EXPECT_THAT(to_string_via_to_chars<7>(meters_pt(42)), StrEq("@(42 m)"));
+}
+
+TEST(ToChars, ReportsValueTooLargeWhenAnyPartDoesNotFit) {
+    // Number doesn't fit.
+    EXPECT_THAT(to_string_via_to_chars<1>(meters(42)), StrEq("value_too_large"));
+
+    // Space doesn't fit.
+    EXPECT_THAT(to_string_via_to_chars<2>(meters(42)), StrEq("value_too_large"));
+
+    // Label doesn't fit.
+    EXPECT_THAT(to_string_via_to_chars<9>(987 * cm / s), StrEq("value_too_large"));
+
+    // Point wrapper doesn't fit.
+    EXPECT_THAT(to_string_via_to_chars<1>(meters_pt(42)), StrEq("value_too_large"));
+    EXPECT_THAT(to_string_via_to_chars<6>(meters_pt(42)), StrEq("value_too_large"));
+}
+
+TEST(ToChars, ReturnsLastOnFailure) {
+    std::array<char, 3> buf{};
+    const auto result = to_chars(buf.data(), buf.data() + buf.size(), 987 * cm / s);
+    EXPECT_THAT(result.ptr, Eq(buf.data() + buf.size()));
+}
+
+}  // namespace
+}  // namespace au
@@ -30,9 +30,16 @@ struct TruncationRiskClass {
     static constexpr int truncation_risk_class() { return N; }
 };
 
+// Each risk is parameterized on the _scalar_ type `T` that it assesses.  `would_value_truncate()`
+// accepts any value `V` whose elements are `T`: either `T` itself, or a lane-wise type (such as
+// `std::experimental::simd`), for which we report whether _any_ lane would truncate.
+
 template <typename T>
 struct NoTruncationRisk : TruncationRiskClass<0> {
-    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const T &) { return false; }
+    template <typename V>
+    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const V &) {
+        return false;
+    }
 };
 
 template <typename T, typename M>
@@ -46,12 +53,18 @@ using ValueIsNotInteger = ValueTimesRatioIsNotInteger<T, Magnitude<>>;
 
 template <typename T>
 struct ValueIsNotZero : TruncationRiskClass<20> {
-    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const T &x) { return x != T{0}; }
+    template <typename V>
+    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const V &x) {
+        return any_lane_nonzero(x);
+    }
 };
 
 template <typename T>
 struct CannotAssessTruncationRiskFor : TruncationRiskClass<1000> {
-    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const T &) { return true; }
+    template <typename V>
+    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const V &) {
+        return true;
+    }
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -172,6 +185,17 @@ template <typename T, typename M>
 struct TruncationRiskForImpl<DivideTypeByInteger<T, M>>
     : TruncationRiskForDivideByIntAssumingScalar<RealPart<T>, M> {};
 
+#if defined(__SIZEOF_INT128__)
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// `WideMultiplyDivide<T, M>` section:
+
+// The wider intermediate changes only _whether_ we overflow, not _what_ we compute: the result is
+// still the product with `M`, truncated toward zero.
+template <typename T, typename M>
+struct TruncationRiskForImpl<WideMultiplyDivide<T, M>>
+    : TruncationRiskForMultiplyByAssumingScalar<T, M> {};
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 // `OpSequence<...>` section:
 
@@ -233,6 +257,15 @@ template <typename T, typename M1, typename M2>
 struct UpdateRiskImpl<DivideTypeByInteger<T, M1>, ValueTimesRatioIsNotInteger<RealPart<T>, M2>>
     : stdx::type_identity<ReduceValueTimesRatioIsNotInteger<RealPart<T>, MagQuotient<M2, M1>>> {};
 
+#if defined(__SIZEOF_INT128__)
+template <template <class> class Risk, typename T, typename M>
+struct UpdateRiskImpl<WideMultiplyDivide<T, M>, Risk<T>> : stdx::type_identity<Risk<T>> {};
+
+template <typename T, typename M1, typename M2>
+struct UpdateRiskImpl<WideMultiplyDivide<T, M1>, ValueTimesRatioIsNotInteger<T, M2>>
+    : stdx::type_identity<ReduceValueTimesRatioIsNotInteger<T, MagProduct<M1, M2>>> {};
+#endif
+
 //
 // `BiggestRiskImpl<Risk1, Risk2>` is a helper that computes the "biggest" risk between two risks.
 //
@@ -290,15 +323,17 @@ struct TruncationRiskForImpl<OpSequenceImpl<Op, Ops...>>
 
 template <typename T, typename M>
 struct ValueTimesRatioIsNotIntegerImplForIntWhereDenominatorDoesNotFit {
-    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const T &value) {
-        return value != T{0};
+    template <typename V>
+    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const V &value) {
+        return any_lane_nonzero(value);
     }
 };
 
 template <typename T, typename M>
 struct ValueTimesRatioIsNotIntegerImplForIntWhereDenominatorFits {
-    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const T &value) {
-        return (value % get_value<RealPart<T>>(Denominator<M>{})) != T{0};
+    template <typename V>
+    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const V &value) {
+        return any_lane_not_multiple_of(value, get_value<T>(Denominator<M>{}));
     }
 };
 
@@ -311,17 +346,21 @@ struct ValueTimesRatioIsNotIntegerImplForInt
 
 template <typename T, typename M>
 struct ValueTimesRatioIsNotIntegerImplForFloatGeneric {
-    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const T &value) {
-        const auto result = value * get_value<RealPart<T>>(M{});
-        return std::trunc(result) != result;
+    template <typename V>
+    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const V &value) {
+        using std::trunc;
+        const auto result = value * get_value<T>(M{});
+        return any_lane(trunc(result) != result);
     }
 };
 
 template <typename T, typename M>
 struct ValueTimesRatioIsNotIntegerImplForFloatDivideByInteger {
-    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const T &value) {
-        const auto result = value / get_value<RealPart<T>>(MagInverse<M>{});
-        return std::trunc(result) != result;
+    template <typename V>
+    static AU_DEVICE_FUNC constexpr bool would_value_truncate(const V &value) {
+        using std::trunc;
+        const auto result = value / get_value<T>(MagInverse<M>{});
+        return any_lane(trunc(result) != result);
     }
 };
 
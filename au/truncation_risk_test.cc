@@ -197,6 +197,25 @@ TEST(TruncationRiskFor, DivideIntByTooBigIntGivesValuesIsNotZero) {
                        ValueIsNotZero<uint8_t>>();
 }
 
+#if defined(__SIZEOF_INT128__)
+//
+// `WideMultiplyDivide` section:
+//
+
+TEST(TruncationRiskFor, WideMultiplyDivideTruncatesValuesWhoseProductWithRatioIsNotInteger) {
+    using M = decltype(mag<100'000>() / mag<9>());
+    StaticAssertTypeEq<TruncationRiskFor<WideMultiplyDivide<int64_t, M>>,
+                       ValueTimesRatioIsNotInteger<int64_t, M>>();
+}
+
+TEST(TruncationRiskFor, WideMultiplyDivideThenCastToWiderIntHasSameRisk) {
+    using M = decltype(mag<9>() / mag<100'000>());
+    StaticAssertTypeEq<
+        TruncationRiskFor<OpSequence<WideMultiplyDivide<int32_t, M>, StaticCast<int32_t, int64_t>>>,
+        ValueTimesRatioIsNotInteger<int32_t, M>>();
+}
+#endif
+
 //
 // `OpSequence` section:
 //
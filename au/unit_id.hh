@@ -0,0 +1,137 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "au/dimension.hh"
+#include "au/magnitude.hh"
+#include "au/packs.hh"
+#include "au/unit_of_measure.hh"
+
+// A compact runtime identity for units: a 64-bit hash of the unit's dimension and magnitude.
+//
+// The hash depends only on the canonical forms of the `Dimension` and `Magnitude`, which means that
+// quantity-equivalent units always get the same ID.  It is computed from integer values only (base
+// dimension indices, primes, and exponents), using a fixed byte order, so the same unit gets the
+// same ID with every compiler, platform, and build.
+//
+// Different units _could_ collide, but with 64 bits, this is astronomically unlikely for any
+// realistic set of units.  Code that needs a guarantee can check its own set of IDs for uniqueness
+// at compile time.
+
+namespace au {
+
+// The ID of a unit (type trait form).
+template <typename U>
+struct UnitId;
+
+// The ID of a unit (instance form).  Accepts any unit slot (e.g., `unit_id(meters / second)`).
+template <typename UnitSlot>
+constexpr uint64_t unit_id(UnitSlot) {
+    return UnitId<AssociatedUnit<UnitSlot>>::value;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Implementation details below
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// 64-bit FNV-1a: https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function
+constexpr uint64_t FNV1A_OFFSET_BASIS = 14'695'981'039'346'656'037u;
+constexpr uint64_t FNV1A_PRIME = 1'099'511'628'211u;
+
+// Mix the 8 bytes of `word` into `hash`, least significant byte first (regardless of platform).
+constexpr uint64_t fnv1a_mix_word(uint64_t hash, uint64_t word) {
+    for (int i = 0; i < 8; ++i) {
+        hash = (hash ^ (word & 0xFFu)) * FNV1A_PRIME;
+        word >>= 8;
+    }
+    return hash;
+}
+
+// Each base power contributes four words: a tag saying what kind of base it is, an integer that
+// identifies the base among others of its kind, and the numerator and denominator of its exponent.
+enum class UnitIdBaseTag : uint64_t {
+    BASE_DIMENSION = 1u,
+    PRIME = 2u,
+    PI = 3u,
+    NEGATIVE = 4u,
+};
+
+template <template <class...> class Pack, typename B>
+struct UnitIdBase;
+
+template <typename B>
+struct UnitIdBase<Dimension, B> {
+    static constexpr UnitIdBaseTag tag = UnitIdBaseTag::BASE_DIMENSION;
+    static constexpr int64_t index = B::base_dim_index;
+};
+
+template <std::uintmax_t N>
+struct UnitIdBase<Magnitude, Prime<N>> {
+    static constexpr UnitIdBaseTag tag = UnitIdBaseTag::PRIME;
+    static constexpr uint64_t index = N;
+};
+
+template <>
+struct UnitIdBase<Magnitude, Pi> {
+    static constexpr UnitIdBaseTag tag = UnitIdBaseTag::PI;
+    static constexpr uint64_t index = 0u;
+};
+
+template <>
+struct UnitIdBase<Magnitude, Negative> {
+    static constexpr UnitIdBaseTag tag = UnitIdBaseTag::NEGATIVE;
+    static constexpr uint64_t index = 0u;
+};
+
+template <template <class...> class Pack, typename BP>
+constexpr uint64_t mix_base_power(uint64_t hash) {
+    using B = UnitIdBase<Pack, Base<BP>>;
+    hash = fnv1a_mix_word(hash, static_cast<uint64_t>(B::tag));
+    hash = fnv1a_mix_word(hash, static_cast<uint64_t>(B::index));
+    hash = fnv1a_mix_word(hash, static_cast<uint64_t>(Exp<BP>::num));
+    return fnv1a_mix_word(hash, static_cast<uint64_t>(Exp<BP>::den));
+}
+
+template <typename PackT>
+struct MixPack;
+
+template <template <class...> class Pack>
+struct MixPack<Pack<>> {
+    static constexpr uint64_t mix(uint64_t hash) { return hash; }
+};
+
+template <template <class...> class Pack, typename H, typename... Ts>
+struct MixPack<Pack<H, Ts...>> {
+    static constexpr uint64_t mix(uint64_t hash) {
+        return MixPack<Pack<Ts...>>::mix(mix_base_power<Pack, H>(hash));
+    }
+};
+
+}  // namespace detail
+
+template <typename U>
+struct UnitId
+    : std::integral_constant<
+          uint64_t,
+          detail::MixPack<detail::MagT<U>>::mix(
+              detail::MixPack<detail::DimT<U>>::mix(detail::FNV1A_OFFSET_BASIS))> {
+    static_assert(IsUnit<U>::value, "UnitId requires a unit type");
+};
+
+}  // namespace au
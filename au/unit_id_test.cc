@@ -0,0 +1,111 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/unit_id.hh"
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/celsius.hh"
+#include "au/units/degrees.hh"
+#include "au/units/feet.hh"
+#include "au/units/hertz.hh"
+#include "au/units/hours.hh"
+#include "au/units/kelvins.hh"
+#include "au/units/meters.hh"
+#include "au/units/radians.hh"
+#include "au/units/seconds.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace au {
+
+using ::testing::Eq;
+using ::testing::Ne;
+
+namespace {
+
+// Dispatch on a unit ID at runtime, as a logging or IPC layer might.
+const char *name_for(uint64_t id) {
+    switch (id) {
+        case unit_id(meters):
+            return "length";
+        case unit_id(seconds):
+            return "time";
+        case unit_id(meters / second):
+            return "speed";
+        default:
+            return "unknown";
+    }
+}
+
+}  // namespace
+
+TEST(UnitId, IsCompileTimeConstant) {
+    constexpr uint64_t id = unit_id(meters);
+    static_assert(id == UnitId<Meters>::value, "Type trait and instance forms must agree");
+    EXPECT_THAT(id, Eq(UnitId<Meters>::value));
+}
+
+TEST(UnitId, AcceptsAnyUnitSlot) {
+    EXPECT_THAT(unit_id(meters), Eq(unit_id(Meters{})));
+    EXPECT_THAT(unit_id(symbols::m), Eq(unit_id(Meters{})));
+}
+
+TEST(UnitId, SameForQuantityEquivalentUnits) {
+    ASSERT_THAT(are_units_quantity_equivalent(meters * hertz, meters / second), Eq(true));
+    EXPECT_THAT(unit_id(meters * hertz), Eq(unit_id(meters / second)));
+
+    ASSERT_THAT(are_units_quantity_equivalent(celsius_qty, kelvins), Eq(true));
+    EXPECT_THAT(unit_id(celsius_qty), Eq(unit_id(kelvins)));
+
+    EXPECT_THAT(unit_id(kilo(meters) / kilo(seconds)), Eq(unit_id(meters / second)));
+}
+
+TEST(UnitId, DiffersForDifferentDimensions) {
+    EXPECT_THAT(unit_id(meters), Ne(unit_id(seconds)));
+    EXPECT_THAT(unit_id(meters), Ne(unit_id(squared(meters))));
+    EXPECT_THAT(unit_id(meters / second), Ne(unit_id(seconds / meter)));
+    EXPECT_THAT(unit_id(meters * seconds), Ne(unit_id(meters / second)));
+}
+
+TEST(UnitId, DiffersForDifferentMagnitudes) {
+    EXPECT_THAT(unit_id(meters), Ne(unit_id(kilo(meters))));
+    EXPECT_THAT(unit_id(kilo(meters)), Ne(unit_id(milli(meters))));
+    EXPECT_THAT(unit_id(meters), Ne(unit_id(feet)));
+    EXPECT_THAT(unit_id(radians), Ne(unit_id(degrees)));
+    EXPECT_THAT(unit_id(meters), Ne(unit_id(meters * (-mag<1>()))));
+}
+
+TEST(UnitId, DiffersForDifferentRationalExponents) {
+    EXPECT_THAT(unit_id(root<2>(meters)), Ne(unit_id(meters)));
+    EXPECT_THAT(unit_id(root<2>(meters)), Ne(unit_id(root<3>(meters))));
+}
+
+TEST(UnitId, SupportsSwitchDispatch) {
+    EXPECT_THAT(name_for(unit_id(meters)), testing::StrEq("length"));
+    EXPECT_THAT(name_for(unit_id(meters * hertz)), testing::StrEq("speed"));
+    EXPECT_THAT(name_for(unit_id(feet)), testing::StrEq("unknown"));
+}
+
+TEST(UnitId, IsStableAcrossBuilds) {
+    // These values are part of the contract: they must never change, on any compiler or platform.
+    // If this test fails, then IDs stored in logs or shared memory by earlier builds would be
+    // misinterpreted.
+    EXPECT_THAT(unit_id(UnitImpl<Dimension<>>{}), Eq(uint64_t{14'695'981'039'346'656'037u}));
+    EXPECT_THAT(unit_id(meters), Eq(uint64_t{5'132'902'972'707'789'982u}));
+    EXPECT_THAT(unit_id(kilo(meters) / hour), Eq(uint64_t{13'430'209'231'022'390'041u}));
+    EXPECT_THAT(unit_id(degrees), Eq(uint64_t{8'898'506'158'789'764'701u}));
+}
+
+}  // namespace au
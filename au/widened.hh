@@ -0,0 +1,153 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "au/config.hh"
+#include "au/conversion_policy.hh"
+#include "au/conversion_strategy.hh"
+#include "au/overflow_boundary.hh"
+#include "au/quantity.hh"
+#include "au/unit_of_measure.hh"
+
+// Conversions whose intermediate product is computed in a 128-bit integer.
+//
+// Converting an integral quantity by a rational factor `N / D` multiplies by `N`, then divides by
+// `D`.  Ordinarily, the product lives in the (promoted) rep, so it can overflow long before the
+// final result would: for example, converting `int64_t` nanoseconds to ticks of a 90 kHz clock
+// multiplies by 9, then divides by 100'000.  The `widened_in()` and `widened_as()` functions in
+// this file compute that product in a 128-bit integer instead, so that the only values which
+// overflow are those whose _result_ can't fit in the destination.
+//
+// Every other kind of conversion is carried out exactly as for `.in()` and `.as()`.
+//
+// These are only available when the compiler provides a 128-bit integer type.
+
+#if defined(__SIZEOF_INT128__)
+
+namespace au {
+
+namespace detail {
+template <typename TargetRep, typename U, typename R, typename TargetUnitSlot>
+using WidenedConversionOp =
+    WidenedConversionForRepsAndFactor<UseStaticCast,
+                                      R,
+                                      TargetRep,
+                                      UnitRatio<U, AssociatedUnit<TargetUnitSlot>>>;
+
+template <typename TargetRep, typename TargetUnitSlot, typename U, typename R, typename RiskPolicyT>
+AU_DEVICE_FUNC constexpr auto widened_in_impl(TargetUnitSlot,
+                                              Quantity<U, R> q,
+                                              RiskPolicyT policy) {
+    using TargetUnit = AssociatedUnit<TargetUnitSlot>;
+    static_assert(IsUnit<TargetUnit>::value, "Invalid type passed to unit slot");
+    using Op = WidenedConversionOp<TargetRep, U, R, TargetUnitSlot>;
+
+    assert_op_risk_acceptable<Op,
+                              R,
+                              TargetRep,
+                              UnitRatio<U, TargetUnit>,
+                              CompileTimeRiskPolicy<RiskPolicyT>>();
+
+    return apply_with_risk_policy<Op>(q.in(U{}), policy);
+}
+}  // namespace detail
+
+//
+// The value of `q` in `target_unit`, using a 128-bit intermediate product for integer conversions
+// by nontrivial rational factors.
+//
+// This is the "Unit-only" format (i.e., `widened_in(target_unit, q)`).
+//
+template <typename TargetUnitSlot,
+          typename U,
+          typename R,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+AU_DEVICE_FUNC constexpr auto widened_in(TargetUnitSlot target_unit,
+                                         Quantity<U, R> q,
+                                         RiskPolicyT policy = RiskPolicyT{}) {
+    return detail::widened_in_impl<void>(target_unit, q, policy);
+}
+
+//
+// The value of `q` in `target_unit`, as `TargetRep`, using a 128-bit intermediate product for
+// integer conversions by nontrivial rational factors.
+//
+// This is the "Explicit-Rep" format (e.g., `widened_in<int64_t>(target_unit, q)`).
+//
+template <typename TargetRep,
+          typename TargetUnitSlot,
+          typename U,
+          typename R,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+AU_DEVICE_FUNC constexpr auto widened_in(TargetUnitSlot target_unit,
+                                         Quantity<U, R> q,
+                                         RiskPolicyT policy = RiskPolicyT{}) {
+    return detail::widened_in_impl<TargetRep>(target_unit, q, policy);
+}
+
+//
+// `q` expressed in `target_unit`, using a 128-bit intermediate product for integer conversions by
+// nontrivial rational factors.
+//
+// This is the "Unit-only" format (i.e., `widened_as(target_unit, q)`).
+//
+template <typename TargetUnitSlot,
+          typename U,
+          typename R,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+AU_DEVICE_FUNC constexpr auto widened_as(TargetUnitSlot target_unit,
+                                         Quantity<U, R> q,
+                                         RiskPolicyT policy = RiskPolicyT{}) {
+    return make_quantity<AssociatedUnit<TargetUnitSlot>>(widened_in(target_unit, q, policy));
+}
+
+//
+// `q` expressed in `target_unit`, as `TargetRep`, using a 128-bit intermediate product for integer
+// conversions by nontrivial rational factors.
+//
+// This is the "Explicit-Rep" format (e.g., `widened_as<int64_t>(target_unit, q)`).
+//
+template <typename TargetRep,
+          typename TargetUnitSlot,
+          typename U,
+          typename R,
+          typename RiskPolicyT = decltype(check_for(ALL_RISKS))>
+AU_DEVICE_FUNC constexpr auto widened_as(TargetUnitSlot target_unit,
+                                         Quantity<U, R> q,
+                                         RiskPolicyT policy = RiskPolicyT{}) {
+    return make_quantity<AssociatedUnit<TargetUnitSlot>>(
+        widened_in<TargetRep>(target_unit, q, policy));
+}
+
+// Check `widened_in()`/`widened_as()` conversion for overflow (implicit rep).
+//
+// (There's no separate truncation checker: `will_conversion_truncate()` gives the same answer for
+// widened conversions, because widening changes only which values overflow.)
+template <typename U, typename R, typename TargetUnitSlot>
+AU_DEVICE_FUNC constexpr bool will_widened_conversion_overflow(Quantity<U, R> q, TargetUnitSlot) {
+    using Op = detail::WidenedConversionOp<void, U, R, TargetUnitSlot>;
+    return detail::would_value_overflow<Op>(q.in(U{}));
+}
+
+// Check `widened_in()`/`widened_as()` conversion for overflow (explicit rep).
+template <typename TargetRep, typename U, typename R, typename TargetUnitSlot>
+AU_DEVICE_FUNC constexpr bool will_widened_conversion_overflow(Quantity<U, R> q, TargetUnitSlot) {
+    using Op = detail::WidenedConversionOp<TargetRep, U, R, TargetUnitSlot>;
+    return detail::would_value_overflow<Op>(q.in(U{}));
+}
+
+}  // namespace au
+
+#endif
@@ -0,0 +1,132 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/widened.hh"
+
+#include <cstdint>
+#include <limits>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#if defined(__SIZEOF_INT128__)
+
+namespace au {
+
+using ::testing::IsFalse;
+using ::testing::IsTrue;
+
+struct Seconds : UnitImpl<Time> {};
+constexpr auto seconds = QuantityMaker<Seconds>{};
+
+// Ticks of a 90 kHz clock, as used for MPEG timestamps.
+struct Ticks : decltype(Seconds{} / mag<90'000>()) {};
+constexpr auto ticks = QuantityMaker<Ticks>{};
+
+struct Minutes : decltype(Seconds{} * mag<60>()) {};
+constexpr auto minutes = QuantityMaker<Minutes>{};
+
+// About 63 years, in nanoseconds: too big to multiply by 9 in an `int64_t`.
+constexpr int64_t BIG_NS = 2'000'000'000'000'000'000;
+
+TEST(WidenedIn, ConvertsValuesWhoseNarrowProductWouldOverflow) {
+    const auto t = nano(seconds)(BIG_NS);
+
+    EXPECT_THAT(will_conversion_overflow(t, ticks), IsTrue());
+    EXPECT_THAT(widened_in(ticks, t, ignore(TRUNCATION_RISK)),
+                SameTypeAndValue(int64_t{180'000'000'000'000}));
+}
+
+TEST(WidenedIn, MatchesInWhereInDoesNotOverflow) {
+    for (const int64_t ns : {int64_t{-123'456'789'012}, int64_t{-1}, int64_t{0}, int64_t{11'111},
+                             int64_t{999'999'999'999}}) {
+        const auto t = nano(seconds)(ns);
+        EXPECT_THAT(widened_in(ticks, t, ignore(TRUNCATION_RISK)),
+                    SameTypeAndValue(t.in(ticks, ignore(TRUNCATION_RISK))))
+            << "ns = " << ns;
+    }
+}
+
+TEST(WidenedIn, TruncatesTowardZero) {
+    EXPECT_THAT(widened_in(ticks, nano(seconds)(int64_t{-22'223}), ignore(TRUNCATION_RISK)),
+                SameTypeAndValue(int64_t{-2}));
+}
+
+TEST(WidenedIn, SupportsExplicitRep) {
+    EXPECT_THAT(widened_in<int32_t>(ticks, nano(seconds)(BIG_NS), ignore(ALL_RISKS)),
+                SameTypeAndValue(static_cast<int32_t>(int64_t{180'000'000'000'000})));
+    EXPECT_THAT(widened_in<double>(ticks, nano(seconds)(int64_t{100'000})), SameTypeAndValue(9.0));
+}
+
+TEST(WidenedIn, HandlesOtherConversionsJustLikeIn) {
+    EXPECT_THAT(widened_in(seconds, minutes(int64_t{3})), SameTypeAndValue(int64_t{180}));
+    EXPECT_THAT(widened_in(seconds, ticks(45'000.0)), SameTypeAndValue(0.5));
+    EXPECT_THAT(widened_in(seconds, seconds(uint8_t{7})), SameTypeAndValue(uint8_t{7}));
+}
+
+TEST(WidenedIn, SaturatesWithSaturatePolicy) {
+    EXPECT_THAT(widened_in(nano(seconds), seconds(int32_t{5'000}), saturate),
+                SameTypeAndValue(std::numeric_limits<int32_t>::max()));
+    EXPECT_THAT(widened_in(nano(seconds), seconds(int32_t{-5'000}), saturate),
+                SameTypeAndValue(std::numeric_limits<int32_t>::min()));
+    EXPECT_THAT(widened_in(ticks, nano(seconds)(BIG_NS), saturate.but_ignoring(TRUNCATION_RISK)),
+                SameTypeAndValue(int64_t{180'000'000'000'000}));
+}
+
+TEST(WidenedIn, ChecksAtRuntimeWithRuntimePolicy) {
+    ConversionFailure failure;
+    const auto policy = check_at_runtime(ALL_RISKS, record_failure_in(failure));
+
+    EXPECT_THAT(widened_in(ticks, nano(seconds)(BIG_NS), policy),
+                SameTypeAndValue(int64_t{180'000'000'000'000}));
+    EXPECT_THAT(static_cast<bool>(failure), IsFalse());
+
+    EXPECT_THAT(widened_in(ticks, nano(seconds)(int64_t{11'111}), policy),
+                SameTypeAndValue(int64_t{0}));
+    EXPECT_THAT(failure.truncation(), IsTrue());
+    EXPECT_THAT(failure.overflow(), IsFalse());
+
+    EXPECT_THAT(widened_in(nano(seconds), seconds(int32_t{5'000}), policy),
+                SameTypeAndValue(std::numeric_limits<int32_t>::max()));
+    EXPECT_THAT(failure.overflow(), IsTrue());
+}
+
+TEST(WidenedAs, ReturnsQuantityInTargetUnit) {
+    EXPECT_THAT(widened_as(ticks, nano(seconds)(BIG_NS), ignore(TRUNCATION_RISK)),
+                SameTypeAndValue(ticks(int64_t{180'000'000'000'000})));
+    EXPECT_THAT(widened_as<uint64_t>(ticks, nano(seconds)(uint64_t{100'000}), ignore(ALL_RISKS)),
+                SameTypeAndValue(ticks(uint64_t{9})));
+}
+
+TEST(WillWidenedConversionOverflow, TrueOnlyIfResultCannotFit) {
+    constexpr auto MAX = std::numeric_limits<int64_t>::max();
+
+    EXPECT_THAT(will_widened_conversion_overflow(nano(seconds)(BIG_NS), ticks), IsFalse());
+    EXPECT_THAT(will_widened_conversion_overflow(ticks(MAX), nano(seconds)), IsTrue());
+    EXPECT_THAT(will_widened_conversion_overflow(ticks(MAX / 11'112), nano(seconds)), IsFalse());
+    EXPECT_THAT(will_widened_conversion_overflow(ticks(MAX / 11'111), nano(seconds)), IsTrue());
+}
+
+TEST(WillWidenedConversionOverflow, AccountsForExplicitRep) {
+    EXPECT_THAT(will_widened_conversion_overflow<int32_t>(nano(seconds)(BIG_NS), ticks), IsTrue());
+    EXPECT_THAT(will_widened_conversion_overflow<int32_t>(nano(seconds)(int64_t{1'000'000'000}),
+                                                          ticks),
+                IsFalse());
+}
+
+}  // namespace au
+
+#endif
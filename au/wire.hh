@@ -0,0 +1,344 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+
+#include "au/also_accept.hh"
+#include "au/conversion_policy.hh"
+#include "au/quantity.hh"
+#include "au/quantity_point.hh"
+#include "au/unit_id.hh"
+#include "au/unit_of_measure.hh"
+
+// A compact binary encoding for `Quantity` and `QuantityPoint` values, for sending them between
+// processes.
+//
+// Each value takes `WireSize<T>::value` bytes: an 8-byte _wire tag_, followed by the bytes of the
+// rep.  The tag is a hash of the unit's `unit_id()`, the rep type, and (for points) the origin, so
+// the reader can tell whether the value is what it expects, or whether it's in some other unit that
+// it knows how to convert from.  Both parts are stored least significant byte first, on every
+// platform.
+//
+// When the tag matches the destination type, decoding is a bounds check, one comparison, and a
+// `memcpy`.  Otherwise, the value goes through the usual unit conversion, with a runtime check that
+// it doesn't overflow or truncate.
+
+namespace au {
+
+// The tag which identifies values of type `T` (a `Quantity` or `QuantityPoint`) on the wire.
+template <typename T>
+struct WireTag;
+
+// The number of bytes which values of type `T` take on the wire.
+template <typename T>
+struct WireSize;
+
+// The number of bytes in every wire tag.
+constexpr std::size_t WIRE_TAG_SIZE = 8u;
+
+// The result of `to_wire()`: like `std::to_chars_result`.
+struct ToWireResult {
+    char *ptr;
+    std::errc ec;
+};
+
+// The result of `from_wire()`: like `std::from_chars_result`.
+struct FromWireResult {
+    const char *ptr;
+    std::errc ec;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Implementation details below
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// What kind of value is on the wire: the first word we mix into the unit ID to make the tag.
+enum class WireKind : uint64_t {
+    QUANTITY = 1u,
+    QUANTITY_POINT = 2u,
+};
+
+// The second word: what kind of number the rep is, and how many bytes it takes.
+enum class WireRepKind : uint64_t {
+    FLOATING_POINT = 1u,
+    SIGNED_INTEGER = 2u,
+    UNSIGNED_INTEGER = 3u,
+};
+
+template <typename R>
+constexpr uint64_t wire_rep_code() {
+    constexpr WireRepKind kind = std::is_floating_point<R>::value ? WireRepKind::FLOATING_POINT
+                                 : std::is_signed<R>::value       ? WireRepKind::SIGNED_INTEGER
+                                                                  : WireRepKind::UNSIGNED_INTEGER;
+    return (static_cast<uint64_t>(kind) << 8) | sizeof(R);
+}
+
+// For points, we also mix in the origin, as the displacement from zero.  The leading word tells a
+// zero displacement apart from a displacement of exactly one coherent unit (`Magnitude<>`).
+template <typename OriginDisplacementMag>
+struct MixWireOrigin {
+    static constexpr uint64_t mix(uint64_t hash) {
+        return MixPack<OriginDisplacementMag>::mix(fnv1a_mix_word(hash, 1u));
+    }
+};
+template <>
+struct MixWireOrigin<Zero> {
+    static constexpr uint64_t mix(uint64_t hash) { return fnv1a_mix_word(hash, 0u); }
+};
+
+template <typename U, typename R>
+constexpr uint64_t wire_tag(WireKind kind) {
+    static_assert(std::is_arithmetic<R>::value, "Wire encoding requires an arithmetic rep");
+    return fnv1a_mix_word(fnv1a_mix_word(UnitId<U>::value, static_cast<uint64_t>(kind)),
+                          wire_rep_code<R>());
+}
+
+// Copy the bytes of `value` to `out`, least significant byte first.
+template <typename T>
+void store_little_endian(T value, char *out) {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    for (std::size_t i = 0u; i < sizeof(T); ++i) {
+        out[i] = bytes[sizeof(T) - 1u - i];
+    }
+#else
+    std::memcpy(out, &value, sizeof(T));
+#endif
+}
+
+// Read a `T` from `in`, which holds its bytes least significant byte first.
+template <typename T>
+T load_little_endian(const char *in) {
+    T value;
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    char bytes[sizeof(T)];
+    for (std::size_t i = 0u; i < sizeof(T); ++i) {
+        bytes[i] = in[sizeof(T) - 1u - i];
+    }
+    std::memcpy(&value, bytes, sizeof(T));
+#else
+    std::memcpy(&value, in, sizeof(T));
+#endif
+    return value;
+}
+
+// Whether converting the point `p` to `TargetUnit` (with rep `R`) would overflow or truncate.
+//
+// This follows the same steps as `QuantityPoint::as()`: convert to a common unit, shift by the
+// displacement between the origins, and convert to the target unit.  We check each conversion step
+// in the same way as `is_conversion_lossy()`.
+template <typename R, typename TargetUnit, typename SourceUnit, typename SourceRep>
+bool is_point_conversion_lossy(QuantityPoint<SourceUnit, SourceRep> p, TargetUnit) {
+    using OriginDisplacementUnit = ComputeOriginDisplacementUnit<SourceUnit, TargetUnit>;
+    using Common = CommonUnit<SourceUnit, TargetUnit, OriginDisplacementUnit>;
+    using CalcRep = typename IntermediateRep<SourceRep, R>::type;
+
+    const auto x = make_quantity<SourceUnit>(p.in(SourceUnit{}));
+    if (is_conversion_lossy<CalcRep>(x, Common{})) {
+        return true;
+    }
+    const Quantity<Common, CalcRep> shifted =
+        rep_cast<CalcRep>(x.template as<CalcRep>(Common{}, ignore(ALL_RISKS)) +
+                          origin_displacement(TargetUnit{}, SourceUnit{}));
+    return is_conversion_lossy<R>(shifted, TargetUnit{});
+}
+
+// How to take apart, and put together, each type we can put on the wire.
+template <typename T>
+struct WireCodec;
+
+template <typename U, typename R>
+struct WireCodec<Quantity<U, R>> {
+    template <typename NewUnit>
+    using WithUnit = Quantity<NewUnit, R>;
+
+    static R value_of(const Quantity<U, R> &q) { return q.in(U{}); }
+    static Quantity<U, R> make(R value) { return make_quantity<U>(value); }
+
+    template <typename SourceUnit>
+    static bool assign_if_lossless(R value, Quantity<U, R> &q) {
+        const auto source = make_quantity<SourceUnit>(value);
+        if (is_conversion_lossy<R>(source, U{})) {
+            return false;
+        }
+        q = source.template as<R>(U{}, ignore(ALL_RISKS));
+        return true;
+    }
+};
+
+template <typename U, typename R>
+struct WireCodec<QuantityPoint<U, R>> {
+    template <typename NewUnit>
+    using WithUnit = QuantityPoint<NewUnit, R>;
+
+    static R value_of(const QuantityPoint<U, R> &p) { return p.in(U{}); }
+    static QuantityPoint<U, R> make(R value) { return make_quantity_point<U>(value); }
+
+    template <typename SourceUnit>
+    static bool assign_if_lossless(R value, QuantityPoint<U, R> &p) {
+        const auto source = make_quantity_point<SourceUnit>(value);
+        if (is_point_conversion_lossy<R>(source, U{})) {
+            return false;
+        }
+        p = source.template as<R>(U{}, ignore(ALL_RISKS));
+        return true;
+    }
+};
+
+template <typename T>
+ToWireResult write_wire(char *first, char *last, const T &x) {
+    if (last - first < static_cast<std::ptrdiff_t>(WireSize<T>::value)) {
+        return {last, std::errc::value_too_large};
+    }
+    store_little_endian(WireTag<T>::value, first);
+    store_little_endian(WireCodec<T>::value_of(x), first + WIRE_TAG_SIZE);
+    return {first + WireSize<T>::value, std::errc{}};
+}
+
+// Store `value` in `x`, if `tag` belongs to one of the `AlsoAccept` units and the conversion is
+// lossless.  The error code is `invalid_argument` if no tag matches, and `result_out_of_range` if
+// the conversion would be lossy.
+template <typename T, typename R>
+std::errc assign_alternative_if_lossless(uint64_t, R, T &, AlsoAccept<>) {
+    return std::errc::invalid_argument;
+}
+template <typename T, typename R, typename A, typename... As>
+std::errc assign_alternative_if_lossless(uint64_t tag, R value, T &x, AlsoAccept<A, As...>) {
+    using Source = typename WireCodec<T>::template WithUnit<A>;
+    if (tag != WireTag<Source>::value) {
+        return assign_alternative_if_lossless(tag, value, x, AlsoAccept<As...>{});
+    }
+    return WireCodec<T>::template assign_if_lossless<A>(value, x) ? std::errc{}
+                                                                  : std::errc::result_out_of_range;
+}
+
+template <typename T, typename R, typename... Alternatives>
+FromWireResult read_wire(const char *first, const char *last, T &x, AlsoAccept<Alternatives...>) {
+    if (last - first < static_cast<std::ptrdiff_t>(WireSize<T>::value)) {
+        return {first, std::errc::invalid_argument};
+    }
+    const auto tag = load_little_endian<uint64_t>(first);
+    const auto value = load_little_endian<R>(first + WIRE_TAG_SIZE);
+    const char *end = first + WireSize<T>::value;
+
+    if (tag == WireTag<T>::value) {
+        x = WireCodec<T>::make(value);
+        return {end, std::errc{}};
+    }
+
+    const auto ec = assign_alternative_if_lossless(tag, value, x, AlsoAccept<Alternatives...>{});
+    return {(ec == std::errc::invalid_argument) ? first : end, ec};
+}
+
+}  // namespace detail
+
+template <typename U, typename R>
+struct WireTag<Quantity<U, R>>
+    : std::integral_constant<uint64_t, detail::wire_tag<U, R>(detail::WireKind::QUANTITY)> {};
+
+template <typename U, typename R>
+struct WireTag<QuantityPoint<U, R>>
+    : std::integral_constant<
+          uint64_t,
+          detail::MixWireOrigin<detail::ValueDisplacementMagnitude<detail::ZeroValue,
+                                                                   detail::OriginOf<U>>>::
+              mix(detail::wire_tag<U, R>(detail::WireKind::QUANTITY_POINT))> {};
+
+template <typename U, typename R>
+struct WireSize<Quantity<U, R>> : std::integral_constant<std::size_t, WIRE_TAG_SIZE + sizeof(R)> {};
+
+template <typename U, typename R>
+struct WireSize<QuantityPoint<U, R>>
+    : std::integral_constant<std::size_t, WIRE_TAG_SIZE + sizeof(R)> {};
+
+//
+// Encode `q` into `[first, last)`.
+//
+// On success, `ptr` points one past the last byte written, and `ec` is empty.  If the buffer is too
+// small, `ptr` is `last`, `ec` is `std::errc::value_too_large`, and the buffer contents are
+// unspecified.
+//
+template <typename U, typename R>
+ToWireResult to_wire(char *first, char *last, const Quantity<U, R> &q) {
+    return detail::write_wire(first, last, q);
+}
+
+// Encode `p` into `[first, last)`.  The result has the same meaning as for a `Quantity`.
+template <typename U, typename R>
+ToWireResult to_wire(char *first, char *last, const QuantityPoint<U, R> &p) {
+    return detail::write_wire(first, last, p);
+}
+
+//
+// Decode a quantity from `[first, last)`, accepting values encoded in the destination unit, or in
+// any of the `AlsoAccept` units (with the same rep).
+//
+// On success, `ptr` points one past the last byte read, and `ec` is empty.  On failure, `q` is left
+// unmodified, and the error code is:
+//
+// - `std::errc::invalid_argument` (with `ptr == first`), if the buffer is too small to hold a value
+//   of this type, or if the tag doesn't match the destination or any alternative.
+// - `std::errc::result_out_of_range` (with `ptr` past the value), if converting the value from an
+//   alternative unit would overflow or truncate.
+//
+template <typename U, typename R, typename... Alternatives>
+FromWireResult from_wire(const char *first,
+                         const char *last,
+                         Quantity<U, R> &q,
+                         AlsoAccept<Alternatives...> alternatives) {
+    static_assert(HasSameDimension<U, Alternatives...>::value,
+                  "Can only accept units with the same dimension as the destination");
+    return detail::read_wire<Quantity<U, R>, R>(first, last, q, alternatives);
+}
+
+// Decode a quantity from `[first, last)`, accepting only values encoded in the destination unit.
+template <typename U, typename R>
+FromWireResult from_wire(const char *first, const char *last, Quantity<U, R> &q) {
+    return from_wire(first, last, q, AlsoAccept<>{});
+}
+
+//
+// Decode a quantity point from `[first, last)`, accepting values encoded in the destination unit,
+// or in any of the `AlsoAccept` units (with the same rep).  Pass the alternatives as unit types,
+// because point makers aren't unit slots: for example, `also_accept(Celsius{})`.
+//
+// The result has the same meaning as for a `Quantity`.
+//
+template <typename U, typename R, typename... Alternatives>
+FromWireResult from_wire(const char *first,
+                         const char *last,
+                         QuantityPoint<U, R> &p,
+                         AlsoAccept<Alternatives...> alternatives) {
+    static_assert(HasSameDimension<U, Alternatives...>::value,
+                  "Can only accept units with the same dimension as the destination");
+    return detail::read_wire<QuantityPoint<U, R>, R>(first, last, p, alternatives);
+}
+
+// Decode a quantity point from `[first, last)`, accepting only values encoded in the destination
+// unit.
+template <typename U, typename R>
+FromWireResult from_wire(const char *first, const char *last, QuantityPoint<U, R> &p) {
+    return from_wire(first, last, p, AlsoAccept<>{});
+}
+
+}  // namespace au
@@ -0,0 +1,230 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "au/wire.hh"
+
+#include <array>
+#include <cstdint>
+
+#include "au/prefix.hh"
+#include "au/testing.hh"
+#include "au/units/celsius.hh"
+#include "au/units/feet.hh"
+#include "au/units/hours.hh"
+#include "au/units/kelvins.hh"
+#include "au/units/meters.hh"
+#include "au/units/seconds.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+namespace au {
+namespace {
+
+using ::testing::Eq;
+using ::testing::Ne;
+
+using Buffer = std::array<char, 64>;
+
+// The wire tag and size of each type, as functions (so that the test macros don't ODR-use them).
+template <typename T>
+constexpr uint64_t tag_of() {
+    return WireTag<T>::value;
+}
+
+template <typename T>
+constexpr std::size_t size_of() {
+    return WireSize<T>::value;
+}
+
+// Encode `x` at the start of `buf`, and return the end of the encoding.
+template <typename T>
+const char *encode(Buffer &buf, const T &x) {
+    const auto result = to_wire(buf.data(), buf.data() + buf.size(), x);
+    EXPECT_THAT(result.ec, Eq(std::errc{}));
+    return result.ptr;
+}
+
+TEST(ToWire, WritesTagThenRepBytes) {
+    Buffer buf{};
+    const char *end = encode(buf, meters(int32_t{0x01020304}));
+
+    ASSERT_THAT(end - buf.data(), Eq(12));
+    EXPECT_THAT(buf[8], Eq('\x04'));
+    EXPECT_THAT(buf[9], Eq('\x03'));
+    EXPECT_THAT(buf[10], Eq('\x02'));
+    EXPECT_THAT(buf[11], Eq('\x01'));
+
+    uint64_t tag = 0u;
+    for (int i = 7; i >= 0; --i) {
+        tag = (tag << 8) | static_cast<unsigned char>(buf[static_cast<std::size_t>(i)]);
+    }
+    EXPECT_THAT(tag, Eq((tag_of<Quantity<Meters, int32_t>>())));
+}
+
+TEST(ToWire, SizeIsTagPlusRep) {
+    EXPECT_THAT((size_of<Quantity<Meters, double>>()), Eq(16u));
+    EXPECT_THAT((size_of<Quantity<Meters, int16_t>>()), Eq(10u));
+    EXPECT_THAT((size_of<QuantityPoint<Celsius, float>>()), Eq(12u));
+}
+
+TEST(ToWire, ReportsBufferTooSmall) {
+    Buffer buf{};
+    const auto result = to_wire(buf.data(), buf.data() + 15, meters(1.0));
+    EXPECT_THAT(result.ec, Eq(std::errc::value_too_large));
+    EXPECT_THAT(result.ptr, Eq(buf.data() + 15));
+}
+
+TEST(WireTag, DependsOnUnitRepAndKind) {
+    constexpr auto tag = (tag_of<Quantity<Meters, double>>());
+    EXPECT_THAT(tag, Ne((tag_of<Quantity<Feet, double>>())));
+    EXPECT_THAT(tag, Ne((tag_of<Quantity<Meters, float>>())));
+    EXPECT_THAT(tag, Ne((tag_of<Quantity<Meters, int64_t>>())));
+    EXPECT_THAT((tag_of<Quantity<Meters, int32_t>>()),
+                Ne((tag_of<Quantity<Meters, uint32_t>>())));
+    EXPECT_THAT(tag, Ne((tag_of<QuantityPoint<Meters, double>>())));
+}
+
+TEST(WireTag, SameForQuantityEquivalentUnits) {
+    EXPECT_THAT((tag_of<Quantity<Celsius, double>>()),
+                Eq((tag_of<Quantity<Kelvins, double>>())));
+}
+
+TEST(WireTag, PointsWithDifferentOriginsDiffer) {
+    EXPECT_THAT((tag_of<QuantityPoint<Celsius, double>>()),
+                Ne((tag_of<QuantityPoint<Kelvins, double>>())));
+}
+
+TEST(FromWire, RoundTripsQuantities) {
+    Buffer buf{};
+    const char *end = encode(buf, (meters / second)(12.5));
+
+    auto v = (meters / second)(0.0);
+    const auto result = from_wire(buf.data(), end, v);
+
+    EXPECT_THAT(result.ec, Eq(std::errc{}));
+    EXPECT_THAT(result.ptr, Eq(end));
+    EXPECT_THAT(v, SameTypeAndValue((meters / second)(12.5)));
+}
+
+TEST(FromWire, RoundTripsQuantityPoints) {
+    Buffer buf{};
+    const char *end = encode(buf, celsius_pt(int16_t{-40}));
+
+    auto p = celsius_pt(int16_t{0});
+    EXPECT_THAT(from_wire(buf.data(), end, p).ec, Eq(std::errc{}));
+    EXPECT_THAT(p, SameTypeAndValue(celsius_pt(int16_t{-40})));
+}
+
+TEST(FromWire, ReadsConsecutiveFields) {
+    Buffer buf{};
+    auto result = to_wire(buf.data(), buf.data() + buf.size(), meters(1.5));
+    result = to_wire(result.ptr, buf.data() + buf.size(), seconds(int8_t{7}));
+    const char *end = result.ptr;
+
+    auto d = meters(0.0);
+    auto t = seconds(int8_t{0});
+    const auto first = from_wire(buf.data(), end, d);
+    const auto second = from_wire(first.ptr, end, t);
+
+    EXPECT_THAT(second.ec, Eq(std::errc{}));
+    EXPECT_THAT(second.ptr, Eq(end));
+    EXPECT_THAT(d, SameTypeAndValue(meters(1.5)));
+    EXPECT_THAT(t, SameTypeAndValue(seconds(int8_t{7})));
+}
+
+TEST(FromWire, RejectsUnknownTagAndLeavesDestinationUnmodified) {
+    Buffer buf{};
+    const char *end = encode(buf, feet(3.0));
+
+    auto q = meters(1.0);
+    const auto result = from_wire(buf.data(), end, q);
+
+    EXPECT_THAT(result.ec, Eq(std::errc::invalid_argument));
+    EXPECT_THAT(result.ptr, Eq(buf.data()));
+    EXPECT_THAT(q, SameTypeAndValue(meters(1.0)));
+}
+
+TEST(FromWire, RejectsDifferentRep) {
+    Buffer buf{};
+    const char *end = encode(buf, meters(3.0f));
+
+    auto q = meters(1.0);
+    EXPECT_THAT(from_wire(buf.data(), end, q).ec, Eq(std::errc::invalid_argument));
+}
+
+TEST(FromWire, RejectsTruncatedBuffer) {
+    Buffer buf{};
+    const char *end = encode(buf, meters(3.0));
+
+    auto q = meters(1.0);
+    const auto result = from_wire(buf.data(), end - 1, q);
+
+    EXPECT_THAT(result.ec, Eq(std::errc::invalid_argument));
+    EXPECT_THAT(result.ptr, Eq(buf.data()));
+    EXPECT_THAT(q, SameTypeAndValue(meters(1.0)));
+}
+
+TEST(FromWire, ConvertsFromAlternativeUnits) {
+    Buffer buf{};
+    const char *end = encode(buf, (kilo(meters) / hour)(36.0));
+
+    auto v = (meters / second)(0.0);
+    const auto result =
+        from_wire(buf.data(), end, v, also_accept(feet / second, kilo(meters) / hour));
+
+    EXPECT_THAT(result.ec, Eq(std::errc{}));
+    EXPECT_THAT(result.ptr, Eq(end));
+    EXPECT_THAT(v, SameTypeAndValue((meters / second)(10.0)));
+}
+
+TEST(FromWire, RejectsLossyConversionFromAlternativeUnit) {
+    Buffer buf{};
+    const char *end = encode(buf, milli(meters)(int32_t{1'500}));
+
+    auto q = meters(int32_t{0});
+    const auto result = from_wire(buf.data(), end, q, also_accept(milli(meters)));
+
+    EXPECT_THAT(result.ec, Eq(std::errc::result_out_of_range));
+    EXPECT_THAT(result.ptr, Eq(end));
+    EXPECT_THAT(q, SameTypeAndValue(meters(int32_t{0})));
+}
+
+TEST(FromWire, ConvertsPointsFromAlternativeOrigins) {
+    Buffer buf{};
+    const char *end = encode(buf, kelvins_pt(int32_t{300}));
+
+    auto p = celsius_pt(int32_t{0});
+    EXPECT_THAT(from_wire(buf.data(), end, p).ec, Eq(std::errc::invalid_argument));
+
+    // 300 K is 26.85 degrees C, which doesn't fit in an integer number of degrees C.
+    EXPECT_THAT(from_wire(buf.data(), end, p, also_accept(Kelvins{})).ec,
+                Eq(std::errc::result_out_of_range));
+
+    end = encode(buf, milli(kelvins_pt)(int32_t{300'150}));
+    EXPECT_THAT(from_wire(buf.data(), end, p, also_accept(Kelvins{}, Milli<Kelvins>{})).ec,
+                Eq(std::errc{}));
+    EXPECT_THAT(p, SameTypeAndValue(celsius_pt(int32_t{27})));
+}
+
+TEST(FromWire, RejectsPointConversionsThatOverflow) {
+    Buffer buf{};
+    const char *end = encode(buf, celsius_pt(int16_t{30'000}));
+
+    auto p = kelvins_pt(int16_t{0});
+    EXPECT_THAT(from_wire(buf.data(), end, p, also_accept(Celsius{})).ec,
+                Eq(std::errc::result_out_of_range));
+}
+
+}  // namespace
+}  // namespace au
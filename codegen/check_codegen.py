@@ -0,0 +1,201 @@
+# Copyright 2026 Aurora Operations, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Check that Au kernels compile to no more arithmetic than their raw-number partners.
+
+The library under test contains pairs of functions, `au_NAME` and `raw_NAME`.  We disassemble it,
+count the arithmetic instructions, the hardware integer divisions, and the calls in each function,
+and fail if any Au function has more of any of these than its raw partner.
+
+We count integer divisions separately, because they are so much slower than other arithmetic.
+Dividing by a constant should compile to a multiply-high-and-shift sequence, which is _more_
+instructions than a single `idiv`, so the arithmetic count alone would not catch a regression.
+
+Usage: check_codegen.py [--known-gap=NAME ...] LIBRARY
+
+A "known gap" is a pair where we already know that Au emits more instructions.  We still report it,
+but it doesn't fail the test.  This keeps the gap visible until it's fixed.
+"""
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+AU_PREFIX = 'au_'
+RAW_PREFIX = 'raw_'
+
+_FUNCTION_HEADER = re.compile(r'^[0-9a-f]+ <(?P<name>[^>]+)>:$')
+_INSTRUCTION = re.compile(r'^\s+[0-9a-f]+:\s+(?P<mnemonic>[a-z][\w.]*)\s*(?P<operands>.*)$')
+
+# Arithmetic mnemonics, by architecture.
+_ARITHMETIC = {
+    'x86-64': re.compile(
+        r'^('
+        # Integer arithmetic (with optional AT&T size suffix).
+        r'(add|adc|sub|sbb|imul|mul|idiv|div|neg|inc|dec|sar|shr|shl|sal|lea)[bwlq]?'
+        # Scalar and packed floating point arithmetic (SSE and AVX).
+        r'|v?(add|sub|mul|div|sqrt|min|max|round|rcp|rsqrt)(ss|sd|ps|pd)'
+        r'|vf(n)?m(add|sub)\w+'
+        # Conversions between numeric types.
+        r'|v?cvt\w+'
+        r')$'
+    ),
+    'aarch64': re.compile(
+        r'^('
+        r'add|adds|sub|subs|neg|mul|madd|msub|smull|umull|smulh|umulh|sdiv|udiv|lsl|lsr|asr'
+        r'|fadd|fsub|fmul|fdiv|fsqrt|fmadd|fmsub|fnmadd|fnmsub|fneg|fmin|fmax|frint\w*'
+        r'|fcvt\w*|scvtf|ucvtf'
+        r')$'
+    ),
+}
+
+_INTEGER_DIVIDE = {
+    'x86-64': re.compile(r'^i?div[bwlq]?$'),
+    'aarch64': re.compile(r'^[su]div$'),
+}
+
+_CALL = {
+    'x86-64': re.compile(r'^(call|jmp)q?$'),
+    'aarch64': re.compile(r'^(bl|b)$'),
+}
+
+# Instructions that only adjust the stack pointer are bookkeeping, not arithmetic.
+_STACK_POINTER = re.compile(r'%rsp\s*$|^sp,')
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--known-gap', action='append', default=[])
+    parser.add_argument('library')
+    args = parser.parse_args(argv)
+
+    disassembly = _disassemble(args.library)
+    arch = _architecture(disassembly)
+    counts = _count_instructions(disassembly, arch)
+    ok = _check_pairs(counts, known_gaps=set(args.known_gap))
+    return 0 if ok else 1
+
+
+def _disassemble(library):
+    objdump = (
+        os.environ.get('OBJDUMP') or shutil.which('llvm-objdump') or shutil.which('objdump')
+    )
+    if not objdump:
+        sys.exit('Could not find `objdump`.  Install it, or set the `OBJDUMP` environment variable')
+
+    result = subprocess.run(
+        [objdump, '-d', '--no-show-raw-insn', library], stdout=subprocess.PIPE, check=True
+    )
+    return result.stdout.decode()
+
+
+def _architecture(disassembly):
+    if re.search(r'file format \S*x86-64', disassembly):
+        return 'x86-64'
+    if re.search(r'file format \S*(aarch64|arm64)', disassembly):
+        return 'aarch64'
+    sys.exit('Unsupported architecture; please add its arithmetic mnemonics to this script.')
+
+
+class _Counts:
+    def __init__(self):
+        self.arithmetic = 0
+        self.divides = 0
+        self.calls = 0
+
+    def is_worse_than(self, other):
+        return (
+            self.arithmetic > other.arithmetic
+            or self.divides > other.divides
+            or self.calls > other.calls
+        )
+
+    def __str__(self):
+        return f'{self.arithmetic} arithmetic ({self.divides} integer divide), {self.calls} calls'
+
+
+def _count_instructions(disassembly, arch):
+    counts = {}
+    current = None
+    for line in disassembly.splitlines():
+        header = _FUNCTION_HEADER.match(line)
+        if header:
+            name = header.group('name')
+            is_kernel = name.startswith(AU_PREFIX) or name.startswith(RAW_PREFIX)
+            current = counts.setdefault(name, _Counts()) if is_kernel else None
+            continue
+
+        instruction = _INSTRUCTION.match(line)
+        if current is None or not instruction:
+            continue
+
+        mnemonic = instruction.group('mnemonic')
+        operands = instruction.group('operands')
+        if _ARITHMETIC[arch].match(mnemonic) and not _STACK_POINTER.search(operands):
+            # A `lea` which just computes an address relative to the instruction pointer is loading
+            # a constant, not doing arithmetic.
+            if not (mnemonic.startswith('lea') and '%rip' in operands):
+                current.arithmetic += 1
+            if _INTEGER_DIVIDE[arch].match(mnemonic):
+                current.divides += 1
+        elif _CALL[arch].match(mnemonic) and _is_call_target(operands):
+            current.calls += 1
+    return counts
+
+
+def _is_call_target(operands):
+    # Jumps within a function are control flow.  Jumps to another symbol (tail calls) are calls.
+    target = re.search(r'<([^>+]+)(\+0x[0-9a-f]+)?>', operands)
+    return target is not None and target.group(2) is None
+
+
+def _check_pairs(counts, known_gaps):
+    ok = True
+    names = sorted(name[len(AU_PREFIX) :] for name in counts if name.startswith(AU_PREFIX))
+
+    for name in sorted(
+        name[len(RAW_PREFIX) :] for name in counts if name.startswith(RAW_PREFIX)
+    ):
+        if name not in names:
+            print(f'ERROR: `{RAW_PREFIX}{name}` has no `{AU_PREFIX}{name}` partner')
+            ok = False
+
+    for name in names:
+        au = counts[AU_PREFIX + name]
+        raw = counts.get(RAW_PREFIX + name)
+        if raw is None:
+            print(f'ERROR: `{AU_PREFIX}{name}` has no `{RAW_PREFIX}{name}` partner')
+            ok = False
+            continue
+
+        is_worse = au.is_worse_than(raw)
+        if name in known_gaps:
+            status = 'KNOWN GAP' if is_worse else 'KNOWN GAP CLOSED (remove from list)'
+        else:
+            status = 'FAIL' if is_worse else 'OK'
+            ok = ok and not is_worse
+        print(f'{status:>9}  {name}: Au has {au}; raw has {raw}')
+
+    for name in sorted(known_gaps - set(names)):
+        print(f'ERROR: known gap `{name}` does not name any kernel')
+        ok = False
+
+    return ok
+
+
+if __name__ == '__main__':
+    sys.exit(main())
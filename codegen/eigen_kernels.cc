@@ -0,0 +1,47 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <Eigen/Core>
+
+#include "au/au.hh"
+#include "au/compatibility/eigen.hh"
+#include "au/units/meters.hh"
+
+// Paired kernels for the Eigen compatibility layer.  See `kernels.cc` for the conventions.
+
+namespace au {
+
+extern "C" {
+
+double raw_eigen_norm(const Eigen::Vector3d &v_m) { return v_m.norm(); }
+double au_eigen_norm(const Quantity<Meters, Eigen::Vector3d> &v) { return norm(v).in(meters); }
+
+double raw_eigen_dot(const Eigen::Vector3d &a_m, const Eigen::Vector3d &b_m) {
+    return a_m.dot(b_m);
+}
+double au_eigen_dot(const Quantity<Meters, Eigen::Vector3d> &a,
+                    const Quantity<Meters, Eigen::Vector3d> &b) {
+    return dot(a, b).in(meters * meters);
+}
+
+void raw_eigen_convert(const Eigen::Vector3d &v_m, Eigen::Vector3d &out_mm) {
+    out_mm = v_m * 1000.0;
+}
+void au_eigen_convert(const Quantity<Meters, Eigen::Vector3d> &v, Eigen::Vector3d &out_mm) {
+    out_mm = v.in(milli(meters));
+}
+
+}  // extern "C"
+
+}  // namespace au
@@ -0,0 +1,113 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstdint>
+
+#include "au/au.hh"
+#include "au/units/celsius.hh"
+#include "au/units/feet.hh"
+#include "au/units/inches.hh"
+#include "au/units/kelvins.hh"
+#include "au/units/meters.hh"
+#include "examples/angular_velocity/au.hh"
+#include "examples/angular_velocity/raw.hh"
+
+// Paired kernels for the codegen-equivalence test.
+//
+// Every `au_NAME` function has a `raw_NAME` partner, which does the same job with raw numbers.  The
+// test disassembles both, and fails if the Au version emits more arithmetic instructions (or more
+// calls) than its raw partner.  The functions are `extern "C"` so that the names in the object file
+// are exactly the names written here.
+//
+// Take Au quantities as parameters and return raw numbers (or the reverse) where it's convenient:
+// `Quantity<U, R>` has the same layout and calling convention as `R`, so this doesn't change the
+// generated code.
+
+namespace au {
+
+extern "C" {
+
+//
+// Conversions.
+//
+
+double raw_convert_float(double length_ft) { return length_ft * 0.3048; }
+double au_convert_float(QuantityD<Feet> length) { return length.in(meters); }
+
+int32_t raw_convert_integer_divide(int32_t length_mm) { return length_mm / 1000; }
+int32_t au_convert_integer_divide(QuantityI32<Milli<Meters>> length) {
+    return length.in(meters, ignore(TRUNCATION_RISK));
+}
+
+int32_t raw_convert_nontrivial_rational(int32_t length_in) { return length_in * 127 / 5; }
+int32_t au_convert_nontrivial_rational(QuantityI32<Inches> length) {
+    return length.in(milli(meters), ignore(TRUNCATION_RISK));
+}
+
+int64_t raw_convert_nontrivial_rational_int64(int64_t length_in) { return length_in * 127 / 5; }
+int64_t au_convert_nontrivial_rational_int64(QuantityI64<Inches> length) {
+    return length.in(milli(meters), ignore(TRUNCATION_RISK));
+}
+
+//
+// `QuantityPoint`.
+//
+
+double raw_point_difference(double a_m, double b_m) { return a_m - b_m; }
+double au_point_difference(QuantityPointD<Meters> a, QuantityPointD<Meters> b) {
+    return (a - b).in(meters);
+}
+
+// Known gap: for floating point reps, Au converts through the common point unit of Celsius and
+// Kelvins (one-twentieth of a Kelvin), which costs a multiply and a divide on top of the addition.
+double raw_point_convert_with_offset(double temp_c) { return temp_c + 273.15; }
+double au_point_convert_with_offset(QuantityPointD<Celsius> temp) { return temp.in(kelvins_pt); }
+
+int32_t raw_int_point_convert_with_offset(int32_t temp_c) { return temp_c * 1000 + 273'150; }
+int32_t au_int_point_convert_with_offset(QuantityPointI32<Celsius> temp) {
+    return temp.in(milli(kelvins_pt));
+}
+
+//
+// Math functions.
+//
+
+// `int_round_as` rounds without leaving the integral domain: truncate, then add back the truncated
+// remainder, expressed in half-units (which is either 0 or 1, with the same sign as the input).
+int32_t raw_int_round_as(int32_t length_mm) {
+    const int32_t length_m = length_mm / 1000;
+    return length_m + (length_mm - length_m * 1000) / 500;
+}
+int32_t au_int_round_as(QuantityI32<Milli<Meters>> length) {
+    return int_round_in(meters, length);
+}
+
+double raw_hypot(double x_m, double y_m) { return std::hypot(x_m, y_m); }
+double au_hypot(QuantityD<Meters> x, QuantityD<Meters> y) { return hypot(x, y).in(meters); }
+
+//
+// Examples from the documentation.
+//
+
+// `wheel_rpm()` from `//examples/angular_velocity`, whose doc page claims that the Au version takes
+// two floating point instructions, against the raw version's three.
+float raw_wheel_rpm(float v_mps, float r_m) { return angular_velocity::wheel_rpm(v_mps, r_m); }
+float au_wheel_rpm(QuantityF<angular_velocity::MetersPerSecond> v, QuantityF<Meters> r) {
+    return angular_velocity::wheel_rpm(v, r).in(angular_velocity::Rpm{});
+}
+
+}  // extern "C"
+
+}  // namespace au
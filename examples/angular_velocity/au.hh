@@ -0,0 +1,59 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOTE TO EDITORS: this file is line-aligned with `raw.hh`.  See the note in `raw.cc`.
+//
+// The unparenthesized `v * rad / r` below is deliberate.  Writing `v * (rad / r)` asks for the
+// ratio as a value, and since `rad` carries no number, that means materializing the reciprocal
+// `1 / r`: a division *and* a multiplication, where `v * rad / r` costs only the division.  The doc
+// page claims two floating point instructions against the raw version's three.  Parenthesizing
+// would make that claim false while leaving the output and the line count unchanged, so
+// `//codegen:codegen_test` compiles this very function and checks the claim.
+
+#pragma once
+
+// --8<-- [start:frontmatter]
+#include "au/au.hh"
+#include "au/units/meters.hh"
+#include "au/units/minutes.hh"
+#include "au/units/radians.hh"
+#include "au/units/revolutions.hh"
+#include "au/units/seconds.hh"
+
+namespace angular_velocity {
+
+// This is a `.hh` file, so we can't import Au's names with `using` declarations: they would leak
+// into every file that includes this one.  Instead, we give our own names to the few we need.  Each
+// alias introduces one name we chose, so it is fine at namespace scope.  See the "Namespaces and
+// includes" discussion page.
+template <typename U>
+using QuantityF = au::QuantityF<U>;
+using Meters = au::Meters;
+using Rpm = au::UnitQuotient<au::Revolutions, au::Minutes>;
+using MetersPerSecond = au::UnitQuotient<au::Meters, au::Seconds>;
+constexpr auto rad = au::symbols::rad;
+// --8<-- [end:frontmatter]
+
+// clang-format off
+// --8<-- [start:example]
+// --8<-- [start:headline]
+// The types state the units.  Nothing to remember; nothing to convert.
+inline QuantityF<Rpm> wheel_rpm(QuantityF<MetersPerSecond> v, QuantityF<Meters> r) {
+    return v * rad / r;
+}
+// --8<-- [end:headline]
+// --8<-- [end:example]
+// clang-format on
+
+}  // namespace angular_velocity
@@ -12,30 +12,30 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-// NOTE TO EDITORS: this file is line-aligned with `au.cc`, so that readers can flip between the two
-// on the doc website and compare corresponding lines in place.  The region between the
-// `[start:example]` and `[end:example]` markers must keep the same number of lines in both files,
-// with corresponding constructs on corresponding lines.  `//examples:angular_velocity_test`
-// enforces the line count; keeping the lines *meaningfully* aligned is on you.
+// NOTE TO EDITORS: this file is line-aligned with `au.cc`, and `raw.hh` with `au.hh`, so that
+// readers can flip between the two on the doc website and compare corresponding lines in place.
+// The region between the `[start:example]` and `[end:example]` markers must keep the same number of
+// lines in both files of each pair, with corresponding constructs on corresponding lines.
+// `//examples:angular_velocity_test` enforces the line counts; keeping the lines *meaningfully*
+// aligned is on you.
 //
-// That region is fenced off from clang-format, which would otherwise collapse short function
+// `wheel_rpm()` lives in a header, rather than here, so that `//codegen:codegen_test` can compile
+// this example's own function, and check the doc page's claim about its instruction count.
+//
+// Each region is fenced off from clang-format, which would otherwise collapse short function
 // bodies onto one line and silently destroy the alignment.  Format it by hand, in house style.
 // The fences sit outside the snippet markers, so they never show up on the website.
 
 // --8<-- [start:frontmatter]
-#include <cmath>
 #include <iostream>
+
+#include "examples/angular_velocity/raw.hh"
+
+using angular_velocity::wheel_rpm;
 // --8<-- [end:frontmatter]
 
 // clang-format off
 // --8<-- [start:example]
-// --8<-- [start:headline]
-// Speed must be m/s.  Radius must be meters.  Returns RPM.
-float wheel_rpm(float v_mps, float r_m) {
-    return v_mps / (2.0f * static_cast<float>(M_PI) * r_m) * 60.0f;
-}
-// --8<-- [end:headline]
-
 int main() {
     // The wheel radius is 350 mm, so convert it to meters by hand first.
     const float omega_rpm = wheel_rpm(15.0f, 350.0f / 1000.0f);
@@ -0,0 +1,36 @@
+// Copyright 2026 Aurora Operations, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// NOTE TO EDITORS: this file is line-aligned with `au.hh`.  See the note in `raw.cc`.
+
+#pragma once
+
+// --8<-- [start:frontmatter]
+#include <cmath>
+
+namespace angular_velocity {
+// --8<-- [end:frontmatter]
+
+// clang-format off
+// --8<-- [start:example]
+// --8<-- [start:headline]
+// Speed must be m/s.  Radius must be meters.  Returns RPM.
+inline float wheel_rpm(float v_mps, float r_m) {
+    return v_mps / (2.0f * static_cast<float>(M_PI) * r_m) * 60.0f;
+}
+// --8<-- [end:headline]
+// --8<-- [end:example]
+// clang-format on
+
+}  // namespace angular_velocity
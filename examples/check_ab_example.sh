@@ -15,15 +15,18 @@
 #
 # Checks that an A/B example pair stays trustworthy.  See `ab_example.bzl` for the rationale.
 #
-# Usage: check_ab_example.sh RAW_BIN AU_BIN EXPECTED_TXT RAW_SRC AU_SRC
+# Usage: check_ab_example.sh RAW_BIN AU_BIN EXPECTED_TXT RAW_SRC AU_SRC [RAW_SRC AU_SRC ...]
+#
+# Each `RAW_SRC AU_SRC` pair is checked for line alignment separately: a pair which defines headers
+# shows them above the programs, so the headers must line up with each other, and so must the
+# programs.
 
 set -euo pipefail
 
 raw_bin="$1"
 au_bin="$2"
 expected_txt="$3"
-raw_src="$4"
-au_src="$5"
+shift 3
 
 status=0
 
@@ -53,18 +56,24 @@ region_lines() {
         sed -e :a -e '/^\n*$/{$d;N;ba' -e '}' |
         grep -c '' || true  # An empty region makes `grep` exit non-zero; report it below instead.
 }
-raw_lines="$(region_lines "${raw_src}")"
-au_lines="$(region_lines "${au_src}")"
+while [ "$#" -ge 2 ]; do
+    raw_src="$1"
+    au_src="$2"
+    shift 2
+
+    raw_lines="$(region_lines "${raw_src}")"
+    au_lines="$(region_lines "${au_src}")"
 
-if [ "${raw_lines}" -eq 0 ]; then
-    echo "FAIL: no '[start:example]'/'[end:example]' region found in ${raw_src}." >&2
-    status=1
-elif [ "${raw_lines}" != "${au_lines}" ]; then
-    echo "FAIL: the doc-visible regions are not line-aligned." >&2
-    echo "  ${raw_src}: ${raw_lines} lines" >&2
-    echo "  ${au_src}: ${au_lines} lines" >&2
-    echo "  Pad the shorter region with blank lines so the tabs blink cleanly." >&2
-    status=1
-fi
+    if [ "${raw_lines}" -eq 0 ]; then
+        echo "FAIL: no '[start:example]'/'[end:example]' region found in ${raw_src}." >&2
+        status=1
+    elif [ "${raw_lines}" != "${au_lines}" ]; then
+        echo "FAIL: the doc-visible regions are not line-aligned." >&2
+        echo "  ${raw_src}: ${raw_lines} lines" >&2
+        echo "  ${au_src}: ${au_lines} lines" >&2
+        echo "  Pad the shorter region with blank lines so the tabs blink cleanly." >&2
+        status=1
+    fi
+done
 
 exit "${status}"
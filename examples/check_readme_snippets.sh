@@ -21,7 +21,7 @@
 #
 # Mark a README block like this, naming the file and the snippet region it was copied from:
 #
-#     <!-- BEGIN EXAMPLE: examples/angular_velocity/au.cc:headline -->
+#     <!-- BEGIN EXAMPLE: examples/angular_velocity/au.hh:headline -->
 #     ```cpp
 #     ...copied code...
 #     ```
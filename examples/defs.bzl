@@ -40,6 +40,11 @@ both:
      corresponding constructs sit at the same height in both tabs.  Where Au needs less code, pad
      with a blank line rather than letting the two versions drift out of alignment.
 
+A pair may also define headers (`raw_hdrs` and `au_hdrs`), which become a `cc_library` for each
+side.  This is for functions that something else needs to build, too: the codegen test compiles
+`angular_velocity`'s own `wheel_rpm()`, rather than a copy which could drift.  The headers are
+a pair in their own right, and get the same line-alignment check.
+
 --------------------------------------------------------------------------------------------------
 
 `single_example`: the standalone code examples.
@@ -61,7 +66,15 @@ project will end up with, so it is the shape the example should build.
 load("@rules_cc//cc:defs.bzl", "cc_binary", "cc_library")
 load("@rules_shell//shell:sh_test.bzl", "sh_test")
 
-def ab_example(name, expected_output, au_deps, raw_srcs = None, au_srcs = None):
+def ab_example(
+        name,
+        expected_output,
+        au_deps,
+        raw_srcs = None,
+        au_srcs = None,
+        raw_hdrs = None,
+        au_hdrs = None,
+        lib_visibility = None):
     """Defines a raw-vs-Au example pair, plus the tests that keep the pair trustworthy.
 
     Args:
@@ -70,19 +83,44 @@ def ab_example(name, expected_output, au_deps, raw_srcs = None, au_srcs = None):
       au_deps: Deps for the Au version (the raw version must have none by construction).
       raw_srcs: Sources for the raw version.  Defaults to `<name>/raw.cc`.
       au_srcs: Sources for the Au version.  Defaults to `<name>/au.cc`.
+      raw_hdrs: Headers for the raw version, if any.  These become the `<name>_raw_lib` library.
+      au_hdrs: Headers for the Au version, if any.  These become the `<name>_au_lib` library.
+      lib_visibility: Visibility of the two libraries, for targets outside this package which
+        build the example's own code.
     """
     raw_srcs = raw_srcs or ["{}/raw.cc".format(name)]
     au_srcs = au_srcs or ["{}/au.cc".format(name)]
+    raw_hdrs = raw_hdrs or []
+    au_hdrs = au_hdrs or []
+
+    # Empty unless this example defines headers, in which case each program depends on its own.
+    raw_lib_deps = []
+    au_lib_deps = []
+    if raw_hdrs or au_hdrs:
+        cc_library(
+            name = "{}_raw_lib".format(name),
+            hdrs = raw_hdrs,
+            visibility = lib_visibility,
+        )
+        cc_library(
+            name = "{}_au_lib".format(name),
+            hdrs = au_hdrs,
+            deps = au_deps,
+            visibility = lib_visibility,
+        )
+        raw_lib_deps = [":{}_raw_lib".format(name)]
+        au_lib_deps = [":{}_au_lib".format(name)]
 
     cc_binary(
         name = "{}_raw".format(name),
         srcs = raw_srcs,
+        deps = raw_lib_deps,
     )
 
     cc_binary(
         name = "{}_au".format(name),
         srcs = au_srcs,
-        deps = au_deps,
+        deps = au_lib_deps + au_deps,
     )
 
     native.genrule(
@@ -96,9 +134,13 @@ def ab_example(name, expected_output, au_deps, raw_srcs = None, au_srcs = None):
     # exactly the ones the tests below compile and run.
     native.filegroup(
         name = "{}_doc_sources".format(name),
-        srcs = raw_srcs + au_srcs,
+        srcs = raw_hdrs + raw_srcs + au_hdrs + au_srcs,
     )
 
+    # Each `(raw, au)` pair of files whose `example` regions must line up.
+    aligned_pairs = [(raw_hdrs[0], au_hdrs[0])] if (raw_hdrs and au_hdrs) else []
+    aligned_pairs.append((raw_srcs[0], au_srcs[0]))
+
     sh_test(
         name = "{}_test".format(name),
         srcs = ["check_ab_example.sh"],
@@ -106,14 +148,16 @@ def ab_example(name, expected_output, au_deps, raw_srcs = None, au_srcs = None):
             "$(rootpath :{}_raw)".format(name),
             "$(rootpath :{}_au)".format(name),
             "$(rootpath :{}_expected.txt)".format(name),
-            "$(rootpath {})".format(raw_srcs[0]),
-            "$(rootpath {})".format(au_srcs[0]),
+        ] + [
+            "$(rootpath {})".format(src)
+            for pair in aligned_pairs
+            for src in pair
         ],
         data = [
             ":{}_au".format(name),
             ":{}_expected.txt".format(name),
             ":{}_raw".format(name),
-        ] + raw_srcs + au_srcs + ["check_output.sh"],
+        ] + raw_hdrs + raw_srcs + au_hdrs + au_srcs + ["check_output.sh"],
     )
 
 def single_example(name, expected_output, deps, main_src = None, lib_srcs = None, hdrs = None):